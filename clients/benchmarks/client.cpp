@@ -48,12 +48,59 @@
 using namespace roc; // For emulated program_options
 typedef int hipblas_int;
 
-int hipblas_bench_datafile()
+// Times the first call of the function, including any kernel compilation the
+// backend does on first use, separately from the steady state measured with the
+// usual cold and hot iterations. Only the first run of a function in the
+// process sees a cold start.
+int run_bench_startup_latency(Arguments& arg)
 {
-    int ret = 0;
+    Arguments first(arg);
+    first.cold_iters = 0;
+    first.iters      = 1;
+    first.norm_check = 0; // verification would make the first call
+    std::cout << "hipblas-bench INFO: " << arg.function << " first call" << std::endl;
+    int ret = run_bench_test(first, 0, 1);
+    std::cout << "hipblas-bench INFO: " << arg.function << " steady state" << std::endl;
+    return ret | run_bench_test(arg, 0, 1);
+}
+
+// Runs every test of the data file. Each test counts weight times in the
+// aggregate printed at the end, so a file written by hipblas_log2yaml.py from
+// a bench log reports the time the logged calls take together.
+int hipblas_bench_datafile(bool startup_latency)
+{
+    int     ret         = 0;
+    size_t  tests       = 0;
+    size_t  untimed     = 0;
+    int64_t calls       = 0;
+    double  weighted_us = 0;
     for(Arguments arg : HipBLAS_TestData())
-        ret |= run_bench_test(arg, 0, 1);
+    {
+        ArgumentModel_set_last_call_us(ArgumentLogging::NA_value);
+        ret |= startup_latency ? run_bench_startup_latency(arg) : run_bench_test(arg, 0, 1);
+
+        double call_us = ArgumentModel_get_last_call_us();
+        if(call_us < 0)
+        {
+            untimed++;
+            continue;
+        }
+        tests++;
+        calls += arg.weight;
+        weighted_us += call_us * arg.weight;
+    }
     test_cleanup::cleanup();
+
+    if(tests)
+    {
+        std::cout << "\nweighted aggregate\n"
+                  << "tests,calls,hipblas-us,hipblas-us-per-call\n"
+                  << tests << ", " << calls << ", " << weighted_us << ", "
+                  << (calls ? weighted_us / calls : 0) << std::endl;
+        if(untimed)
+            std::cout << "hipblas-bench INFO: " << untimed
+                      << " tests were not timed and are left out of the aggregate" << std::endl;
+    }
     return ret;
 }
 
@@ -148,6 +195,7 @@ try
     bool atomics_not_allowed = false;
     bool log_function_name   = false;
     bool log_datatype        = false;
+    bool startup_latency     = false;
 
     options_description desc("hipblas-bench command line options");
 
@@ -155,17 +203,17 @@ try
     desc.add_options()
 
         ("sizem,m",
-         value<hipblas_int>(&arg.M)->default_value(128),
+         value<int64_t>(&arg.M)->default_value(128),
          "Specific matrix size: sizem is only applicable to BLAS-2 & BLAS-3: the number of "
          "rows or columns in matrix.")
 
         ("sizen,n",
-         value<hipblas_int>(&arg.N)->default_value(128),
+         value<int64_t>(&arg.N)->default_value(128),
          "Specific matrix/vector size: BLAS-1: the length of the vector. BLAS-2 & "
          "BLAS-3: the number of rows or columns in matrix")
 
         ("sizek,k",
-         value<hipblas_int>(&arg.K)->default_value(128),
+         value<int64_t>(&arg.K)->default_value(128),
          "Specific matrix size: BLAS-2: the number of sub or super-diagonals of A. BLAS-3: "
          "the number of columns in A and rows in B.")
 
@@ -302,6 +350,10 @@ try
          value<hipblas_int>(&arg.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched and strided_batched routines")
 
+        ("group_count",
+         value<hipblas_int>(&arg.group_count)->default_value(1),
+         "Number of groups, each of batch_count matrices. Only applicable to grouped routines")
+
         ("verify,v",
          value<hipblas_int>(&arg.norm_check)->default_value(0),
          "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
@@ -354,6 +406,10 @@ try
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
 
+        ("startup_latency",
+         bool_switch(&startup_latency)->default_value(false),
+         "Time the first call of the function separately from the steady state")
+
         ("help,h", "produces this help message");
 
         //("version", "Prints the version number");
@@ -395,7 +451,7 @@ try
     set_device(device_id);
 
     if(datafile)
-        return hipblas_bench_datafile();
+        return hipblas_bench_datafile(startup_latency);
 
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
@@ -437,7 +493,9 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
-    if(!parallel_devices)
+    if(startup_latency)
+        return run_bench_startup_latency(arg);
+    else if(!parallel_devices)
         return run_bench_test(arg, 0, 1);
     else
         return run_bench_multi_gpu_test(parallel_devices, arg);
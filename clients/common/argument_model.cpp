@@ -47,3 +47,15 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static double last_call_us = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_last_call_us(double us)
+{
+    last_call_us = us;
+}
+
+double ArgumentModel_get_last_call_us()
+{
+    return last_call_us;
+}
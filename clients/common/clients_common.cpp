@@ -99,6 +99,9 @@
 #include "testing_swap.hpp"
 #include "testing_swap_batched.hpp"
 #include "testing_swap_strided_batched.hpp"
+#include "testing_submission_overhead.hpp"
+#include "testing_gemm_tile_split.hpp"
+#include "testing_ilp64.hpp"
 // blas2
 #include "testing_gbmv.hpp"
 #include "testing_gbmv_batched.hpp"
@@ -178,6 +181,7 @@
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_grouped_batched.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "testing_hemm.hpp"
@@ -332,6 +336,12 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"scal_ex", testname_scal_ex},
         {"scal_batched_ex", testname_scal_batched_ex},
         {"scal_strided_batched_ex", testname_scal_strided_batched_ex},
+        {"submission_overhead", testname_submission_overhead},
+        {"gemm_tile_split", testname_gemm_tile_split},
+        {"axpy_64", testname_ilp64_vector},
+        {"dot_64", testname_ilp64_vector},
+        {"iamax_64", testname_ilp64_vector},
+        {"gemm_64", testname_ilp64_gemm},
 
         // L2
         {"gbmv", testname_gbmv},
@@ -423,6 +433,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
+        {"gemm_grouped_batched", testname_gemm_grouped_batched},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
         {"hemm_strided_batched", testname_hemm_strided_batched},
@@ -557,6 +568,13 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
         static const func_map fmap = {
             // L1
             {"asum", testing_asum<T>},
+            {"submission_overhead", testing_submission_overhead<T>},
+            {"gemm_tile_split", testing_gemm_tile_split<T>},
+            {"axpy_64", testing_axpy_64<T>},
+            {"dot_64", testing_dot_64<T>},
+            {"iamax_64", testing_iamax_64<T>},
+            {"gemm_64", testing_gemm_64<T>},
+            {"gemm_grouped_batched", testing_gemm_grouped_batched<T>},
         /*    {"asum_batched", testing_asum_batched<T>},
             {"asum_strided_batched", testing_asum_strided_batched<T>},
             {"axpy", testing_axpy<T>},
@@ -1190,7 +1208,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
     if(!strncmp(function, prefix, sizeof(prefix) - 1))
         function += sizeof(prefix) - 1;
 
-    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
+    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched")
+       || !strcmp(function, "gemm_tile_split") || !strcmp(function, "gemm_grouped_batched"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -0,0 +1,233 @@
+#!/usr/bin/python3
+"""Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+"""
+
+import sys
+import shlex
+import argparse
+from collections import OrderedDict
+
+# hipblas-bench options and the Arguments fields they set, with the defaults
+# of hipblas-bench for the options a logged command leaves out. A test then
+# runs exactly like the logged command does.
+OPTIONS = OrderedDict([
+    # option         (field,            type,  default)
+    ('-f',           ('function',       str,   None)),
+    ('-r',           ('precision',      str,   'f32_r')),
+    ('--a_type',     ('a_type',         str,   None)),
+    ('--b_type',     ('b_type',         str,   None)),
+    ('--c_type',     ('c_type',         str,   None)),
+    ('--d_type',     ('d_type',         str,   None)),
+    ('--compute_type', ('compute_type', str,   None)),
+    ('-m',           ('M',              int,   128)),
+    ('-n',           ('N',              int,   128)),
+    ('-k',           ('K',              int,   128)),
+    ('--kl',         ('KL',             int,   128)),
+    ('--ku',         ('KU',             int,   128)),
+    ('--lda',        ('lda',            int,   128)),
+    ('--ldb',        ('ldb',            int,   128)),
+    ('--ldc',        ('ldc',            int,   128)),
+    ('--ldd',        ('ldd',            int,   128)),
+    ('--stride_a',   ('stride_a',       int,   128 * 128)),
+    ('--stride_b',   ('stride_b',       int,   128 * 128)),
+    ('--stride_c',   ('stride_c',       int,   128 * 128)),
+    ('--stride_d',   ('stride_d',       int,   128 * 128)),
+    ('--stride_x',   ('stride_x',       int,   128)),
+    ('--stride_y',   ('stride_y',       int,   128)),
+    ('--incx',       ('incx',           int,   1)),
+    ('--incy',       ('incy',           int,   1)),
+    ('--alpha',      ('alpha',          float, 1.0)),
+    ('--alphai',     ('alphai',         float, 0.0)),
+    ('--beta',       ('beta',           float, 0.0)),
+    ('--betai',      ('betai',          float, 0.0)),
+    ('--transposeA', ('transA',         str,   'N')),
+    ('--transposeB', ('transB',         str,   'N')),
+    ('--side',       ('side',           str,   'L')),
+    ('--uplo',       ('uplo',           str,   'U')),
+    ('--diag',       ('diag',           str,   'N')),
+    ('--batch_count', ('batch_count',   int,   1)),
+    ('--group_count', ('group_count',   int,   1)),
+    ('--algo',       ('algo',           int,   0)),
+    ('--solution_index', ('solution_index', int, 0)),
+    ('--flags',      ('flags',          int,   0)),
+    ('--initialization', ('initialization', str, 'hpl')),
+])
+
+ALIASES = {
+    '--function': '-f', '--precision': '-r',
+    '--sizem': '-m', '--sizen': '-n', '--sizek': '-k',
+}
+
+# Options which change how a command is run, not the call it makes
+IGNORED = {'-i': 1, '--iters': 1, '-j': 1, '--cold_iters': 1, '-v': 1,
+           '--verify': 1, '--device': 1, '--parallel_devices': 1,
+           '--log_function_name': 0, '--log_datatype': 0,
+           '--startup_latency': 0}
+
+CHAR_FIELDS = ('transA', 'transB', 'side', 'uplo', 'diag')
+
+warned = set()
+
+
+def parse_args():
+    """Parse command-line arguments"""
+    parser = argparse.ArgumentParser(description="""
+Convert the hipblas-bench commands of a HIPBLAS_LAYER=2 log into YAML tests
+for hipblas-bench --yaml. Identical calls become one test, whose weight is
+the number of times it was logged.
+""")
+    parser.add_argument('infiles',
+                        nargs='*',
+                        type=argparse.FileType('r'),
+                        default=[sys.stdin])
+    parser.add_argument('-o', '--out',
+                        dest='outfile',
+                        type=argparse.FileType('w'),
+                        default=sys.stdout)
+    parser.add_argument('-i', '--iters', type=int, default=10,
+                        help="Iterations to run inside the timing loop")
+    parser.add_argument('-j', '--cold_iters', type=int, default=2,
+                        help="Iterations to run before the timing loop")
+    parser.add_argument('--top', type=int, default=0,
+                        help="Keep only the TOP most frequent calls")
+    return parser.parse_args()
+
+
+def warn(message):
+    if message not in warned:
+        warned.add(message)
+        sys.stderr.write("hipblas_log2yaml: " + message + "\n")
+
+
+def parse_command(words):
+    """Return the Arguments fields of one hipblas-bench command"""
+    test = {}
+    i = 0
+    while i < len(words):
+        word = words[i]
+        value = None
+        if word.startswith('--') and '=' in word:
+            word, value = word.split('=', 1)
+        word = ALIASES.get(word, word)
+        if word in OPTIONS:
+            if value is None:
+                i += 1
+                if i >= len(words):
+                    warn("missing value for " + word)
+                    return None
+                value = words[i]
+            field, kind, _ = OPTIONS[word]
+            try:
+                test[field] = kind(value)
+            except ValueError:
+                warn("invalid value " + value + " for " + word)
+                return None
+        elif word in IGNORED:
+            i += IGNORED[word] if value is None else 0
+        elif word == '--fortran':
+            test['fortran'] = True
+        elif word == '--atomics_not_allowed':
+            test['atomics_mode'] = 'atomics_not_allowed'
+        else:
+            warn("ignoring unknown option " + word)
+        i += 1
+
+    if 'function' not in test:
+        return None
+
+    for field, kind, default in OPTIONS.values():
+        if default is not None:
+            test.setdefault(field, default)
+
+    # -r sets every type the command does not set itself
+    precision = test.pop('precision')
+    for field in ('a_type', 'b_type', 'c_type', 'd_type', 'compute_type'):
+        test.setdefault(field, precision)
+    return test
+
+
+def yaml_value(field, value):
+    """Format a value the way hipblas_gentest.py reads it back"""
+    if field in CHAR_FIELDS:
+        return "'" + value + "'"
+    if isinstance(value, bool):
+        return 'true' if value else 'false'
+    if isinstance(value, float):
+        if value != value:
+            return '.nan'
+        if value in (float('inf'), float('-inf')):
+            return '.inf' if value > 0 else '-.inf'
+        # YAML 1.1 floats need a '.' in the mantissa
+        mantissa, e, exponent = repr(value).partition('e')
+        if '.' not in mantissa:
+            mantissa += '.0'
+        return mantissa + e + exponent
+    return str(value)
+
+
+def main():
+    args = parse_args()
+    counts = OrderedDict()
+    calls = 0
+
+    for file in args.infiles:
+        for line in file:
+            _, found, command = line.partition('hipblas-bench ')
+            if not found:
+                continue
+            try:
+                words = shlex.split(command)
+            except ValueError:
+                warn("cannot parse: " + line.strip())
+                continue
+            test = parse_command(words)
+            if test is None:
+                continue
+            key = tuple(sorted(test.items()))
+            counts[key] = counts.get(key, 0) + 1
+            calls += 1
+
+    # Most frequent calls first; equal counts stay in the order first logged
+    tests = sorted(counts.items(), key=lambda t: -t[1])
+    if args.top > 0:
+        tests = tests[:args.top]
+
+    out = args.outfile
+    out.write("# Generated by hipblas_log2yaml.py from " + str(calls) +
+              " logged calls, " + str(len(counts)) + " distinct\n")
+    out.write("# Run with: hipblas-bench --yaml <this file>\n")
+
+    order = ['function', 'a_type', 'b_type', 'c_type', 'd_type',
+             'compute_type'] + [f for f, _, d in OPTIONS.values()
+                                if d is not None and f != 'precision']
+    for key, count in tests:
+        test = dict(key)
+        test['iters'] = args.iters
+        test['cold_iters'] = args.cold_iters
+        fields = order + sorted(f for f in test
+                                if f not in order and f != 'weight')
+        out.write("- { " + ", ".join(f + ": " + yaml_value(f, test[f])
+                                     for f in fields if f in test) +
+                  ", weight: " + str(count) + " }\n")
+
+
+if __name__ == '__main__':
+    main()
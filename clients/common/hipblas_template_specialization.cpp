@@ -64,6 +64,18 @@ hipblasStatus_t hipblasAxpy<float>(
     return hipblasSaxpy(handle, n, alpha, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasAxpy_64<float>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      float*          y,
+                                      int64_t         incy)
+{
+    return hipblasSaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasAxpy<double>(hipblasHandle_t handle,
                                     int             n,
@@ -76,6 +88,18 @@ hipblasStatus_t hipblasAxpy<double>(hipblasHandle_t handle,
     return hipblasDaxpy(handle, n, alpha, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasAxpy_64<double>(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int64_t         incx,
+                                       double*         y,
+                                       int64_t         incy)
+{
+    return hipblasDaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasAxpy<hipblasComplex>(hipblasHandle_t       handle,
                                             int                   n,
@@ -88,6 +112,18 @@ hipblasStatus_t hipblasAxpy<hipblasComplex>(hipblasHandle_t       handle,
     return hipblasCaxpy(handle, n, alpha, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy)
+{
+    return hipblasCaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasAxpy<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   int                         n,
@@ -100,6 +136,18 @@ hipblasStatus_t hipblasAxpy<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZaxpy(handle, n, alpha, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy)
+{
+    return hipblasZaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
 // axpy_batched
 template <>
 hipblasStatus_t hipblasAxpyBatched<hipblasHalf>(hipblasHandle_t          handle,
@@ -255,6 +303,13 @@ hipblasStatus_t
     return hipblasSscal(handle, n, alpha, x, incx);
 }
 
+template <>
+hipblasStatus_t hipblasScal_64<float>(
+    hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+{
+    return hipblasSscal_64(handle, n, alpha, x, incx);
+}
+
 template <>
 hipblasStatus_t
     hipblasScal<double>(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
@@ -262,6 +317,13 @@ hipblasStatus_t
     return hipblasDscal(handle, n, alpha, x, incx);
 }
 
+template <>
+hipblasStatus_t hipblasScal_64<double>(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+{
+    return hipblasDscal_64(handle, n, alpha, x, incx);
+}
+
 template <>
 hipblasStatus_t hipblasScal<hipblasComplex>(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
@@ -269,6 +331,13 @@ hipblasStatus_t hipblasScal<hipblasComplex>(
     return hipblasCscal(handle, n, alpha, x, incx);
 }
 
+template <>
+hipblasStatus_t hipblasScal_64<hipblasComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+{
+    return hipblasCscal_64(handle, n, alpha, x, incx);
+}
+
 template <>
 hipblasStatus_t hipblasScal<hipblasComplex, float>(
     hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
@@ -276,6 +345,13 @@ hipblasStatus_t hipblasScal<hipblasComplex, float>(
     return hipblasCsscal(handle, n, alpha, x, incx);
 }
 
+template <>
+hipblasStatus_t hipblasScal_64<hipblasComplex, float>(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+{
+    return hipblasCsscal_64(handle, n, alpha, x, incx);
+}
+
 template <>
 hipblasStatus_t hipblasScal<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   int                         n,
@@ -286,6 +362,16 @@ hipblasStatus_t hipblasScal<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZscal(handle, n, alpha, x, incx);
 }
 
+template <>
+hipblasStatus_t hipblasScal_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     hipblasDoubleComplex*       x,
+                                                     int64_t                     incx)
+{
+    return hipblasZscal_64(handle, n, alpha, x, incx);
+}
+
 template <>
 hipblasStatus_t hipblasScal<hipblasDoubleComplex, double>(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
@@ -293,6 +379,13 @@ hipblasStatus_t hipblasScal<hipblasDoubleComplex, double>(
     return hipblasZdscal(handle, n, alpha, x, incx);
 }
 
+template <>
+hipblasStatus_t hipblasScal_64<hipblasDoubleComplex, double>(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+{
+    return hipblasZdscal_64(handle, n, alpha, x, incx);
+}
+
 // scal_batched
 template <>
 hipblasStatus_t hipblasScalBatched<float>(
@@ -437,6 +530,13 @@ hipblasStatus_t
     return hipblasSswap(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasSwap_64<float>(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+{
+    return hipblasSswap_64(handle, n, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t
     hipblasSwap<double>(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
@@ -444,6 +544,13 @@ hipblasStatus_t
     return hipblasDswap(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasSwap_64<double>(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+{
+    return hipblasDswap_64(handle, n, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasSwap<hipblasComplex>(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
@@ -451,6 +558,17 @@ hipblasStatus_t hipblasSwap<hipblasComplex>(
     return hipblasCswap(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasSwap_64<hipblasComplex>(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy)
+{
+    return hipblasCswap_64(handle, n, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasSwap<hipblasDoubleComplex>(hipblasHandle_t       handle,
                                                   int                   n,
@@ -462,6 +580,17 @@ hipblasStatus_t hipblasSwap<hipblasDoubleComplex>(hipblasHandle_t       handle,
     return hipblasZswap(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasSwap_64<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasDoubleComplex* x,
+                                                     int64_t               incx,
+                                                     hipblasDoubleComplex* y,
+                                                     int64_t               incy)
+{
+    return hipblasZswap_64(handle, n, x, incx, y, incy);
+}
+
 // swap_batched
 template <>
 hipblasStatus_t hipblasSwapBatched<float>(
@@ -566,6 +695,13 @@ hipblasStatus_t
     return hipblasScopy(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasCopy_64<float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+{
+    return hipblasScopy_64(handle, n, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasCopy<double>(
     hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
@@ -573,6 +709,13 @@ hipblasStatus_t hipblasCopy<double>(
     return hipblasDcopy(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasCopy_64<double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+{
+    return hipblasDcopy_64(handle, n, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasCopy<hipblasComplex>(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
@@ -580,6 +723,17 @@ hipblasStatus_t hipblasCopy<hipblasComplex>(
     return hipblasCcopy(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasCopy_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy)
+{
+    return hipblasCcopy_64(handle, n, x, incx, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasCopy<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   int                         n,
@@ -591,6 +745,17 @@ hipblasStatus_t hipblasCopy<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZcopy(handle, n, x, incx, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasCopy_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy)
+{
+    return hipblasZcopy_64(handle, n, x, incx, y, incy);
+}
+
 // copy_batched
 template <>
 hipblasStatus_t hipblasCopyBatched<float>(hipblasHandle_t    handle,
@@ -736,6 +901,18 @@ hipblasStatus_t hipblasDot<float>(hipblasHandle_t handle,
     return hipblasSdot(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+hipblasStatus_t hipblasDot_64<float>(hipblasHandle_t handle,
+                                     int64_t         n,
+                                     const float*    x,
+                                     int64_t         incx,
+                                     const float*    y,
+                                     int64_t         incy,
+                                     float*          result)
+{
+    return hipblasSdot_64(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 hipblasStatus_t hipblasDot<double>(hipblasHandle_t handle,
                                    int             n,
@@ -748,6 +925,18 @@ hipblasStatus_t hipblasDot<double>(hipblasHandle_t handle,
     return hipblasDdot(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+hipblasStatus_t hipblasDot_64<double>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         result)
+{
+    return hipblasDdot_64(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 hipblasStatus_t hipblasDot<hipblasComplex>(hipblasHandle_t       handle,
                                            int                   n,
@@ -760,6 +949,18 @@ hipblasStatus_t hipblasDot<hipblasComplex>(hipblasHandle_t       handle,
     return hipblasCdotu(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+hipblasStatus_t hipblasDot_64<hipblasComplex>(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasComplex*       result)
+{
+    return hipblasCdotu_64(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 hipblasStatus_t hipblasDot<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                  int                         n,
@@ -772,6 +973,18 @@ hipblasStatus_t hipblasDot<hipblasDoubleComplex>(hipblasHandle_t             han
     return hipblasZdotu(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+hipblasStatus_t hipblasDot_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    const hipblasDoubleComplex* y,
+                                                    int64_t                     incy,
+                                                    hipblasDoubleComplex*       result)
+{
+    return hipblasZdotu_64(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 hipblasStatus_t hipblasDotc<hipblasComplex>(hipblasHandle_t       handle,
                                             int                   n,
@@ -784,6 +997,18 @@ hipblasStatus_t hipblasDotc<hipblasComplex>(hipblasHandle_t       handle,
     return hipblasCdotc(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+hipblasStatus_t hipblasDotc_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result)
+{
+    return hipblasCdotc_64(handle, n, x, incx, y, incy, result);
+}
+
 template <>
 hipblasStatus_t hipblasDotc<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   int                         n,
@@ -796,6 +1021,18 @@ hipblasStatus_t hipblasDotc<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZdotc(handle, n, x, incx, y, incy, result);
 }
 
+template <>
+hipblasStatus_t hipblasDotc_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasDoubleComplex*       result)
+{
+    return hipblasZdotc_64(handle, n, x, incx, y, incy, result);
+}
+
 // dot_batched
 template <>
 hipblasStatus_t hipblasDotBatched<hipblasHalf>(hipblasHandle_t          handle,
@@ -1039,6 +1276,13 @@ hipblasStatus_t hipblasAsum<float, float>(
     return hipblasSasum(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasAsum_64<float, float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+{
+    return hipblasSasum_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasAsum<double, double>(
     hipblasHandle_t handle, int n, const double* x, int incx, double* result)
@@ -1047,6 +1291,13 @@ hipblasStatus_t hipblasAsum<double, double>(
     return hipblasDasum(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasAsum_64<double, double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+{
+    return hipblasDasum_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasAsum<hipblasComplex, float>(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
@@ -1055,6 +1306,13 @@ hipblasStatus_t hipblasAsum<hipblasComplex, float>(
     return hipblasScasum(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasAsum_64<hipblasComplex, float>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+{
+    return hipblasScasum_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasAsum<hipblasDoubleComplex, double>(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
@@ -1063,6 +1321,13 @@ hipblasStatus_t hipblasAsum<hipblasDoubleComplex, double>(
     return hipblasDzasum(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasAsum_64<hipblasDoubleComplex, double>(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+{
+    return hipblasDzasum_64(handle, n, x, incx, result);
+}
+
 // asum_batched
 template <>
 hipblasStatus_t hipblasAsumBatched<float, float>(
@@ -1172,6 +1437,13 @@ hipblasStatus_t hipblasNrm2<float, float>(
     return hipblasSnrm2(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasNrm2_64<float, float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+{
+    return hipblasSnrm2_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasNrm2<double, double>(
     hipblasHandle_t handle, int n, const double* x, int incx, double* result)
@@ -1180,6 +1452,13 @@ hipblasStatus_t hipblasNrm2<double, double>(
     return hipblasDnrm2(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasNrm2_64<double, double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+{
+    return hipblasDnrm2_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasNrm2<hipblasComplex, float>(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
@@ -1188,6 +1467,13 @@ hipblasStatus_t hipblasNrm2<hipblasComplex, float>(
     return hipblasScnrm2(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasNrm2_64<hipblasComplex, float>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+{
+    return hipblasScnrm2_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasNrm2<hipblasDoubleComplex, double>(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
@@ -1196,6 +1482,13 @@ hipblasStatus_t hipblasNrm2<hipblasDoubleComplex, double>(
     return hipblasDznrm2(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasNrm2_64<hipblasDoubleComplex, double>(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+{
+    return hipblasDznrm2_64(handle, n, x, incx, result);
+}
+
 // nrm2_batched
 template <>
 hipblasStatus_t hipblasNrm2Batched<float, float>(
@@ -1889,6 +2182,13 @@ hipblasStatus_t
     return hipblasIsamax(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamax_64<float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+{
+    return hipblasIsamax_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t
     hipblasIamax<double>(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
@@ -1896,6 +2196,13 @@ hipblasStatus_t
     return hipblasIdamax(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamax_64<double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+{
+    return hipblasIdamax_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasIamax<hipblasComplex>(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
@@ -1903,6 +2210,13 @@ hipblasStatus_t hipblasIamax<hipblasComplex>(
     return hipblasIcamax(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamax_64<hipblasComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIcamax_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasIamax<hipblasDoubleComplex>(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
@@ -1910,6 +2224,13 @@ hipblasStatus_t hipblasIamax<hipblasDoubleComplex>(
     return hipblasIzamax(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamax_64<hipblasDoubleComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIzamax_64(handle, n, x, incx, result);
+}
+
 // amax_batched
 template <>
 hipblasStatus_t hipblasIamaxBatched<float>(
@@ -2004,6 +2325,13 @@ hipblasStatus_t
     return hipblasIsamin(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamin_64<float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+{
+    return hipblasIsamin_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t
     hipblasIamin<double>(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
@@ -2011,6 +2339,13 @@ hipblasStatus_t
     return hipblasIdamin(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamin_64<double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+{
+    return hipblasIdamin_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasIamin<hipblasComplex>(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
@@ -2018,6 +2353,13 @@ hipblasStatus_t hipblasIamin<hipblasComplex>(
     return hipblasIcamin(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamin_64<hipblasComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIcamin_64(handle, n, x, incx, result);
+}
+
 template <>
 hipblasStatus_t hipblasIamin<hipblasDoubleComplex>(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
@@ -2025,6 +2367,13 @@ hipblasStatus_t hipblasIamin<hipblasDoubleComplex>(
     return hipblasIzamin(handle, n, x, incx, result);
 }
 
+template <>
+hipblasStatus_t hipblasIamin_64<hipblasDoubleComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIzamin_64(handle, n, x, incx, result);
+}
+
 // amin_batched
 template <>
 hipblasStatus_t hipblasIaminBatched<float>(
@@ -2458,6 +2807,23 @@ hipblasStatus_t hipblasGemv<float>(hipblasHandle_t    handle,
     return hipblasSgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasGemv_64<float>(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      const float*       x,
+                                      int64_t            incx,
+                                      const float*       beta,
+                                      float*             y,
+                                      int64_t            incy)
+{
+    return hipblasSgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasGemv<double>(hipblasHandle_t    handle,
                                     hipblasOperation_t transA,
@@ -2475,6 +2841,23 @@ hipblasStatus_t hipblasGemv<double>(hipblasHandle_t    handle,
     return hipblasDgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasGemv_64<double>(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      x,
+                                       int64_t            incx,
+                                       const double*      beta,
+                                       double*            y,
+                                       int64_t            incy)
+{
+    return hipblasDgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasGemv<hipblasComplex>(hipblasHandle_t       handle,
                                             hipblasOperation_t    transA,
@@ -2492,6 +2875,23 @@ hipblasStatus_t hipblasGemv<hipblasComplex>(hipblasHandle_t       handle,
     return hipblasCgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasGemv_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy)
+{
+    return hipblasCgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 template <>
 hipblasStatus_t hipblasGemv<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   hipblasOperation_t          transA,
@@ -2509,6 +2909,23 @@ hipblasStatus_t hipblasGemv<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
+template <>
+hipblasStatus_t hipblasGemv_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy)
+{
+    return hipblasZgemv_64(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 // gemv_batched
 template <>
 hipblasStatus_t hipblasGemvBatched<float>(hipblasHandle_t    handle,
@@ -5658,6 +6075,25 @@ hipblasStatus_t hipblasGemm<float>(hipblasHandle_t    handle,
     return hipblasSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+template <>
+hipblasStatus_t hipblasGemm_64<float>(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      const float*       B,
+                                      int64_t            ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int64_t            ldc)
+{
+    return hipblasSgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
 hipblasStatus_t hipblasGemm<double>(hipblasHandle_t    handle,
                                     hipblasOperation_t transA,
@@ -5677,6 +6113,25 @@ hipblasStatus_t hipblasGemm<double>(hipblasHandle_t    handle,
     return hipblasDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+template <>
+hipblasStatus_t hipblasGemm_64<double>(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       const double*      beta,
+                                       double*            C,
+                                       int64_t            ldc)
+{
+    return hipblasDgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
 hipblasStatus_t hipblasGemm<hipblasComplex>(hipblasHandle_t       handle,
                                             hipblasOperation_t    transA,
@@ -5696,6 +6151,25 @@ hipblasStatus_t hipblasGemm<hipblasComplex>(hipblasHandle_t       handle,
     return hipblasCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+template <>
+hipblasStatus_t hipblasGemm_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* B,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc)
+{
+    return hipblasCgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
 hipblasStatus_t hipblasGemm<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   hipblasOperation_t          transA,
@@ -5715,6 +6189,25 @@ hipblasStatus_t hipblasGemm<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+template <>
+hipblasStatus_t hipblasGemm_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     const hipblasDoubleComplex* B,
+                                                     int64_t                     ldb,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int64_t                     ldc)
+{
+    return hipblasZgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 // gemm_batched
 template <>
 hipblasStatus_t hipblasGemmBatched<hipblasHalf>(hipblasHandle_t          handle,
@@ -5904,6 +6397,46 @@ hipblasStatus_t hipblasGemmStridedBatched<float>(hipblasHandle_t    handle,
                                       batch_count);
 }
 
+template <>
+hipblasStatus_t hipblasGemmStridedBatched_64<float>(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const float*       alpha,
+                                                    const float*       A,
+                                                    int64_t            lda,
+                                                    int64_t            bsa,
+                                                    const float*       B,
+                                                    int64_t            ldb,
+                                                    int64_t            bsb,
+                                                    const float*       beta,
+                                                    float*             C,
+                                                    int64_t            ldc,
+                                                    int64_t            bsc,
+                                                    int64_t            batch_count)
+{
+    return hipblasSgemmStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         bsa,
+                                         B,
+                                         ldb,
+                                         bsb,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         bsc,
+                                         batch_count);
+}
+
 template <>
 hipblasStatus_t hipblasGemmStridedBatched<double>(hipblasHandle_t    handle,
                                                   hipblasOperation_t transA,
@@ -5945,6 +6478,46 @@ hipblasStatus_t hipblasGemmStridedBatched<double>(hipblasHandle_t    handle,
                                       batch_count);
 }
 
+template <>
+hipblasStatus_t hipblasGemmStridedBatched_64<double>(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int64_t            lda,
+                                                     int64_t            bsa,
+                                                     const double*      B,
+                                                     int64_t            ldb,
+                                                     int64_t            bsb,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int64_t            ldc,
+                                                     int64_t            bsc,
+                                                     int64_t            batch_count)
+{
+    return hipblasDgemmStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         bsa,
+                                         B,
+                                         ldb,
+                                         bsb,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         bsc,
+                                         batch_count);
+}
+
 template <>
 hipblasStatus_t hipblasGemmStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
                                                           hipblasOperation_t    transA,
@@ -5986,6 +6559,46 @@ hipblasStatus_t hipblasGemmStridedBatched<hipblasComplex>(hipblasHandle_t
                                       batch_count);
 }
 
+template <>
+hipblasStatus_t hipblasGemmStridedBatched_64<hipblasComplex>(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int64_t               lda,
+                                                             int64_t               bsa,
+                                                             const hipblasComplex* B,
+                                                             int64_t               ldb,
+                                                             int64_t               bsb,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       C,
+                                                             int64_t               ldc,
+                                                             int64_t               bsc,
+                                                             int64_t               batch_count)
+{
+    return hipblasCgemmStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         bsa,
+                                         B,
+                                         ldb,
+                                         bsb,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         bsc,
+                                         batch_count);
+}
+
 template <>
 hipblasStatus_t hipblasGemmStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                                 hipblasOperation_t          transA,
@@ -6027,6 +6640,46 @@ hipblasStatus_t hipblasGemmStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
                                       batch_count);
 }
 
+template <>
+hipblasStatus_t hipblasGemmStridedBatched_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                   hipblasOperation_t          transA,
+                                                                   hipblasOperation_t          transB,
+                                                                   int64_t                     m,
+                                                                   int64_t                     n,
+                                                                   int64_t                     k,
+                                                                   const hipblasDoubleComplex* alpha,
+                                                                   const hipblasDoubleComplex* A,
+                                                                   int64_t                     lda,
+                                                                   int64_t                     bsa,
+                                                                   const hipblasDoubleComplex* B,
+                                                                   int64_t                     ldb,
+                                                                   int64_t                     bsb,
+                                                                   const hipblasDoubleComplex* beta,
+                                                                   hipblasDoubleComplex*       C,
+                                                                   int64_t                     ldc,
+                                                                   int64_t                     bsc,
+                                                                   int64_t                     batch_count)
+{
+    return hipblasZgemmStridedBatched_64(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         bsa,
+                                         B,
+                                         ldb,
+                                         bsb,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         bsc,
+                                         batch_count);
+}
+
 // herk
 template <>
 hipblasStatus_t hipblasHerk(hipblasHandle_t       handle,
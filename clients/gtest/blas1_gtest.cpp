@@ -175,7 +175,7 @@ Arguments setup_blas1_arguments(blas1_tuple tup)
 
 // axpy
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 TEST_P(blas1_gtest, axpy_half)
 {
     Arguments       arg    = setup_blas1_arguments(GetParam());
@@ -243,7 +243,7 @@ TEST_P(blas1_gtest, axpy_float_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // axpy_batched
 TEST_P(blas1_gtest, axpy_batched_float)
@@ -398,7 +398,7 @@ TEST_P(blas1_gtest, copy_float_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // copy_batched tests
 TEST_P(blas1_gtest, copy_batched_float)
@@ -588,7 +588,7 @@ TEST_P(blas1_gtest, scal_float_complex_float)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // scal_batched tests
 TEST_P(blas1_gtest, scal_batched_float)
@@ -825,7 +825,7 @@ TEST_P(blas1_gtest, swap_float_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // swap_batched tests
 TEST_P(blas1_gtest, swap_batched_float)
@@ -936,7 +936,7 @@ TEST_P(blas1_gtest, swap_strided_batched_float_complex)
 #endif
 
 // dot tests
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 TEST_P(blas1_gtest, dot_half)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -1082,7 +1082,7 @@ TEST_P(blas1_gtest, dotc_float_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // dot_batched tests
 TEST_P(blas1_gtest, dot_batched_half)
@@ -1469,7 +1469,7 @@ TEST_P(blas1_gtest, nrm2_float_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // nrm2_batched tests
 TEST_P(blas1_gtest, nrm2_batched_float)
@@ -1641,7 +1641,7 @@ TEST_P(blas1_gtest, rot_float_complex_float)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // rot_batched
 TEST_P(blas1_gtest, rot_batched_float)
@@ -1802,7 +1802,7 @@ TEST_P(blas1_gtest, rotg_float_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // rotg_batched
 TEST_P(blas1_gtest, rotg_batched_float)
@@ -1892,7 +1892,7 @@ TEST_P(blas1_gtest, rotm_float)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // rotm_batched
 TEST_P(blas1_gtest, rotm_batched_float)
@@ -1946,7 +1946,7 @@ TEST_P(blas1_gtest, rotmg_float)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // rotmg_batched
 TEST_P(blas1_gtest, rotmg_batched_float)
@@ -2059,7 +2059,7 @@ TEST_P(blas1_gtest, asum_double_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // asum_batched
 TEST_P(blas1_gtest, asum_batched_float)
@@ -2250,7 +2250,7 @@ TEST_P(blas1_gtest, amax_float_complex)
     EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // amax_batched
 TEST_P(blas1_gtest, amax_batched_float)
@@ -2347,7 +2347,7 @@ TEST_P(blas1_gtest, amin_float_complex)
     EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // amin_batched
 TEST_P(blas1_gtest, amin_batched_float)
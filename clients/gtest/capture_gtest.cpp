@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+
+#include "hipblas.h"
+#include <hip/hip_runtime.h>
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <vector>
+
+using std::vector;
+
+/* =====================================================================
+README: This file contains testers for recording a sequence of BLAS calls
+        with hipblasBeginCapture/hipblasEndCapture and replaying it with
+        hipblasCaptureLaunch.
+     =================================================================== */
+
+/* =====================================================================
+     BLAS capture:
+=================================================================== */
+
+namespace
+{
+    const int N        = 1024;
+    const int LAUNCHES = 3;
+
+    void sync_handle(hipblasHandle_t handle)
+    {
+        // hipblasGetStream also pushes out work the library has not flushed yet
+        hipStream_t stream;
+        ASSERT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+    }
+}
+
+TEST(hipblas_capture, replay_matches_direct_calls)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    hipblasStatus_t status = hipblasBeginCapture(handle);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        hipblasDestroy(handle);
+        GTEST_SKIP() << "capture is not supported by this backend";
+    }
+    ASSERT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasEndCapture(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    vector<float> hx(N, 1.0f), hy(N, 0.0f);
+    float *       dx, *dy;
+    ASSERT_EQ(hipMalloc(&dx, N * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, N * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dx, hx.data(), N * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dy, hy.data(), N * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    // x *= 2; y += x. Host scalars are read while recording, so changing them
+    // afterwards must not affect the replays.
+    float two = 2.0f, one = 1.0f;
+    EXPECT_EQ(hipblasSscal(handle, N, &two, dx, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, N, &one, dx, 1, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    two = one = 0.0f;
+
+    hipblasCapture_t capture = nullptr;
+    ASSERT_EQ(hipblasEndCapture(handle, &capture), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_NE(capture, nullptr);
+
+    // recording does not execute anything
+    sync_handle(handle);
+    ASSERT_EQ(hipMemcpy(hy.data(), dy, N * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    for(int i = 0; i < N; i++)
+    {
+        ASSERT_FLOAT_EQ(hy[i], 0.0f);
+    }
+
+    for(int i = 0; i < LAUNCHES; i++)
+    {
+        EXPECT_EQ(hipblasCaptureLaunch(handle, capture), HIPBLAS_STATUS_SUCCESS);
+    }
+    sync_handle(handle);
+
+    // after k replays x = 2^k and y = 2 + 4 + ... + 2^k
+    float x = 1.0f, y = 0.0f;
+    for(int i = 0; i < LAUNCHES; i++)
+    {
+        x *= 2.0f;
+        y += x;
+    }
+    ASSERT_EQ(hipMemcpy(hx.data(), dx, N * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    ASSERT_EQ(hipMemcpy(hy.data(), dy, N * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    for(int i = 0; i < N; i++)
+    {
+        ASSERT_FLOAT_EQ(hx[i], x);
+        ASSERT_FLOAT_EQ(hy[i], y);
+    }
+
+    EXPECT_EQ(hipblasCaptureDestroy(capture), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipFree(dx), hipSuccess);
+    ASSERT_EQ(hipFree(dy), hipSuccess);
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_capture, invalid_sequences)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    hipblasCapture_t capture = nullptr;
+    hipblasStatus_t  status  = hipblasEndCapture(handle, &capture);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        hipblasDestroy(handle);
+        GTEST_SKIP() << "capture is not supported by this backend";
+    }
+    // not recording
+    EXPECT_EQ(status, HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBeginCapture(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasCaptureLaunch(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasCaptureDestroy(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipStream_t stream;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+
+    ASSERT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // a host pointer mode reduction has to wait for its result
+    float* dx;
+    float  result = 0.0f;
+    ASSERT_EQ(hipMalloc(&dx, N * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NE(hipblasSasum(handle, N, dx, 1, &result), HIPBLAS_STATUS_SUCCESS);
+
+    ASSERT_EQ(hipblasEndCapture(handle, &capture), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasCaptureDestroy(capture), HIPBLAS_STATUS_SUCCESS);
+
+    // the handle is usable again
+    EXPECT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_SUCCESS);
+
+    ASSERT_EQ(hipFree(dx), hipSuccess);
+    hipblasDestroy(handle);
+    hipStreamDestroy(stream);
+}
@@ -61,6 +61,7 @@ Representative sampling is sufficient, endless brute-force sampling is not neces
 // add/delete as a group
 const vector<vector<int>> matrix_size_range = {
     {-1, -1, -1, -1, -1}, {128, 128, 150, 2, 150}, {1000, 1000, 1000, 2, 1000},
+    {128, 128, 150, -1, 150}, {33, 33, 40, -2, 40},
 
     // TODO: rocBLAS dgmm is currently broken when (M != N && incx < 0 && side == L)
     // {128, 130, 150, -1, 150},
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_grouped_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, int, int> gemm_grouped_batched_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// M is the row count of the last group, the other groups have fewer rows
+const vector<vector<int>> matrix_size_range = {
+    {10, 10, 10, 10, 10, 10},
+    {33, 32, 31, 100, 100, 100},
+    {128, 64, 96, 128, 128, 128},
+};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+const vector<vector<double>> alpha_beta_range = {
+    {1.0, 0.0, 0.0, 0.0},
+    {-1.0, 0.0, 2.0, 0.0},
+};
+
+// vector of vector, each pair is a {transA, transB};
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}};
+
+// number of gemms in every group
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+// number of groups
+const vector<int> group_count_range = {-1, 0, 1, 4};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 gemm_grouped_batched:
+=================================================================== */
+
+Arguments setup_gemm_grouped_batched_arguments(gemm_grouped_batched_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+    int            batch_count   = std::get<3>(tup);
+    int            group_count   = std::get<4>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.batch_count = batch_count;
+    arg.group_count = group_count;
+    arg.timing      = 0;
+
+    return arg;
+}
+
+class gemm_grouped_batched_gtest : public ::TestWithParam<gemm_grouped_batched_tuple>
+{
+protected:
+    gemm_grouped_batched_gtest() {}
+    virtual ~gemm_grouped_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+template <typename T>
+void run_gemm_grouped_batched(const Arguments& arg)
+{
+    hipblasStatus_t status = testing_gemm_grouped_batched<T>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.group_count < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_grouped_batched_gtest, float)
+{
+    run_gemm_grouped_batched<float>(setup_gemm_grouped_batched_arguments(GetParam()));
+}
+
+TEST_P(gemm_grouped_batched_gtest, double)
+{
+    run_gemm_grouped_batched<double>(setup_gemm_grouped_batched_arguments(GetParam()));
+}
+
+// The combinations are  { {M, N, K, lda, ldb, ldc}, {alpha, beta}, {transA, transB},
+// {batch_count}, {group_count} }
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmGroupedBatched,
+                         gemm_grouped_batched_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(batch_count_range),
+                                 ValuesIn(group_count_range)));
@@ -0,0 +1,397 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <climits>
+#include <hip/hip_runtime.h>
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <vector>
+
+using std::vector;
+
+/* =====================================================================
+README: This file contains testers for the _64 functions: with small sizes
+        they must give the results of the 32-bit functions, and with more
+        than 2^31 elements they must reach the whole vector.
+     =================================================================== */
+
+/* =====================================================================
+     ILP64:
+=================================================================== */
+
+namespace
+{
+    const int N = 1000;
+
+    void sync_handle(hipblasHandle_t handle)
+    {
+        hipStream_t stream;
+        ASSERT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+    }
+
+    void fill(vector<float>& v, int shift)
+    {
+        for(size_t i = 0; i < v.size(); i++)
+            v[i] = float(int((i + shift) % 7) - 3);
+    }
+
+    float* to_device(const vector<float>& v)
+    {
+        float* d = nullptr;
+        EXPECT_EQ(hipMalloc(&d, v.size() * sizeof(float)), hipSuccess);
+        EXPECT_EQ(hipMemcpy(d, v.data(), v.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        return d;
+    }
+
+    vector<float> to_host(const float* d, size_t size)
+    {
+        vector<float> v(size);
+        EXPECT_EQ(hipMemcpy(v.data(), d, size * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+        return v;
+    }
+
+    float element(const float* d, int64_t i)
+    {
+        float v = 0.0f;
+        EXPECT_EQ(hipMemcpy(&v, d + i, sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+        return v;
+    }
+}
+
+TEST(hipblas_ilp64, level1_matches_32_bit)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> hx(2 * N), hy(N);
+    fill(hx, 0);
+    fill(hy, 3);
+    float* dx   = to_device(hx);
+    float* dy   = to_device(hy);
+    float* dy64 = to_device(hy);
+
+    // axpy with a negative increment
+    float alpha = 2.0f;
+    EXPECT_EQ(hipblasSaxpy(handle, N, &alpha, dx, -2, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy_64(handle, N, &alpha, dx, -2, dy64, 1), HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dy, N), to_host(dy64, N));
+
+    float dot = 0.0f, dot64 = 1.0f, nrm2 = 0.0f, nrm264 = 1.0f;
+    EXPECT_EQ(hipblasSdot(handle, N, dx, 2, dy, 1, &dot), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSdot_64(handle, N, dx, 2, dy, 1, &dot64), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_FLOAT_EQ(dot, dot64);
+    EXPECT_EQ(hipblasSnrm2(handle, N, dx, 1, &nrm2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSnrm2_64(handle, N, dx, 1, &nrm264), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_FLOAT_EQ(nrm2, nrm264);
+
+    int     amax   = 0;
+    int64_t amax64 = 0;
+    EXPECT_EQ(hipblasIsamax(handle, N, dy, 1, &amax), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasIsamax_64(handle, N, dy, 1, &amax64), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(amax64, int64_t(amax));
+
+    // device pointer mode results
+    float* d_result;
+    ASSERT_EQ(hipMalloc(&d_result, sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSdot_64(handle, N, dx, 2, dy, 1, d_result), HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_FLOAT_EQ(element(d_result, 0), dot);
+
+    ASSERT_EQ(hipFree(d_result), hipSuccess);
+    ASSERT_EQ(hipFree(dx), hipSuccess);
+    ASSERT_EQ(hipFree(dy), hipSuccess);
+    ASSERT_EQ(hipFree(dy64), hipSuccess);
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_ilp64, level2_level3_match_32_bit)
+{
+    const int M = 67, K = 45, L = 33, batch = 3;
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> hA(M * K * batch), hB(K * L * batch), hC(M * L * batch);
+    fill(hA, 0);
+    fill(hB, 3);
+    fill(hC, 5);
+    float* dA    = to_device(hA);
+    float* dB    = to_device(hB);
+    float* dC    = to_device(hC);
+    float* dC64  = to_device(hC);
+    float  alpha = 2.0f, beta = -1.0f;
+
+    EXPECT_EQ(hipblasSgemv(handle, HIPBLAS_OP_T, M, K, &alpha, dA, M, dC, 1, &beta, dB, 1),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSgemv_64(handle, HIPBLAS_OP_T, M, K, &alpha, dA, M, dC, 1, &beta, dB + K, 1),
+              HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dB, K), to_host(dB + K, K));
+
+    ASSERT_EQ(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice),
+              hipSuccess);
+    EXPECT_EQ(hipblasSgemm(
+                  handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, L, K, &alpha, dA, M, dB, K, &beta, dC, M),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSgemm_64(handle,
+                              HIPBLAS_OP_N,
+                              HIPBLAS_OP_N,
+                              M,
+                              L,
+                              K,
+                              &alpha,
+                              dA,
+                              M,
+                              dB,
+                              K,
+                              &beta,
+                              dC64,
+                              M),
+              HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dC, M * L), to_host(dC64, M * L));
+
+    EXPECT_EQ(hipblasSgemmStridedBatched(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_T,
+                                         M,
+                                         L,
+                                         K,
+                                         &alpha,
+                                         dA,
+                                         M,
+                                         M * K,
+                                         dB,
+                                         L,
+                                         K * L,
+                                         &beta,
+                                         dC,
+                                         M,
+                                         M * L,
+                                         batch),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSgemmStridedBatched_64(handle,
+                                            HIPBLAS_OP_N,
+                                            HIPBLAS_OP_T,
+                                            M,
+                                            L,
+                                            K,
+                                            &alpha,
+                                            dA,
+                                            M,
+                                            M * K,
+                                            dB,
+                                            L,
+                                            K * L,
+                                            &beta,
+                                            dC64,
+                                            M,
+                                            M * L,
+                                            batch),
+              HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dC, hC.size()), to_host(dC64, hC.size()));
+
+    ASSERT_EQ(hipFree(dA), hipSuccess);
+    ASSERT_EQ(hipFree(dB), hipSuccess);
+    ASSERT_EQ(hipFree(dC), hipSuccess);
+    ASSERT_EQ(hipFree(dC64), hipSuccess);
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_ilp64, other_families_match_32_bit)
+{
+    const int M = 67, K = 45, T = 6, batch = 3;
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> hx(M), hy(K), hA(M * K), hC(K * K);
+    fill(hx, 0);
+    fill(hy, 3);
+    fill(hA, 5);
+    fill(hC, 1);
+    float* dx    = to_device(hx);
+    float* dy    = to_device(hy);
+    float* dx64  = to_device(hx);
+    float* dy64  = to_device(hy);
+    float* dA    = to_device(hA);
+    float* dA64  = to_device(hA);
+    float* dC    = to_device(hC);
+    float* dC64  = to_device(hC);
+    float  alpha = 2.0f, beta = -1.0f, c = 0.6f, s = 0.8f;
+
+    // rot
+    EXPECT_EQ(hipblasSrot(handle, K, dx, 1, dy, 1, &c, &s), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSrot_64(handle, K, dx64, 1, dy64, 1, &c, &s), HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dx, M), to_host(dx64, M));
+    EXPECT_EQ(to_host(dy, K), to_host(dy64, K));
+
+    // ger
+    EXPECT_EQ(hipblasSger(handle, M, K, &alpha, dx, 1, dy, 1, dA, M), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSger_64(handle, M, K, &alpha, dx, 1, dy, 1, dA64, M), HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dA, hA.size()), to_host(dA64, hA.size()));
+
+    // syrk, writing the upper triangle of C
+    EXPECT_EQ(hipblasSsyrk(
+                  handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_T, K, M, &alpha, dA, M, &beta, dC, K),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSsyrk_64(handle,
+                              HIPBLAS_FILL_MODE_UPPER,
+                              HIPBLAS_OP_T,
+                              K,
+                              M,
+                              &alpha,
+                              dA64,
+                              M,
+                              &beta,
+                              dC64,
+                              K),
+              HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dC, hC.size()), to_host(dC64, hC.size()));
+
+    // trsm with a small unit triangular matrix, so the solution stays finite
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+              hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA64, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+              hipSuccess);
+    EXPECT_EQ(hipblasStrsm(handle,
+                           HIPBLAS_SIDE_LEFT,
+                           HIPBLAS_FILL_MODE_LOWER,
+                           HIPBLAS_OP_N,
+                           HIPBLAS_DIAG_UNIT,
+                           T,
+                           K,
+                           &alpha,
+                           dx,
+                           T,
+                           dA,
+                           T),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasStrsm_64(handle,
+                              HIPBLAS_SIDE_LEFT,
+                              HIPBLAS_FILL_MODE_LOWER,
+                              HIPBLAS_OP_N,
+                              HIPBLAS_DIAG_UNIT,
+                              T,
+                              K,
+                              &alpha,
+                              dx,
+                              T,
+                              dA64,
+                              T),
+              HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    EXPECT_EQ(to_host(dA, T * K), to_host(dA64, T * K));
+
+    // strided batched amax, with the host results in int and int64_t
+    vector<int>     amax(batch);
+    vector<int64_t> amax64(batch);
+    EXPECT_EQ(hipblasIsamaxStridedBatched(handle, T, dA, 1, T, batch, amax.data()),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasIsamaxStridedBatched_64(handle, T, dA, 1, T, batch, amax64.data()),
+              HIPBLAS_STATUS_SUCCESS);
+    for(int b = 0; b < batch; b++)
+        EXPECT_EQ(amax64[b], int64_t(amax[b]));
+
+    ASSERT_EQ(hipFree(dx), hipSuccess);
+    ASSERT_EQ(hipFree(dy), hipSuccess);
+    ASSERT_EQ(hipFree(dx64), hipSuccess);
+    ASSERT_EQ(hipFree(dy64), hipSuccess);
+    ASSERT_EQ(hipFree(dA), hipSuccess);
+    ASSERT_EQ(hipFree(dA64), hipSuccess);
+    ASSERT_EQ(hipFree(dC), hipSuccess);
+    ASSERT_EQ(hipFree(dC64), hipSuccess);
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_ilp64, vectors_longer_than_int_max)
+{
+    const int64_t n     = (int64_t(1) << 31) + 256;
+    const size_t  bytes = size_t(n) * sizeof(float);
+
+    size_t free_bytes = 0, total_bytes = 0;
+    ASSERT_EQ(hipMemGetInfo(&free_bytes, &total_bytes), hipSuccess);
+    if(free_bytes < 2 * bytes + (size_t(256) << 20))
+        GTEST_SKIP() << "needs " << (2 * bytes >> 20) << " MiB of device memory";
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    float *dx, *dy, *dA;
+    ASSERT_EQ(hipMalloc(&dx, bytes), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, bytes), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float)), hipSuccess);
+    // x = 1, y = 0
+    ASSERT_EQ(hipMemsetD32(hipDeviceptr_t(dx), 0x3F800000, n), hipSuccess);
+    ASSERT_EQ(hipMemset(dy, 0, bytes), hipSuccess);
+
+    const int64_t probes[] = {0, INT_MAX - 1, INT_MAX, int64_t(INT_MAX) + 1, n - 1};
+
+    // y = 2 x
+    float alpha = 2.0f;
+    EXPECT_EQ(hipblasSaxpy_64(handle, n, &alpha, dx, 1, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    for(int64_t i : probes)
+        EXPECT_FLOAT_EQ(element(dy, i), 2.0f) << "at " << i;
+
+    float dot = 0.0f;
+    EXPECT_EQ(hipblasSdot_64(handle, n, dx, 1, dy, 1, &dot), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NEAR(dot, 2.0 * n, 2.0 * n * 1e-4);
+
+    // a single 3 past INT_MAX
+    float   three = 3.0f;
+    int64_t amax  = 0;
+    ASSERT_EQ(hipMemcpy(dy + n - 3, &three, sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    EXPECT_EQ(hipblasIsamax_64(handle, n, dy, 1, &amax), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(amax, n - 2);
+
+    // a 1 x n product: y = 3 x + y
+    float one = 1.0f;
+    ASSERT_EQ(hipMemcpy(dA, &three, sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    EXPECT_EQ(hipblasSgemm_64(
+                  handle, HIPBLAS_OP_N, HIPBLAS_OP_N, 1, n, 1, &one, dA, 1, dx, 1, &one, dy, 1),
+              HIPBLAS_STATUS_SUCCESS);
+    sync_handle(handle);
+    for(int64_t i : probes)
+        EXPECT_FLOAT_EQ(element(dy, i), 5.0f) << "at " << i;
+    EXPECT_FLOAT_EQ(element(dy, n - 3), 6.0f);
+
+    ASSERT_EQ(hipFree(dx), hipSuccess);
+    ASSERT_EQ(hipFree(dy), hipSuccess);
+    ASSERT_EQ(hipFree(dA), hipSuccess);
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <hip/hip_runtime.h>
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using std::vector;
+
+/* =====================================================================
+README: This file contains testers to verify that BLAS routines are
+        enqueued on the handle's stream without blocking the host.
+     =================================================================== */
+
+/* =====================================================================
+     BLAS stream asynchrony:
+=================================================================== */
+
+namespace
+{
+    const int N     = 1 << 20;
+    const int CALLS = 500;
+
+    // Holds the stream until the test releases it, so that the work queued
+    // behind it is provably still pending. A call that wrongly waits for the
+    // stream would deadlock, the timeout turns that into a failure instead.
+    struct stream_gate
+    {
+        std::atomic<bool> released{false};
+        std::atomic<bool> timed_out{false};
+    };
+
+    void wait_for_release(void* data)
+    {
+        auto* gate     = static_cast<stream_gate*>(data);
+        auto  deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while(!gate->released.load())
+        {
+            if(std::chrono::steady_clock::now() > deadline)
+            {
+                gate->timed_out = true;
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+TEST(hipblas_stream_async, dependent_calls_do_not_block_host)
+{
+    hipStream_t stream;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> hx(N, 1.0f), hy(N, 0.0f);
+    float *       dx, *dy;
+    ASSERT_EQ(hipMalloc(&dx, N * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, N * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dx, hx.data(), N * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dy, hy.data(), N * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    stream_gate gate;
+    ASSERT_EQ(hipLaunchHostFunc(stream, wait_for_release, &gate), hipSuccess);
+
+    // Every call reads the y written by the previous one, so the chain only
+    // produces the right answer if the calls are stream-ordered.
+    const float alpha = 1.0f;
+    for(int i = 0; i < CALLS; i++)
+    {
+        EXPECT_EQ(hipblasSaxpy(handle, N, &alpha, dx, 1, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    // The host got here while the gate still holds the stream, so none of the
+    // calls waited for the device.
+    EXPECT_EQ(hipStreamQuery(stream), hipErrorNotReady);
+    gate.released = true;
+
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+    EXPECT_FALSE(gate.timed_out.load());
+    EXPECT_EQ(hipStreamQuery(stream), hipSuccess);
+
+    ASSERT_EQ(hipMemcpy(hy.data(), dy, N * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    for(int i = 0; i < N; i++)
+    {
+        ASSERT_FLOAT_EQ(hy[i], float(CALLS));
+    }
+
+    // A host-pointer-mode reduction is the one place that has to block, and it
+    // must observe the whole chain queued before it.
+    float result = 0.0f;
+    for(int i = 0; i < CALLS; i++)
+    {
+        EXPECT_EQ(hipblasSaxpy(handle, N, &alpha, dx, 1, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(hipblasSasum(handle, N, dy, 1, &result), HIPBLAS_STATUS_SUCCESS);
+    const float expected = float(N) * float(2 * CALLS);
+    EXPECT_NEAR(result, expected, expected * 1e-5f);
+
+    ASSERT_EQ(hipFree(dx), hipSuccess);
+    ASSERT_EQ(hipFree(dy), hipSuccess);
+    hipblasDestroy(handle);
+    hipStreamDestroy(stream);
+}
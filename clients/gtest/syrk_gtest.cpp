@@ -196,7 +196,7 @@ TEST_P(blas3_syrk_gtest, syrk_gtest_double_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 // syrk_batched
 TEST_P(blas3_syrk_gtest, syrk_batched_gtest_float)
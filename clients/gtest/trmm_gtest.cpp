@@ -232,7 +232,7 @@ TEST_P(trmm_gtest, trmm_gtest_double_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 TEST_P(trmm_gtest, trmm_batched_gtest_float)
 {
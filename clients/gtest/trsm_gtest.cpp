@@ -238,7 +238,7 @@ TEST_P(trsm_gtest, trsm_gtest_double_complex)
     }
 }
 
-#if !defined(__HIP_PLATFORM_NVCC__) && !defined(__HIP_PLATFORM_ONEAPI__)
+#ifndef __HIP_PLATFORM_NVCC__
 
 TEST_P(trsm_gtest, trsm_batched_gtest_float)
 {
@@ -41,6 +41,11 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// time per call of the last test logged with timing, for the weighted
+// aggregate of a data file run
+void   ArgumentModel_set_last_call_us(double us);
+double ArgumentModel_get_last_call_us();
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblas_argument... Args>
 class ArgumentModel
@@ -84,6 +89,7 @@ public:
         if(val_line.rdbuf()->in_avail())
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
+        ArgumentModel_set_last_call_us(gpu_us / hot_calls);
 
         if(arg.unit_check || arg.norm_check)
         {
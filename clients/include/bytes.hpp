@@ -68,7 +68,7 @@ constexpr double asum_gbyte_count(int n)
 
 /* \brief byte counts of AXPY */
 template <typename T>
-constexpr double axpy_gbyte_count(int n)
+constexpr double axpy_gbyte_count(int64_t n)
 {
     return (sizeof(T) * 3.0 * n) / 1e9;
 }
@@ -82,14 +82,14 @@ constexpr double copy_gbyte_count(int n)
 
 /* \brief byte counts of DOT */
 template <typename T>
-constexpr double dot_gbyte_count(int n)
+constexpr double dot_gbyte_count(int64_t n)
 {
     return (sizeof(T) * 2.0 * n) / 1e9;
 }
 
 /* \brief byte counts of iamax/iamin */
 template <typename T>
-constexpr double iamax_gbyte_count(int n)
+constexpr double iamax_gbyte_count(int64_t n)
 {
     return (sizeof(T) * 2.0 * n) / 1e9;
 }
@@ -332,11 +332,22 @@ constexpr double trsv_gbyte_count(int n)
 
 /* \brief byte counts of GEMM */
 template <typename T>
-constexpr double gemm_gbyte_count(int m, int n, int k)
+constexpr double gemm_gbyte_count(int64_t m, int64_t n, int64_t k)
 {
     return (sizeof(T) * (m * k + n * k + m * n)) / 1e9;
 }
 
+/* \brief byte counts of GEMM_GROUPED_BATCHED */
+template <typename T>
+constexpr double gemm_grouped_batched_gbyte_count(
+    int group_count, const int* m, const int* n, const int* k, const int* group_size)
+{
+    double gbytes = 0.0;
+    for(int i = 0; i < group_count; i++)
+        gbytes += gemm_gbyte_count<T>(m[i], n[i], k[i]) * group_size[i];
+    return gbytes;
+}
+
 /* \brief byte counts of TRMM */
 template <typename T>
 constexpr double trmm_gbyte_count(int m, int n, int k)
@@ -62,17 +62,17 @@ constexpr double asum_gflop_count<hipblasDoubleComplex>(int n)
 
 // axpy
 template <typename T>
-constexpr double axpy_gflop_count(int n)
+constexpr double axpy_gflop_count(int64_t n)
 {
     return (2.0 * n) / 1e9;
 }
 template <>
-constexpr double axpy_gflop_count<hipblasComplex>(int n)
+constexpr double axpy_gflop_count<hipblasComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9; // 6 for complex-complex multiply, 2 for c-c add
 }
 template <>
-constexpr double axpy_gflop_count<hipblasDoubleComplex>(int n)
+constexpr double axpy_gflop_count<hipblasDoubleComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9;
 }
@@ -86,34 +86,34 @@ constexpr double copy_gflop_count(int n)
 
 // dot
 template <bool CONJ, typename T>
-constexpr double dot_gflop_count(int n)
+constexpr double dot_gflop_count(int64_t n)
 {
     return (2.0 * n) / 1e9;
 }
 template <>
-constexpr double dot_gflop_count<false, hipblasComplex>(int n)
+constexpr double dot_gflop_count<false, hipblasComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9; // 6 for each c-c multiply, 2 for each c-c add
 }
 template <>
-constexpr double dot_gflop_count<false, hipblasDoubleComplex>(int n)
+constexpr double dot_gflop_count<false, hipblasDoubleComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9;
 }
 template <>
-constexpr double dot_gflop_count<true, hipblasComplex>(int n)
+constexpr double dot_gflop_count<true, hipblasComplex>(int64_t n)
 {
     return (9.0 * n) / 1e9; // regular dot (8n) + 1n for complex conjugate
 }
 template <>
-constexpr double dot_gflop_count<true, hipblasDoubleComplex>(int n)
+constexpr double dot_gflop_count<true, hipblasDoubleComplex>(int64_t n)
 {
     return (9.0 * n) / 1e9;
 }
 
 // iamax/iamin
 template <typename T>
-constexpr double iamax_gflop_count(int n)
+constexpr double iamax_gflop_count(int64_t n)
 {
     return (1.0 * n) / 1e9;
 }
@@ -580,23 +580,34 @@ constexpr double syr2_gflop_count<hipblasDoubleComplex>(int n)
 
 /* \brief floating point counts of GEMM */
 template <typename T>
-constexpr double gemm_gflop_count(int m, int n, int k)
+constexpr double gemm_gflop_count(int64_t m, int64_t n, int64_t k)
 {
     return (2.0 * m * n * k) / 1e9;
 }
 
 template <>
-constexpr double gemm_gflop_count<hipblasComplex>(int m, int n, int k)
+constexpr double gemm_gflop_count<hipblasComplex>(int64_t m, int64_t n, int64_t k)
 {
     return (8.0 * m * n * k) / 1e9;
 }
 
 template <>
-constexpr double gemm_gflop_count<hipblasDoubleComplex>(int m, int n, int k)
+constexpr double gemm_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n, int64_t k)
 {
     return (8.0 * m * n * k) / 1e9;
 }
 
+/* \brief floating point counts of GEMM_GROUPED_BATCHED, the group_size[i] gemms of every group */
+template <typename T>
+constexpr double gemm_grouped_batched_gflop_count(
+    int group_count, const int* m, const int* n, const int* k, const int* group_size)
+{
+    double gflops = 0.0;
+    for(int i = 0; i < group_count; i++)
+        gflops += gemm_gflop_count<T>(m[i], n[i], k[i]) * group_size[i];
+    return gflops;
+}
+
 /* \brief floating point counts of GEAM */
 template <typename T>
 constexpr double geam_gflop_count(int m, int n)
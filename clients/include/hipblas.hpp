@@ -45,6 +45,10 @@
 template <typename T, typename U = T, bool FORTRAN = false>
 hipblasStatus_t hipblasScal(hipblasHandle_t handle, int n, const U* alpha, T* x, int incx);
 
+template <typename T, typename U = T>
+hipblasStatus_t
+    hipblasScal_64(hipblasHandle_t handle, int64_t n, const U* alpha, T* x, int64_t incx);
+
 template <typename T, typename U = T, bool FORTRAN = false>
 hipblasStatus_t hipblasScalBatched(
     hipblasHandle_t handle, int n, const U* alpha, T* const x[], int incx, int batch_count);
@@ -61,6 +65,10 @@ hipblasStatus_t hipblasScalStridedBatched(hipblasHandle_t handle,
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasCopy(hipblasHandle_t handle, int n, const T* x, int incx, T* y, int incy);
 
+template <typename T>
+hipblasStatus_t
+    hipblasCopy_64(hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, T* y, int64_t incy);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasCopyBatched(hipblasHandle_t handle,
                                    int             n,
@@ -84,6 +92,10 @@ hipblasStatus_t hipblasCopyStridedBatched(hipblasHandle_t handle,
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasSwap(hipblasHandle_t handle, int n, T* x, int incx, T* y, int incy);
 
+template <typename T>
+hipblasStatus_t
+    hipblasSwap_64(hipblasHandle_t handle, int64_t n, T* x, int64_t incx, T* y, int64_t incy);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasSwapBatched(
     hipblasHandle_t handle, int n, T* x[], int incx, T* y[], int incy, int batch_count);
@@ -103,10 +115,28 @@ template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDot(
     hipblasHandle_t handle, int n, const T* x, int incx, const T* y, int incy, T* result);
 
+template <typename T>
+hipblasStatus_t hipblasDot_64(hipblasHandle_t handle,
+                              int64_t         n,
+                              const T*        x,
+                              int64_t         incx,
+                              const T*        y,
+                              int64_t         incy,
+                              T*              result);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDotc(
     hipblasHandle_t handle, int n, const T* x, int incx, const T* y, int incy, T* result);
 
+template <typename T>
+hipblasStatus_t hipblasDotc_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        x,
+                               int64_t         incx,
+                               const T*        y,
+                               int64_t         incy,
+                               T*              result);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDotBatched(hipblasHandle_t handle,
                                   int             n,
@@ -154,6 +184,10 @@ hipblasStatus_t hipblasDotcStridedBatched(hipblasHandle_t handle,
 template <typename T1, typename T2, bool FORTRAN = false>
 hipblasStatus_t hipblasAsum(hipblasHandle_t handle, int n, const T1* x, int incx, T2* result);
 
+template <typename T1, typename T2>
+hipblasStatus_t
+    hipblasAsum_64(hipblasHandle_t handle, int64_t n, const T1* x, int64_t incx, T2* result);
+
 template <typename T1, typename T2, bool FORTRAN = false>
 hipblasStatus_t hipblasAsumBatched(
     hipblasHandle_t handle, int n, const T1* const x[], int incx, int batch_count, T2* result);
@@ -170,6 +204,10 @@ hipblasStatus_t hipblasAsumStridedBatched(hipblasHandle_t handle,
 template <typename T1, typename T2, bool FORTRAN = false>
 hipblasStatus_t hipblasNrm2(hipblasHandle_t handle, int n, const T1* x, int incx, T2* result);
 
+template <typename T1, typename T2>
+hipblasStatus_t
+    hipblasNrm2_64(hipblasHandle_t handle, int64_t n, const T1* x, int64_t incx, T2* result);
+
 template <typename T1, typename T2, bool FORTRAN = false>
 hipblasStatus_t hipblasNrm2Batched(
     hipblasHandle_t handle, int n, const T1* const x[], int incx, int batch_count, T2* result);
@@ -290,6 +328,10 @@ hipblasStatus_t hipblasRotmgStridedBatched(hipblasHandle_t handle,
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasIamax(hipblasHandle_t handle, int n, const T* x, int incx, int* result);
 
+template <typename T>
+hipblasStatus_t
+    hipblasIamax_64(hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasIamaxBatched(
     hipblasHandle_t handle, int n, const T* const x[], int incx, int batch_count, int* result);
@@ -306,6 +348,10 @@ hipblasStatus_t hipblasIamaxStridedBatched(hipblasHandle_t handle,
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasIamin(hipblasHandle_t handle, int n, const T* x, int incx, int* result);
 
+template <typename T>
+hipblasStatus_t
+    hipblasIamin_64(hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasIaminBatched(
     hipblasHandle_t handle, int n, const T* const x[], int incx, int batch_count, int* result);
@@ -323,6 +369,15 @@ template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasAxpy(
     hipblasHandle_t handle, int n, const T* alpha, const T* x, int incx, T* y, int incy);
 
+template <typename T>
+hipblasStatus_t hipblasAxpy_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        alpha,
+                               const T*        x,
+                               int64_t         incx,
+                               T*              y,
+                               int64_t         incy);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasAxpyBatched(hipblasHandle_t handle,
                                    int             n,
@@ -1251,6 +1306,20 @@ hipblasStatus_t hipblasGemv(hipblasHandle_t    handle,
                             T*                 y,
                             int                incy);
 
+template <typename T>
+hipblasStatus_t hipblasGemv_64(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               int64_t            m,
+                               int64_t            n,
+                               const T*           alpha,
+                               const T*           A,
+                               int64_t            lda,
+                               const T*           x,
+                               int64_t            incx,
+                               const T*           beta,
+                               T*                 y,
+                               int64_t            incy);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGemvBatched(hipblasHandle_t    handle,
                                    hipblasOperation_t transA,
@@ -1300,6 +1369,22 @@ hipblasStatus_t hipblasGemm(hipblasHandle_t    handle,
                             T*                 C,
                             int                ldc);
 
+template <typename T>
+hipblasStatus_t hipblasGemm_64(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int64_t            m,
+                               int64_t            n,
+                               int64_t            k,
+                               const T*           alpha,
+                               const T*           A,
+                               int64_t            lda,
+                               const T*           B,
+                               int64_t            ldb,
+                               const T*           beta,
+                               T*                 C,
+                               int64_t            ldc);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGemmStridedBatched(hipblasHandle_t    handle,
                                           hipblasOperation_t transA,
@@ -1320,6 +1405,26 @@ hipblasStatus_t hipblasGemmStridedBatched(hipblasHandle_t    handle,
                                           int                bsc,
                                           int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasGemmStridedBatched_64(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             int64_t            k,
+                                             const T*           alpha,
+                                             const T*           A,
+                                             int64_t            lda,
+                                             int64_t            bsa,
+                                             const T*           B,
+                                             int64_t            ldb,
+                                             int64_t            bsb,
+                                             const T*           beta,
+                                             T*                 C,
+                                             int64_t            ldc,
+                                             int64_t            bsc,
+                                             int64_t            batch_count);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGemmBatched(hipblasHandle_t    handle,
                                    hipblasOperation_t transA,
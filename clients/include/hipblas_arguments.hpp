@@ -71,11 +71,12 @@ struct Arguments
 {
     // if you add or reorder members you must update FOR_EACH_ARGUMENT macro
 
-    int M  = 128;
-    int N  = 128;
-    int K  = 128;
-    int KL = 128;
-    int KU = 128;
+    // 64-bit for the _64 functions
+    int64_t M  = 128;
+    int64_t N  = 128;
+    int64_t K  = 128;
+    int     KL = 128;
+    int     KU = 128;
 
     int rows = 128;
     int cols = 128;
@@ -121,6 +122,7 @@ struct Arguments
 
     int apiCallCount = 1;
     int batch_count  = 10;
+    int group_count  = 1;
 
     bool fortran = false;
 
@@ -140,6 +142,10 @@ struct Arguments
 
     hipblas_initialization initialization = hipblas_initialization::rand_int;
 
+    // calls the test stands for in a workload, scales its time in the
+    // aggregate hipblas-bench reports for a data file
+    int weight = 1;
+
     // clang-format off
 
 // Generic macro which operates over the list of arguments in order of declaration
@@ -185,6 +191,7 @@ struct Arguments
     OPER(diag) SEP                   \
     OPER(apiCallCount) SEP           \
     OPER(batch_count) SEP            \
+    OPER(group_count) SEP            \
     OPER(fortran) SEP                \
     OPER(norm_check) SEP             \
     OPER(unit_check) SEP             \
@@ -198,7 +205,8 @@ struct Arguments
     OPER(name) SEP                   \
     OPER(category) SEP               \
     OPER(atomics_mode) SEP           \
-    OPER(initialization)
+    OPER(initialization) SEP         \
+    OPER(weight)
 
     // clang-format on
 
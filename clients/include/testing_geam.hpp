@@ -153,6 +153,41 @@ inline hipblasStatus_t testing_geam(const Arguments& arg)
         cblas_geam(
             transA, transB, M, N, &h_alpha, (T*)hA, lda, &h_beta, (T*)hB, ldb, (T*)hC_copy, ldc);
 
+        // in-place C = alpha * C + beta * op(B), with C taking the place of A
+        if(transA == HIPBLAS_OP_N)
+        {
+            host_vector<T> hC_in(C_size);
+            host_vector<T> hC_gold(C_size);
+
+            hipblas_init_matrix(hC_in, arg, M, N, ldc, 0, 1, hipblas_client_alpha_sets_nan);
+            host_vector<T> hA_in(hC_in);
+            hC_gold = hC_in;
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(dC, hC_in.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGeamFn(
+                handle, transA, transB, M, N, &h_alpha, dC, ldc, &h_beta, dB, ldb, dC, ldc));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_in.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+            cblas_geam(transA,
+                       transB,
+                       M,
+                       N,
+                       &h_alpha,
+                       (T*)hA_in,
+                       ldc,
+                       &h_beta,
+                       (T*)hB,
+                       ldb,
+                       (T*)hC_gold,
+                       ldc);
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_in.data());
+        }
+
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
         if(arg.unit_check)
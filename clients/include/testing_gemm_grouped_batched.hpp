@@ -0,0 +1,297 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "arg_check.h"
+#include "testing_common.hpp"
+#include <typeinfo>
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedBatchedModel = ArgumentModel<e_transA,
+                                                     e_transB,
+                                                     e_M,
+                                                     e_N,
+                                                     e_K,
+                                                     e_alpha,
+                                                     e_lda,
+                                                     e_ldb,
+                                                     e_beta,
+                                                     e_ldc,
+                                                     e_batch_count,
+                                                     e_group_count>;
+
+inline void testname_gemm_grouped_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedBatchedModel{}.test_name(arg, name);
+}
+
+// group_count groups of batch_count gemms each. Group g has
+// M * (g + 1) / group_count rows, so the last group is M x N and the groups
+// differ in size; transposes, N, K, leading dimensions and scalars are shared.
+template <typename T>
+inline hipblasStatus_t testing_gemm_grouped_batched(const Arguments& arg)
+{
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+    int                group_count = arg.group_count;
+
+    hipblasDatatype_t type = std::is_same<T, float>{} ? HIPBLAS_R_32F : HIPBLAS_R_64F;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int groups = std::max(group_count, 1);
+
+    std::vector<hipblasOperation_t> transA_array(groups, transA);
+    std::vector<hipblasOperation_t> transB_array(groups, transB);
+    std::vector<int>                m_array(groups), n_array(groups, N), k_array(groups, K);
+    std::vector<int>                lda_array(groups, lda), ldb_array(groups, ldb);
+    std::vector<int>                ldc_array(groups, ldc), group_size(groups, batch_count);
+    std::vector<T>                  alpha_array(groups, h_alpha), beta_array(groups, h_beta);
+
+    for(int g = 0; g < groups; g++)
+        m_array[g] = M < 0 ? M : int(int64_t(M) * (g + 1) / groups);
+
+    // bad arg checks, the groups are only looked at when there are any
+    if(group_count < 0
+       || (group_count > 0
+           && (batch_count < 0 || M < 0 || N < 0 || K < 0 || lda < 0 || ldb < 0 || ldc < 0)))
+    {
+        hipblasStatus_t    status = HIPBLAS_STATUS_SUCCESS;
+        hipblasLocalHandle handle(arg);
+
+        const void *dA_array[1], *dB_array[1];
+        void*       dC1_array[1];
+
+        status = hipblasGemmGroupedBatchedEx(handle,
+                                             transA_array.data(),
+                                             transB_array.data(),
+                                             m_array.data(),
+                                             n_array.data(),
+                                             k_array.data(),
+                                             alpha_array.data(),
+                                             dA_array,
+                                             type,
+                                             lda_array.data(),
+                                             dB_array,
+                                             type,
+                                             ldb_array.data(),
+                                             beta_array.data(),
+                                             dC1_array,
+                                             type,
+                                             ldc_array.data(),
+                                             group_count,
+                                             group_size.data(),
+                                             type);
+
+        verify_hipblas_status_invalid_value(status,
+                                            "ERROR: group_count < 0 || batch_count < 0 || M < 0 "
+                                            "|| N < 0 || K < 0 || lda < 0 || ldb < 0 || ldc < 0 ");
+
+        return status;
+    }
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    if(group_count > 0 && (lda < A_row || ldb < B_row || ldc < M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    double             gpu_time_used, hipblas_error_host;
+    hipblasLocalHandle handle(arg);
+
+    // no groups: nothing is read, not even the arrays
+    if(group_count == 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedEx(handle,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        type,
+                                                        nullptr,
+                                                        nullptr,
+                                                        type,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        type,
+                                                        nullptr,
+                                                        0,
+                                                        nullptr,
+                                                        type));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // every problem is allocated at the size of the largest group
+    int    total  = group_count * batch_count;
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // host arrays
+    host_batch_vector<T> hA(A_size, 1, total);
+    host_batch_vector<T> hB(B_size, 1, total);
+    host_batch_vector<T> hC_host(C_size, 1, total);
+    host_batch_vector<T> hC_copy(C_size, 1, total);
+
+    // device arrays
+    device_batch_vector<T> dA(A_size, 1, total);
+    device_batch_vector<T> dB(B_size, 1, total);
+    device_batch_vector<T> dC(C_size, 1, total);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan);
+    hipblas_init_vector(hC_host, arg, hipblas_client_beta_sets_nan);
+
+    hC_copy.copy_from(hC_host);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
+    auto hipblasGemmGroupedBatchedFn = [&]() {
+        return hipblasGemmGroupedBatchedEx(handle,
+                                           transA_array.data(),
+                                           transB_array.data(),
+                                           m_array.data(),
+                                           n_array.data(),
+                                           k_array.data(),
+                                           alpha_array.data(),
+                                           (const void**)dA.ptr_on_device(),
+                                           type,
+                                           lda_array.data(),
+                                           (const void**)dB.ptr_on_device(),
+                                           type,
+                                           ldb_array.data(),
+                                           beta_array.data(),
+                                           (void**)dC.ptr_on_device(),
+                                           type,
+                                           ldc_array.data(),
+                                           group_count,
+                                           group_size.data(),
+                                           type);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // calculate "golden" result on CPU
+        for(int g = 0, i = 0; g < group_count; g++)
+        {
+            for(int b = 0; b < group_size[g]; b++, i++)
+            {
+                cblas_gemm<T>(transA,
+                              transB,
+                              m_array[g],
+                              N,
+                              K,
+                              alpha_array[g],
+                              (T*)hA[i],
+                              lda,
+                              (T*)hB[i],
+                              ldb,
+                              beta_array[g],
+                              (T*)hC_copy[i],
+                              ldc);
+            }
+        }
+
+        // the scalar arrays are host arrays, device pointer mode is refused
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedFn(), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+        // test hipBLAS grouped batched gemm with alpha and beta on host
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedFn());
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        // rows past m_array[g] are left untouched in both results, so the
+        // whole M x N block of every problem is compared
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, total, ldc, hC_copy, hC_host);
+        }
+
+        if(arg.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>('F', M, N, ldc, hC_copy, hC_host, total);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedFn());
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // the model scales the counts by batch_count, so they are passed per batch
+        hipblasGemmGroupedBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            gemm_grouped_batched_gflop_count<T>(
+                group_count, m_array.data(), n_array.data(), k_array.data(), group_size.data())
+                / std::max(batch_count, 1),
+            gemm_grouped_batched_gbyte_count<T>(
+                group_count, m_array.data(), n_array.data(), k_array.data(), group_size.data())
+                / std::max(batch_count, 1),
+            hipblas_error_host);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+// gemm throughput under the tile split the library read from
+// HIPBLAS_ONEAPI_TILE_SPLIT when the first handle was created (0, a single
+// tile, when it is not set). Run it with HIPBLAS_ONEAPI_TILE_SPLIT=0 and =1 to
+// compare single tile and split runs; with norm_check the result of one call is
+// compared to the host reference. Devices without sub-devices and other
+// backends always run the single tile path.
+
+using hipblasGemmTileSplitModel = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_lda, e_ldb, e_ldc>;
+
+inline void testname_gemm_tile_split(const Arguments& arg, std::string& name)
+{
+    hipblasGemmTileSplitModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_tile_split(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M   = arg.M;
+    int N   = arg.N;
+    int K   = arg.K;
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    int A_row = arg.transA == 'N' ? M : K;
+    int A_col = arg.transA == 'N' ? K : M;
+    int B_row = arg.transB == 'N' ? K : N;
+    int B_col = arg.transB == 'N' ? N : K;
+
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!arg.timing || arg.iters < 1)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+    const char* env        = getenv("HIPBLAS_ONEAPI_TILE_SPLIT");
+    std::string tile_split = env ? env : "0";
+
+    hipblasLocalHandle handle(arg);
+    hipStream_t        stream;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // one call from the initial C for the result comparison
+    CHECK_HIPBLAS_ERROR(hipblasGemm<T>(
+        handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    double split_error = 0.0;
+    if(arg.norm_check)
+    {
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA.data(),
+                      lda,
+                      hB.data(),
+                      ldb,
+                      h_beta,
+                      hC_gold.data(),
+                      ldc);
+        split_error = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC));
+    }
+
+    double gpu_time_used = 0.0;
+    int    runs          = arg.cold_iters + arg.iters;
+    for(int iter = 0; iter < runs; iter++)
+    {
+        if(iter == arg.cold_iters)
+            gpu_time_used = get_time_us_sync(stream);
+
+        CHECK_HIPBLAS_ERROR(hipblasGemm<T>(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+    }
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    gpu_time_used = (get_time_us_sync(stream) - gpu_time_used) / arg.iters;
+
+    double gflops = gemm_gflop_count<T>(M, N, K);
+    std::cout << "transA,transB,M,N,K,lda,ldb,ldc,iters,tile_split,gflops,us,error\n"
+              << arg.transA << "," << arg.transB << "," << M << "," << N << "," << K << ","
+              << lda << "," << ldb << "," << ldc << "," << arg.iters << "," << tile_split << ","
+              << gflops / gpu_time_used * 1e6 << "," << gpu_time_used << "," << split_error
+              << std::endl;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,379 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+// axpy_64, dot_64, iamax_64 and gemm_64 take their sizes from the 64-bit M, N
+// and K of the arguments, so they run with 2^31 elements and more. The data is
+// a short repeating pattern that is exact in float, and the reference is a
+// plain host loop in double, as cblas takes int sizes.
+
+using hipblasIlp64VectorModel = ArgumentModel<e_N, e_alpha, e_incx, e_incy>;
+using hipblasIlp64GemmModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_ilp64_vector(const Arguments& arg, std::string& name)
+{
+    hipblasIlp64VectorModel{}.test_name(arg, name);
+}
+
+inline void testname_ilp64_gemm(const Arguments& arg, std::string& name)
+{
+    hipblasIlp64GemmModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void ilp64_fill(host_vector<T>& v, int64_t shift)
+{
+    for(size_t i = 0; i < v.size(); i++)
+        v[i] = T(int64_t((i + shift) % 7) - 3);
+}
+
+// First element of a vector of n elements with increment inc, as in BLAS
+inline int64_t ilp64_start(int64_t n, int64_t inc)
+{
+    return inc < 0 ? (1 - n) * inc : 0;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_axpy_64(const Arguments& arg)
+{
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    if(N <= 0 || !incx || !incy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t sizeX = size_t(N) * std::abs(incx);
+    size_t sizeY = size_t(N) * std::abs(incy);
+    T      alpha = arg.get_alpha<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T>   hx(sizeX);
+    host_vector<T>   hy(sizeY);
+    host_vector<T>   hy_gold(sizeY);
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+
+    double gpu_time_used = 0.0, hipblas_error = 0.0;
+
+    ilp64_fill(hx, 0);
+    ilp64_fill(hy, 3);
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, &alpha, dx, incx, dy, incy));
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        const T* x      = hx;
+        T*       y_gold = hy_gold;
+        int64_t  ix = ilp64_start(N, incx), iy = ilp64_start(N, incy);
+        for(int64_t i = 0; i < N; i++, ix += incx, iy += incy)
+            y_gold[iy] += alpha * x[ix];
+
+        for(size_t i = 0; i < sizeY; i++)
+            hipblas_error = std::max(hipblas_error, double(std::abs(hy_gold[i] - hy[i])));
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, &alpha, dx, incx, dy, incy));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasIlp64VectorModel{}.log_args<T>(std::cout,
+                                              arg,
+                                              gpu_time_used,
+                                              axpy_gflop_count<T>(N),
+                                              axpy_gbyte_count<T>(N),
+                                              hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_dot_64(const Arguments& arg)
+{
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+    int64_t incy = arg.incy;
+
+    if(N <= 0 || !incx || !incy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t sizeX = size_t(N) * std::abs(incx);
+    size_t sizeY = size_t(N) * std::abs(incy);
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T>   hx(sizeX);
+    host_vector<T>   hy(sizeY);
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+    device_vector<T> d_result(1);
+
+    double gpu_time_used = 0.0, hipblas_error = 0.0;
+
+    ilp64_fill(hx, 0);
+    ilp64_fill(hy, 3);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        T result;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasDot_64<T>(handle, N, dx, incx, dy, incy, &result));
+
+        const T* x    = hx;
+        const T* y    = hy;
+        double   gold = 0.0;
+        int64_t  ix = ilp64_start(N, incx), iy = ilp64_start(N, incy);
+        for(int64_t i = 0; i < N; i++, ix += incx, iy += incy)
+            gold += double(x[ix]) * double(y[iy]);
+
+        // relative, the sum grows with N
+        hipblas_error = std::abs(gold - double(result)) / std::max(std::abs(gold), 1.0);
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasDot_64<T>(handle, N, dx, incx, dy, incy, d_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasIlp64VectorModel{}.log_args<T>(std::cout,
+                                              arg,
+                                              gpu_time_used,
+                                              dot_gflop_count<false, T>(N),
+                                              dot_gbyte_count<T>(N),
+                                              hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_iamax_64(const Arguments& arg)
+{
+    int64_t N    = arg.N;
+    int64_t incx = arg.incx;
+
+    if(N <= 0 || incx <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t sizeX = size_t(N) * incx;
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T>         hx(sizeX);
+    device_vector<T>       dx(sizeX);
+    device_vector<int64_t> d_result(1);
+
+    double gpu_time_used = 0.0, hipblas_error = 0.0;
+
+    // the pattern peaks at 3, so the maximum is the single 4 in the last
+    // element and the expected index is N
+    ilp64_fill(hx, 0);
+    hx[size_t(N - 1) * incx] = T(4);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        int64_t result;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasIamax_64<T>(handle, N, dx, incx, &result));
+        hipblas_error = double(std::abs(result - N));
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasIamax_64<T>(handle, N, dx, incx, d_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasIlp64VectorModel{}.log_args<T>(std::cout,
+                                              arg,
+                                              gpu_time_used,
+                                              iamax_gflop_count<T>(N),
+                                              iamax_gbyte_count<T>(N),
+                                              hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_64(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int64_t M = arg.M;
+    int64_t N = arg.N;
+    int64_t K = arg.K;
+
+    int64_t A_row = arg.transA == 'N' ? M : K;
+    int64_t A_col = arg.transA == 'N' ? K : M;
+    int64_t B_row = arg.transB == 'N' ? K : N;
+    int64_t B_col = arg.transB == 'N' ? N : K;
+
+    // the 32-bit leading dimensions of the arguments are raised to the minimum
+    int64_t lda = std::max<int64_t>(arg.lda, A_row);
+    int64_t ldb = std::max<int64_t>(arg.ldb, B_row);
+    int64_t ldc = std::max<int64_t>(arg.ldc, M);
+
+    if(M <= 0 || N <= 0 || K <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+    T      alpha  = arg.get_alpha<T>();
+    T      beta   = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hC(C_size);
+    host_vector<T>   hC_gold(C_size);
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    double gpu_time_used = 0.0, hipblas_error = 0.0;
+
+    ilp64_fill(hA, 0);
+    ilp64_fill(hB, 3);
+    ilp64_fill(hC, 5);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGemm_64<T>(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        const T* A      = hA;
+        const T* B      = hB;
+        const T* C      = hC;
+        const T* C_gold = hC_gold;
+        auto     a = [&](int64_t i, int64_t l) {
+            return arg.transA == 'N' ? A[i + l * lda] : A[l + i * lda];
+        };
+        auto b = [&](int64_t l, int64_t j) {
+            return arg.transB == 'N' ? B[l + j * ldb] : B[j + l * ldb];
+        };
+        for(int64_t j = 0; j < N; j++)
+            for(int64_t i = 0; i < M; i++)
+            {
+                double sum = 0.0;
+                for(int64_t l = 0; l < K; l++)
+                    sum += double(a(i, l)) * double(b(l, j));
+                double c     = double(C_gold[i + j * ldc]);
+                double gold  = double(alpha) * sum + double(beta) * c;
+                double error = std::abs(gold - double(C[i + j * ldc]));
+                hipblas_error = std::max(hipblas_error, error / std::max(std::abs(gold), 1.0));
+            }
+
+        // the timed calls accumulate into C
+        CHECK_HIP_ERROR(
+            hipMemcpy(dC, hC_gold.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemm_64<T>(
+                handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasIlp64GemmModel{}.log_args<T>(std::cout,
+                                            arg,
+                                            gpu_time_used,
+                                            gemm_gflop_count<T>(M, N, K),
+                                            gemm_gbyte_count<T>(M, N, K),
+                                            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
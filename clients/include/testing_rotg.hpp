@@ -84,11 +84,8 @@ inline hipblasStatus_t testing_rotg(const Arguments& arg)
 
     if(arg.unit_check || arg.norm_check)
     {
-// oneMKL does not support host pointers hence skipping the test
-#ifndef __HIP_PLATFORM_ONEAPI__
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
         CHECK_HIPBLAS_ERROR((hipblasRotgFn(handle, ha, hb, hc, hs)));
-#endif
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         CHECK_HIPBLAS_ERROR((hipblasRotgFn(handle, da, db, dc, ds)));
 
@@ -101,13 +98,10 @@ inline hipblasStatus_t testing_rotg(const Arguments& arg)
 
         if(arg.unit_check)
         {
-            // oneMKL does not support host pointers hence skipping the check
-#ifndef __HIP_PLATFORM_ONEAPI__
             near_check_general(1, 1, 1, ca.data(), ha.data(), rel_error);
             near_check_general(1, 1, 1, cb.data(), hb.data(), rel_error);
             near_check_general(1, 1, 1, cc.data(), hc.data(), rel_error);
             near_check_general(1, 1, 1, cs.data(), hs.data(), rel_error);
-#endif
             near_check_general(1, 1, 1, ca.data(), ra.data(), rel_error);
             near_check_general(1, 1, 1, cb.data(), rb.data(), rel_error);
             near_check_general(1, 1, 1, cc.data(), rc.data(), rel_error);
@@ -116,13 +110,10 @@ inline hipblasStatus_t testing_rotg(const Arguments& arg)
 
         if(arg.norm_check)
         {
-#ifndef __HIP_PLATFORM_ONEAPI__
-            // oneMKL does not support host pointers hence skipping the check
             hipblas_error_host = norm_check_general<T>('F', 1, 1, 1, ca, ha);
             hipblas_error_host += norm_check_general<T>('F', 1, 1, 1, cb, hb);
             hipblas_error_host += norm_check_general<U>('F', 1, 1, 1, cc, hc);
             hipblas_error_host += norm_check_general<T>('F', 1, 1, 1, cs, hs);
-#endif
             hipblas_error_device = norm_check_general<T>('F', 1, 1, 1, ca, ra);
             hipblas_error_device += norm_check_general<T>('F', 1, 1, 1, cb, rb);
             hipblas_error_device += norm_check_general<U>('F', 1, 1, 1, cc, rc);
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+// Host cost of submitting a long chain of small scal calls under the flush
+// batch the library read from HIPBLAS_ONEAPI_FLUSH_BATCH when the first handle
+// was created (1, every call flushed on its own, when it is not set). Run it
+// once with HIPBLAS_ONEAPI_FLUSH_BATCH=1 and once with a larger batch to
+// compare them. Other backends ignore the variable.
+
+using hipblasSubmissionOverheadModel = ArgumentModel<e_N, e_incx>;
+
+inline void testname_submission_overhead(const Arguments& arg, std::string& name)
+{
+    hipblasSubmissionOverheadModel{}.test_name(arg, name);
+}
+
+inline double submission_host_time_us()
+{
+    auto now = std::chrono::steady_clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count());
+}
+
+template <typename T>
+inline hipblasStatus_t testing_submission_overhead(const Arguments& arg)
+{
+    int N    = arg.N;
+    int incx = arg.incx;
+
+    if(!arg.timing || N <= 0 || incx <= 0 || arg.iters < 1)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t           sizeX = size_t(N) * incx;
+    host_vector<T>   hx(sizeX);
+    device_vector<T> dx(sizeX);
+
+    hipblas_init_vector(hx, arg, N, incx, 0, 1, hipblas_client_alpha_sets_nan, true);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+    const char* env         = getenv("HIPBLAS_ONEAPI_FLUSH_BATCH");
+    std::string flush_batch = env ? env : "1";
+
+    hipblasLocalHandle handle(arg);
+    T                  alpha = arg.get_alpha<T>();
+    hipStream_t        stream;
+
+    for(int iter = 0; iter < arg.cold_iters; iter++)
+        CHECK_HIPBLAS_ERROR(hipblasScal<T>(handle, N, &alpha, dx, incx));
+
+    // hipblasGetStream flushes the submissions still pending on the handle
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    double start = get_time_us_sync(stream);
+
+    for(int iter = 0; iter < arg.iters; iter++)
+        CHECK_HIPBLAS_ERROR(hipblasScal<T>(handle, N, &alpha, dx, incx));
+    double submitted = submission_host_time_us();
+
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    double done = get_time_us_sync(stream);
+
+    // per call submission time and per call time until the stream has drained
+    double submit_us = (submitted - start) / arg.iters;
+    double total_us  = (done - start) / arg.iters;
+
+    std::cout << "N,incx,iters,flush_batch,submit_us_per_call,total_us_per_call\n"
+              << N << "," << incx << "," << arg.iters << "," << flush_batch << "," << submit_us
+              << "," << total_us << std::endl;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -87,6 +87,9 @@
 /*! \brief hipblasHanlde_t is a void pointer, to store the library context (either rocBLAS or cuBLAS)*/
 typedef void* hipblasHandle_t;
 
+/*! \brief hipblasCapture_t is a void pointer to a recorded sequence of hipBLAS calls, see hipblasBeginCapture */
+typedef void* hipblasCapture_t;
+
 /*! \brief To specify the datatype to be unsigned short */
 
 #if __cplusplus < 201103L || !defined(HIPBLAS_USE_HIP_HALF)
@@ -730,6 +733,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Start recording the work hipBLAS calls on handle submit to its stream
+    \details
+    Calls made between hipblasBeginCapture and hipblasEndCapture are recorded
+    instead of executed, and can then be replayed with a single submission by
+    hipblasCaptureLaunch. Scalars passed by host pointer are read when the call
+    is recorded. Calls that return results to the host, synchronize or need to
+    grow the handle's scratch memory cannot be recorded and return an error.
+    Only supported on the oneAPI backend, others return HIPBLAS_STATUS_NOT_SUPPORTED.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+ ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasBeginCapture(hipblasHandle_t handle);
+
+/*! \brief Stop recording and return the recorded sequence
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle that is recording.
+    @param[out]
+    capture     [hipblasCapture_t*]
+                recorded sequence, destroy it with hipblasCaptureDestroy before the handle.
+ ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasEndCapture(hipblasHandle_t handle, hipblasCapture_t* capture);
+
+/*! \brief Replay a recorded sequence on the stream of handle */
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCaptureLaunch(hipblasHandle_t handle, hipblasCapture_t capture);
+
+/*! \brief Destroy a recorded sequence */
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaptureDestroy(hipblasCapture_t capture);
+
+/*
+ * ===========================================================================
+ *    ILP64 API
+ *
+ *    Every BLAS function with int sizes has a _64 form taking int64_t sizes,
+ *    increments, leading dimensions and batch counts; amax and amin return an
+ *    int64_t index. Otherwise they behave like the functions without the
+ *    suffix. oneMKL and cuBLAS 12 run them natively, except gemmEx,
+ *    gemmBatchedEx and gemmStridedBatchedEx on cuBLAS. Other backends split
+ *    vectors, independent rows or columns, inner dimensions and batches longer
+ *    than 32 bits into chunks, and return HIPBLAS_STATUS_NOT_SUPPORTED for
+ *    increments, leading dimensions and sizes that cannot be split, such as
+ *    the order of a triangular matrix, above INT_MAX. In device pointer mode a
+ *    split call, and amax and amin on those backends, synchronize the stream.
+ * ===========================================================================
+ */
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -764,14 +815,29 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handl
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
 //! @}
 
 /*! @{
@@ -805,9 +871,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
 HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched_64(hipblasHandle_t    handle,
+                                                       int64_t            n,
+                                                       const float* const x[],
+                                                       int64_t            incx,
+                                                       int64_t            batchCount,
+                                                       int64_t*           result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched_64(hipblasHandle_t     handle,
+                                                       int64_t             n,
+                                                       const double* const x[],
+                                                       int64_t             incx,
+                                                       int64_t             batchCount,
+                                                       int64_t*            result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -815,12 +895,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t
                                                     int                         batchCount,
                                                     int*                        result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       int64_t*                    result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
                                                     int                               incx,
                                                     int                               batchCount,
                                                     int*                              result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       int64_t*                          result);
 //! @}
 
 /*! @{
@@ -864,6 +958,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const double*   x,
@@ -872,6 +974,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const double*   x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -880,6 +990,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            int*                  result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              int64_t*              result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -887,6 +1005,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            int*                        result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIzamaxStridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   int64_t*                    result);
 //! @}
 
 /*! @{
@@ -918,14 +1045,29 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
 //! @}
 
 /*! @{
@@ -959,9 +1101,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin(
 HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminBatched_64(hipblasHandle_t    handle,
+                                                       int64_t            n,
+                                                       const float* const x[],
+                                                       int64_t            incx,
+                                                       int64_t            batchCount,
+                                                       int64_t*           result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminBatched_64(hipblasHandle_t     handle,
+                                                       int64_t             n,
+                                                       const double* const x[],
+                                                       int64_t             incx,
+                                                       int64_t             batchCount,
+                                                       int64_t*            result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -969,12 +1125,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t
                                                     int                         batchCount,
                                                     int*                        result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       int64_t*                    result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
                                                     int                               incx,
                                                     int                               batchCount,
                                                     int*                              result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       int64_t*                          result);
 //! @}
 
 /*! @{
@@ -1018,6 +1188,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const double*   x,
@@ -1026,6 +1204,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const double*   x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -1034,6 +1220,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            int*                  result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              int64_t*              result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -1041,6 +1235,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            int*                        result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIzaminStridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   int64_t*                    result);
 //! @}
 
 /*! @{
@@ -1074,14 +1277,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
 //! @}
 
 /*! @{
@@ -1118,6 +1333,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
 HIPBLAS_EXPORT hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount,
+                                                      float*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double* const x[],
@@ -1125,6 +1347,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                                    int                 batchCount,
                                                    double*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount,
+                                                      double*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -1132,12 +1361,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched(hipblasHandle_t
                                                     int                         batchCount,
                                                     float*                      result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       float*                      result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
                                                     int                               incx,
                                                     int                               batchCount,
                                                     double*                           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       double*                           result);
 //! @}
 
 /*! @{
@@ -1185,6 +1428,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   x,
@@ -1193,6 +1444,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -1201,6 +1460,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            float*                result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              float*                result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -1208,6 +1475,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            double*                     result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDzasumStridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   double*                     result);
 //! @}
 
 /*! @{
@@ -1250,6 +1526,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
                                             hipblasHalf*       y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpy_64(hipblasHandle_t    handle,
+                                               int64_t            n,
+                                               const hipblasHalf* alpha,
+                                               const hipblasHalf* x,
+                                               int64_t            incx,
+                                               hipblasHalf*       y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy(hipblasHandle_t handle,
                                             int             n,
                                             const float*    alpha,
@@ -1258,6 +1542,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy(hipblasHandle_t handle,
                                             float*          y,
                                             int             incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                                             int             n,
                                             const double*   alpha,
@@ -1266,6 +1558,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                                             double*         y,
                                             int             incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* alpha,
@@ -1274,6 +1574,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
@@ -1281,6 +1589,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                                             int                         incx,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -1325,6 +1641,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          hand
                                                    int                      incy,
                                                    int                      batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyBatched_64(hipblasHandle_t          handle,
+                                                      int64_t                  n,
+                                                      const hipblasHalf*       alpha,
+                                                      const hipblasHalf* const x[],
+                                                      int64_t                  incx,
+                                                      hipblasHalf* const       y[],
+                                                      int64_t                  incy,
+                                                      int64_t                  batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                                    int                n,
                                                    const float*       alpha,
@@ -1334,6 +1659,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double*       alpha,
@@ -1343,6 +1677,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex*       alpha,
@@ -1352,6 +1695,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex*       alpha,
@@ -1360,6 +1712,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -1412,6 +1773,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyStridedBatched_64(hipblasHandle_t    handle,
+                                                             int64_t            n,
+                                                             const hipblasHalf* alpha,
+                                                             const hipblasHalf* x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             hipblasHalf*       y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const float*    alpha,
@@ -1423,6 +1795,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    alpha,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   alpha,
@@ -1434,6 +1817,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   alpha,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* alpha,
@@ -1445,6 +1839,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
@@ -1455,6 +1860,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -1490,18 +1907,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScopy(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDcopy(hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* x,
                                             int                         incx,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -1548,6 +1985,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopyBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double* const x[],
@@ -1556,6 +2001,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex* const x[],
@@ -1564,6 +2017,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex* const x[],
@@ -1571,6 +2032,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -1631,6 +2100,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   x,
@@ -1641,6 +2120,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* x,
@@ -1651,6 +2140,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* x,
@@ -1660,6 +2159,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZcopyStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -1708,6 +2218,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
                                            int                incy,
                                            hipblasHalf*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdot_64(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const hipblasHalf* x,
+                                              int64_t            incx,
+                                              const hipblasHalf* y,
+                                              int64_t            incy,
+                                              hipblasHalf*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                                             int                    n,
                                             const hipblasBfloat16* x,
@@ -1716,6 +2234,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                                             int                    incy,
                                             hipblasBfloat16*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasBfdot_64(hipblasHandle_t        handle,
+                                               int64_t                n,
+                                               const hipblasBfloat16* x,
+                                               int64_t                incx,
+                                               const hipblasBfloat16* y,
+                                               int64_t                incy,
+                                               hipblasBfloat16*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                                            int             n,
                                            const float*    x,
@@ -1724,6 +2250,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                                            int             incy,
                                            float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                                            int             n,
                                            const double*   x,
@@ -1732,6 +2266,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                                            int             incy,
                                            double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* x,
@@ -1740,6 +2282,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                                             int                   incy,
                                             hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* x,
@@ -1748,6 +2298,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                                             int                   incy,
                                             hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* x,
@@ -1756,6 +2314,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* x,
@@ -1763,6 +2329,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* y,
                                             int                         incy,
                                             hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
 //! @}
 
 /*! @{
@@ -1818,6 +2392,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handl
                                                   int                      batchCount,
                                                   hipblasHalf*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotBatched_64(hipblasHandle_t          handle,
+                                                     int64_t                  n,
+                                                     const hipblasHalf* const x[],
+                                                     int64_t                  incx,
+                                                     const hipblasHalf* const y[],
+                                                     int64_t                  incy,
+                                                     int64_t                  batchCount,
+                                                     hipblasHalf*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
                                                    int                          n,
                                                    const hipblasBfloat16* const x[],
@@ -1827,6 +2410,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t
                                                    int                          batchCount,
                                                    hipblasBfloat16*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotBatched_64(hipblasHandle_t              handle,
+                                                      int64_t                      n,
+                                                      const hipblasBfloat16* const x[],
+                                                      int64_t                      incx,
+                                                      const hipblasBfloat16* const y[],
+                                                      int64_t                      incy,
+                                                      int64_t                      batchCount,
+                                                      hipblasBfloat16*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                                   int                n,
                                                   const float* const x[],
@@ -1836,6 +2428,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                                   int                batchCount,
                                                   float*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched_64(hipblasHandle_t    handle,
+                                                     int64_t            n,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     const float* const y[],
+                                                     int64_t            incy,
+                                                     int64_t            batchCount,
+                                                     float*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                                   int                 n,
                                                   const double* const x[],
@@ -1845,6 +2446,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                                   int                 batchCount,
                                                   double*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched_64(hipblasHandle_t     handle,
+                                                     int64_t             n,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     const double* const y[],
+                                                     int64_t             incy,
+                                                     int64_t             batchCount,
+                                                     double*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex* const x[],
@@ -1854,6 +2464,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             h
                                                    int                         batchCount,
                                                    hipblasComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount,
+                                                      hipblasComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex* const x[],
@@ -1863,6 +2482,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             h
                                                    int                         batchCount,
                                                    hipblasComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount,
+                                                      hipblasComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex* const x[],
@@ -1872,6 +2500,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t
                                                    int                               batchCount,
                                                    hipblasDoubleComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount,
+                                                      hipblasDoubleComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex* const x[],
@@ -1880,6 +2517,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount,
                                                    hipblasDoubleComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount,
+                                                      hipblasDoubleComplex*             result);
 //! @}
 
 /*! @{
@@ -1943,6 +2589,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    hand
                                                          int                batchCount,
                                                          hipblasHalf*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotStridedBatched_64(hipblasHandle_t    handle,
+                                                            int64_t            n,
+                                                            const hipblasHalf* x,
+                                                            int64_t            incx,
+                                                            hipblasStride      stridex,
+                                                            const hipblasHalf* y,
+                                                            int64_t            incy,
+                                                            hipblasStride      stridey,
+                                                            int64_t            batchCount,
+                                                            hipblasHalf*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
                                                           int                    n,
                                                           const hipblasBfloat16* x,
@@ -1954,6 +2611,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t
                                                           int                    batchCount,
                                                           hipblasBfloat16*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotStridedBatched_64(hipblasHandle_t        handle,
+                                                             int64_t                n,
+                                                             const hipblasBfloat16* x,
+                                                             int64_t                incx,
+                                                             hipblasStride          stridex,
+                                                             const hipblasBfloat16* y,
+                                                             int64_t                incy,
+                                                             hipblasStride          stridey,
+                                                             int64_t                batchCount,
+                                                             hipblasBfloat16*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                                          int             n,
                                                          const float*    x,
@@ -1965,6 +2633,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                                          int             batchCount,
                                                          float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const float*    x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const float*    y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batchCount,
+                                                            float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                                          int             n,
                                                          const double*   x,
@@ -1976,6 +2655,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                                          int             batchCount,
                                                          double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const double*   x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const double*   y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batchCount,
+                                                            double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* x,
@@ -1987,6 +2677,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t
                                                           int                   batchCount,
                                                           hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount,
+                                                             hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* x,
@@ -1998,6 +2699,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t
                                                           int                   batchCount,
                                                           hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount,
+                                                             hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* x,
@@ -2009,6 +2721,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t
                                                           int                         batchCount,
                                                           hipblasDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount,
+                                                             hipblasDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* x,
@@ -2019,6 +2742,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount,
                                                           hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount,
+                                                             hipblasDoubleComplex*       result);
 //! @}
 
 /*! @{
@@ -2053,14 +2787,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
 //! @}
 
 /*! @{
@@ -2098,6 +2844,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2(
 HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Batched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount,
+                                                      float*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double* const x[],
@@ -2105,6 +2858,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                                    int                 batchCount,
                                                    double*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount,
+                                                      double*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -2112,12 +2872,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t
                                                     int                         batchCount,
                                                     float*                      result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       float*                      result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
                                                     int                               incx,
                                                     int                               batchCount,
                                                     double*                           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       double*                           result);
 //! @}
 
 /*! @{
@@ -2167,6 +2941,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2StridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   x,
@@ -2175,6 +2957,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -2183,6 +2973,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            float*                result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              float*                result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -2190,6 +2988,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t
                                                            hipblasStride               stridex,
                                                            int                         batchCount,
                                                            double*                     result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDznrm2StridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   double*                     result);
 //! @}
 
 /*! @{
@@ -2234,6 +3041,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
                                            const float*    c,
                                            const float*    s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              float*          y,
+                                              int64_t         incy,
+                                              const float*    c,
+                                              const float*    s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                                            int             n,
                                            double*         x,
@@ -2243,6 +3059,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                                            const double*   c,
                                            const double*   s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              double*         y,
+                                              int64_t         incy,
+                                              const double*   c,
+                                              const double*   s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                                            int                   n,
                                            hipblasComplex*       x,
@@ -2252,6 +3077,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                                            const float*          c,
                                            const hipblasComplex* s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrot_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              const float*          c,
+                                              const hipblasComplex* s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                                             int             n,
                                             hipblasComplex* x,
@@ -2261,6 +3095,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                                             const float*    c,
                                             const float*    s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy,
+                                               const float*    c,
+                                               const float*    s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                                            int                         n,
                                            hipblasDoubleComplex*       x,
@@ -2270,6 +3113,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                                            const double*               c,
                                            const hipblasDoubleComplex* s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrot_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              const double*               c,
+                                              const hipblasDoubleComplex* s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                                             int                   n,
                                             hipblasDoubleComplex* x,
@@ -2278,6 +3130,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                                             int                   incy,
                                             const double*         c,
                                             const double*         s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy,
+                                               const double*         c,
+                                               const double*         s);
 //! @}
 
 /*! @{
@@ -2326,6 +3187,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                                   const float*    s,
                                                   int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotBatched_64(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     float* const    x[],
+                                                     int64_t         incx,
+                                                     float* const    y[],
+                                                     int64_t         incy,
+                                                     const float*    c,
+                                                     const float*    s,
+                                                     int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                                   int             n,
                                                   double* const   x[],
@@ -2336,6 +3207,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                                   const double*   s,
                                                   int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched_64(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     double* const   x[],
+                                                     int64_t         incx,
+                                                     double* const   y[],
+                                                     int64_t         incy,
+                                                     const double*   c,
+                                                     const double*   s,
+                                                     int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                                   int                   n,
                                                   hipblasComplex* const x[],
@@ -2346,6 +3227,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                                   const hipblasComplex* s,
                                                   int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched_64(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasComplex* const x[],
+                                                     int64_t               incx,
+                                                     hipblasComplex* const y[],
+                                                     int64_t               incy,
+                                                     const float*          c,
+                                                     const hipblasComplex* s,
+                                                     int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                                    int                   n,
                                                    hipblasComplex* const x[],
@@ -2356,6 +3247,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                                    const float*          s,
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      hipblasComplex* const y[],
+                                                      int64_t               incy,
+                                                      const float*          c,
+                                                      const float*          s,
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                                   int                         n,
                                                   hipblasDoubleComplex* const x[],
@@ -2366,6 +3267,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             ha
                                                   const hipblasDoubleComplex* s,
                                                   int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched_64(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     hipblasDoubleComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex* const y[],
+                                                     int64_t                     incy,
+                                                     const double*               c,
+                                                     const hipblasDoubleComplex* s,
+                                                     int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    hipblasDoubleComplex* const x[],
@@ -2375,6 +3286,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             h
                                                    const double*               c,
                                                    const double*               s,
                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasDoubleComplex* const y[],
+                                                      int64_t                     incy,
+                                                      const double*               c,
+                                                      const double*               s,
+                                                      int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -2431,6 +3352,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                                          const float*    s,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            float*          x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            float*          y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            const float*    c,
+                                                            const float*    s,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                                          int             n,
                                                          double*         x,
@@ -2443,6 +3376,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                                          const double*   s,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            double*         x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            double*         y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            const double*   c,
+                                                            const double*   s,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                                          int                   n,
                                                          hipblasComplex*       x,
@@ -2455,6 +3400,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       h
                                                          const hipblasComplex* s,
                                                          int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched_64(hipblasHandle_t       handle,
+                                                            int64_t               n,
+                                                            hipblasComplex*       x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       y,
+                                                            int64_t               incy,
+                                                            hipblasStride         stridey,
+                                                            const float*          c,
+                                                            const hipblasComplex* s,
+                                                            int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           hipblasComplex* x,
@@ -2467,6 +3424,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle
                                                           const float*    s,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             hipblasComplex* x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             hipblasComplex* y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const float*    c,
+                                                             const float*    s,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                                          int                         n,
                                                          hipblasDoubleComplex*       x,
@@ -2479,6 +3448,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t
                                                          const hipblasDoubleComplex* s,
                                                          int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched_64(hipblasHandle_t             handle,
+                                                            int64_t                     n,
+                                                            hipblasDoubleComplex*       x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       y,
+                                                            int64_t                     incy,
+                                                            hipblasStride               stridey,
+                                                            const double*               c,
+                                                            const hipblasDoubleComplex* s,
+                                                            int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           hipblasDoubleComplex* x,
@@ -2490,6 +3471,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t
                                                           const double*         c,
                                                           const double*         s,
                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             hipblasDoubleComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasDoubleComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             const double*         c,
+                                                             const double*         s,
+                                                             int64_t               batchCount);
 //! @}
 
 /*! @{
@@ -2570,6 +3563,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
                                                    float* const    s[],
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgBatched_64(hipblasHandle_t handle,
+                                                      float* const    a[],
+                                                      float* const    b[],
+                                                      float* const    c[],
+                                                      float* const    s[],
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                                    double* const   a[],
                                                    double* const   b[],
@@ -2577,6 +3577,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                                    double* const   s[],
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgBatched_64(hipblasHandle_t handle,
+                                                      double* const   a[],
+                                                      double* const   b[],
+                                                      double* const   c[],
+                                                      double* const   s[],
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                                    hipblasComplex* const a[],
                                                    hipblasComplex* const b[],
@@ -2584,12 +3591,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                                    hipblasComplex* const s[],
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched_64(hipblasHandle_t       handle,
+                                                      hipblasComplex* const a[],
+                                                      hipblasComplex* const b[],
+                                                      float* const          c[],
+                                                      hipblasComplex* const s[],
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
                                                    hipblasDoubleComplex* const a[],
                                                    hipblasDoubleComplex* const b[],
                                                    double* const               c[],
                                                    hipblasDoubleComplex* const s[],
                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched_64(hipblasHandle_t             handle,
+                                                      hipblasDoubleComplex* const a[],
+                                                      hipblasDoubleComplex* const b[],
+                                                      double* const               c[],
+                                                      hipblasDoubleComplex* const s[],
+                                                      int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -2644,6 +3665,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strides,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgStridedBatched_64(hipblasHandle_t handle,
+                                                             float*          a,
+                                                             hipblasStride   stridea,
+                                                             float*          b,
+                                                             hipblasStride   strideb,
+                                                             float*          c,
+                                                             hipblasStride   stridec,
+                                                             float*          s,
+                                                             hipblasStride   strides,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                                           double*         a,
                                                           hipblasStride   stridea,
@@ -2655,6 +3687,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strides,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgStridedBatched_64(hipblasHandle_t handle,
+                                                             double*         a,
+                                                             hipblasStride   stridea,
+                                                             double*         b,
+                                                             hipblasStride   strideb,
+                                                             double*         c,
+                                                             hipblasStride   stridec,
+                                                             double*         s,
+                                                             hipblasStride   strides,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                                           hipblasComplex* a,
                                                           hipblasStride   stridea,
@@ -2666,6 +3709,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strides,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched_64(hipblasHandle_t handle,
+                                                             hipblasComplex* a,
+                                                             hipblasStride   stridea,
+                                                             hipblasComplex* b,
+                                                             hipblasStride   strideb,
+                                                             float*          c,
+                                                             hipblasStride   stridec,
+                                                             hipblasComplex* s,
+                                                             hipblasStride   strides,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                                           hipblasDoubleComplex* a,
                                                           hipblasStride         stridea,
@@ -2676,6 +3730,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t
                                                           hipblasDoubleComplex* s,
                                                           hipblasStride         strides,
                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasDoubleComplex* a,
+                                                             hipblasStride         stridea,
+                                                             hipblasDoubleComplex* b,
+                                                             hipblasStride         strideb,
+                                                             double*               c,
+                                                             hipblasStride         stridec,
+                                                             hipblasDoubleComplex* s,
+                                                             hipblasStride         strides,
+                                                             int64_t               batchCount);
 //! @}
 
 /*! @{
@@ -2722,8 +3787,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t hipblasSrotm(
     hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotm_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               float*          x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy,
+                                               const float*    param);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotm(
     hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotm_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               double*         x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy,
+                                               const double*   param);
 //! @}
 
 /*! @{
@@ -2779,6 +3860,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                                    const float* const param[],
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      const float* const param[],
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    double* const       x[],
@@ -2787,6 +3877,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    const double* const param[],
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      const double* const param[],
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -2854,6 +3953,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strideParam,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const float*    param,
+                                                             hipblasStride   strideParam,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           double*         x,
@@ -2865,6 +3976,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle
                                                           const double*   param,
                                                           hipblasStride   strideParam,
                                                           int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const double*   param,
+                                                             hipblasStride   strideParam,
+                                                             int64_t         batchCount);
 //! @}
 
 /*! @{
@@ -2963,6 +4086,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
                                                     float* const       param[],
                                                     int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgBatched_64(hipblasHandle_t    handle,
+                                                       float* const       d1[],
+                                                       float* const       d2[],
+                                                       float* const       x1[],
+                                                       const float* const y1[],
+                                                       float* const       param[],
+                                                       int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                                     double* const       d1[],
                                                     double* const       d2[],
@@ -2970,6 +4101,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                                     const double* const y1[],
                                                     double* const       param[],
                                                     int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgBatched_64(hipblasHandle_t     handle,
+                                                       double* const       d1[],
+                                                       double* const       d2[],
+                                                       double* const       x1[],
+                                                       const double* const y1[],
+                                                       double* const       param[],
+                                                       int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -3042,6 +4181,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handl
                                                            hipblasStride   strideParam,
                                                            int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgStridedBatched_64(hipblasHandle_t handle,
+                                                              float*          d1,
+                                                              hipblasStride   strided1,
+                                                              float*          d2,
+                                                              hipblasStride   strided2,
+                                                              float*          x1,
+                                                              hipblasStride   stridex1,
+                                                              const float*    y1,
+                                                              hipblasStride   stridey1,
+                                                              float*          param,
+                                                              hipblasStride   strideParam,
+                                                              int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
                                                            double*         d1,
                                                            hipblasStride   strided1,
@@ -3054,6 +4206,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handl
                                                            double*         param,
                                                            hipblasStride   strideParam,
                                                            int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched_64(hipblasHandle_t handle,
+                                                              double*         d1,
+                                                              hipblasStride   strided1,
+                                                              double*         d2,
+                                                              hipblasStride   strided2,
+                                                              double*         x1,
+                                                              hipblasStride   stridex1,
+                                                              const double*   y1,
+                                                              hipblasStride   stridey1,
+                                                              double*         param,
+                                                              hipblasStride   strideParam,
+                                                              int64_t         batchCount);
 //! @}
 
 /*! @{
@@ -3086,23 +4251,47 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handl
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDscal(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscal(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasCsscal(hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx);
 //! @}
 
 /*! @{
@@ -3138,6 +4327,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal(
 HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    alpha,
+                                                      float* const    x[],
+                                                      int64_t         incx,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched(hipblasHandle_t handle,
                                                    int             n,
                                                    const double*   alpha,
@@ -3145,6 +4341,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched(hipblasHandle_t handle,
                                                    int             incx,
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   alpha,
+                                                      double* const   x[],
+                                                      int64_t         incx,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                                    int                   n,
                                                    const hipblasComplex* alpha,
@@ -3152,6 +4355,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                                    int                   incx,
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* alpha,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasDoubleComplex* alpha,
@@ -3159,6 +4369,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                                     int                   n,
                                                     const float*          alpha,
@@ -3166,12 +4383,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle
                                                     int                   incx,
                                                     int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched_64(hipblasHandle_t       handle,
+                                                       int64_t               n,
+                                                       const float*          alpha,
+                                                       hipblasComplex* const x[],
+                                                       int64_t               incx,
+                                                       int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const double*               alpha,
                                                     hipblasDoubleComplex* const x[],
                                                     int                         incx,
                                                     int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const double*               alpha,
+                                                       hipblasDoubleComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -3217,6 +4448,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridex,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    alpha,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   alpha,
@@ -3225,6 +4464,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridex,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   alpha,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* alpha,
@@ -3233,6 +4480,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
@@ -3241,6 +4496,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZscalStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const float*    alpha,
@@ -3249,6 +4513,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handl
                                                            hipblasStride   stridex,
                                                            int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    alpha,
+                                                              hipblasComplex* x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const double*         alpha,
@@ -3256,6 +4528,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t
                                                            int                   incx,
                                                            hipblasStride         stridex,
                                                            int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const double*         alpha,
+                                                              hipblasDoubleComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount);
 //! @}
 
 /*! @{
@@ -3291,18 +4571,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswap(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                                             int                   n,
                                             hipblasDoubleComplex* x,
                                             int                   incx,
                                             hipblasDoubleComplex* y,
                                             int                   incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy);
 //! @}
 
 /*! @{
@@ -3341,9 +4641,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
 HIPBLAS_EXPORT hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      float*          x[],
+                                                      int64_t         incx,
+                                                      float*          y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDswapBatched(
     hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      double*         x[],
+                                                      int64_t         incx,
+                                                      double*         y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                                    int             n,
                                                    hipblasComplex* x[],
@@ -3352,6 +4668,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                                    int             incy,
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      hipblasComplex* x[],
+                                                      int64_t         incx,
+                                                      hipblasComplex* y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                                    int                   n,
                                                    hipblasDoubleComplex* x[],
@@ -3359,6 +4683,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                                    hipblasDoubleComplex* y[],
                                                    int                   incy,
                                                    int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      hipblasDoubleComplex* x[],
+                                                      int64_t               incx,
+                                                      hipblasDoubleComplex* y[],
+                                                      int64_t               incy,
+                                                      int64_t               batchCount);
 //! @}
 
 /*! @{
@@ -3416,6 +4748,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           double*         x,
@@ -3426,6 +4768,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           hipblasComplex* x,
@@ -3436,6 +4788,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             hipblasComplex* x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             hipblasComplex* y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           hipblasDoubleComplex* x,
@@ -3445,6 +4807,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t
                                                           int                   incy,
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             hipblasDoubleComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasDoubleComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
 //! @}
 
 /*
@@ -3539,6 +4911,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
                                             float*             y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            kl,
+                                               int64_t            ku,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       x,
+                                               int64_t            incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
                                             hipblasOperation_t trans,
                                             int                m,
@@ -3554,6 +4941,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
                                             double*            y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            kl,
+                                               int64_t            ku,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      x,
+                                               int64_t            incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
                                             hipblasOperation_t    trans,
                                             int                   m,
@@ -3569,6 +4971,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmv_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               kl,
+                                               int64_t               ku,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                                             hipblasOperation_t          trans,
                                             int                         m,
@@ -3583,6 +5000,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               int64_t                     kl,
+                                               int64_t                     ku,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -3677,6 +5109,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      int64_t            kl,
+                                                      int64_t            ku,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                                    hipblasOperation_t  trans,
                                                    int                 m,
@@ -3693,6 +5141,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  trans,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             kl,
+                                                      int64_t             ku,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                                    hipblasOperation_t          trans,
                                                    int                         m,
@@ -3709,6 +5173,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          trans,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      int64_t                     kl,
+                                                      int64_t                     ku,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
                                                    hipblasOperation_t                trans,
                                                    int                               m,
@@ -3724,6 +5204,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                trans,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      int64_t                           kl,
+                                                      int64_t                           ku,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -3830,6 +5326,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            kl,
+                                                             int64_t            ku,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t trans,
                                                           int                m,
@@ -3849,6 +5364,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            kl,
+                                                             int64_t            ku,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasOperation_t    trans,
                                                           int                   m,
@@ -3868,6 +5402,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    trans,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               kl,
+                                                             int64_t               ku,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasOperation_t          trans,
                                                           int                         m,
@@ -3886,6 +5439,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgbmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          trans,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  int64_t                     kl,
+                                  int64_t                     ku,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -3951,6 +5524,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
                                             float*             y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       x,
+                                               int64_t            incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                                             hipblasOperation_t trans,
                                             int                m,
@@ -3964,6 +5550,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                                             double*            y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      x,
+                                               int64_t            incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                                             hipblasOperation_t    trans,
                                             int                   m,
@@ -3977,6 +5576,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                                             hipblasOperation_t          trans,
                                             int                         m,
@@ -3989,6 +5601,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -4059,6 +5684,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                                    hipblasOperation_t  trans,
                                                    int                 m,
@@ -4073,6 +5712,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  trans,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                                    hipblasOperation_t          trans,
                                                    int                         m,
@@ -4087,6 +5740,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          trans,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                                    hipblasOperation_t                trans,
                                                    int                               m,
@@ -4100,6 +5767,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                trans,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -4188,6 +5869,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           int                m,
@@ -4205,6 +5903,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasOperation_t    transA,
                                                           int                   m,
@@ -4222,6 +5937,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasOperation_t          transA,
                                                           int                         m,
@@ -4238,6 +5970,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -4296,6 +6046,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSger(hipblasHandle_t handle,
                                            float*          AP,
                                            int             lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSger_64(hipblasHandle_t handle,
+                                              int64_t         m,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          AP,
+                                              int64_t         lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                                            int             m,
                                            int             n,
@@ -4307,6 +6068,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                                            double*         AP,
                                            int             lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDger_64(hipblasHandle_t handle,
+                                              int64_t         m,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         AP,
+                                              int64_t         lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                                             int                   m,
                                             int                   n,
@@ -4318,6 +6090,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                                             hipblasComplex*       AP,
                                             int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru_64(hipblasHandle_t       handle,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                                             int                   m,
                                             int                   n,
@@ -4329,6 +6112,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                                             hipblasComplex*       AP,
                                             int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc_64(hipblasHandle_t       handle,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                                             int                         m,
                                             int                         n,
@@ -4340,6 +6134,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru_64(hipblasHandle_t             handle,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                                             int                         m,
                                             int                         n,
@@ -4350,6 +6155,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc_64(hipblasHandle_t             handle,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
 //! @}
 
 /*! @{
@@ -4413,6 +6229,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
                                                   int                lda,
                                                   int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerBatched_64(hipblasHandle_t    handle,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     const float* const y[],
+                                                     int64_t            incy,
+                                                     float* const       AP[],
+                                                     int64_t            lda,
+                                                     int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                                   int                 m,
                                                   int                 n,
@@ -4425,6 +6253,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                                   int                 lda,
                                                   int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched_64(hipblasHandle_t     handle,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     const double* const y[],
+                                                     int64_t             incy,
+                                                     double* const       AP[],
+                                                     int64_t             lda,
+                                                     int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                                    int                         m,
                                                    int                         n,
@@ -4437,6 +6277,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             h
                                                    int                         lda,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
                                                    int                         m,
                                                    int                         n,
@@ -4449,6 +6301,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             h
                                                    int                         lda,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
                                                    int                               m,
                                                    int                               n,
@@ -4461,6 +6325,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t
                                                    int                               lda,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                                    int                               m,
                                                    int                               n,
@@ -4473,6 +6349,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched(hipblasHandle_t
                                                    int                               lda,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
+
 //! @}
 
 /*! @{
@@ -4554,6 +6442,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
                                                          hipblasStride   strideA,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         m,
+                                                            int64_t         n,
+                                                            const float*    alpha,
+                                                            const float*    x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const float*    y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            float*          AP,
+                                                            int64_t         lda,
+                                                            hipblasStride   strideA,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                                          int             m,
                                                          int             n,
@@ -4569,6 +6472,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                                          hipblasStride   strideA,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         m,
+                                                            int64_t         n,
+                                                            const double*   alpha,
+                                                            const double*   x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const double*   y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            double*         AP,
+                                                            int64_t         lda,
+                                                            hipblasStride   strideA,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                                           int                   m,
                                                           int                   n,
@@ -4584,6 +6502,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideA,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
                                                           int                   m,
                                                           int                   n,
@@ -4599,6 +6532,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideA,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
                                                           int                         m,
                                                           int                         n,
@@ -4614,6 +6562,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgeruStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                                           int                         m,
                                                           int                         n,
@@ -4628,6 +6592,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgercStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -4720,6 +6700,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -4732,6 +6725,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -4828,6 +6834,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -4841,6 +6861,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -4949,6 +6983,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -4965,6 +7016,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhbmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5035,6 +7104,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -5046,6 +7127,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -5120,6 +7213,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -5132,6 +7238,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5219,6 +7338,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -5234,6 +7369,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhemvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5294,6 +7446,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
                                            hipblasComplex*       AP,
                                            int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const float*          alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                                            hipblasFillMode_t           uplo,
                                            int                         n,
@@ -5302,6 +7463,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP,
                                            int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const double*               alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda);
 //! @}
 
 /*! @{
@@ -5366,6 +7536,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherBatched(hipblasHandle_t             ha
                                                   int                         lda,
                                                   int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const float*                alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     lda,
+                                                     int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
                                                   hipblasFillMode_t                 uplo,
                                                   int                               n,
@@ -5375,6 +7555,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched(hipblasHandle_t
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               lda,
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const double*                     alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           lda,
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5447,6 +7637,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       h
                                                          hipblasStride         strideA,
                                                          int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const float*          alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            int64_t               lda,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
                                                          hipblasFillMode_t           uplo,
                                                          int                         n,
@@ -5458,6 +7660,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t
                                                          int                         lda,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const double*               alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            int64_t                     lda,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5525,6 +7739,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
                                             hipblasComplex*       AP,
                                             int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -5535,6 +7760,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
 //! @}
 
 /*! @{
@@ -5606,6 +7842,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             h
                                                    int                         lda,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -5617,6 +7865,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       AP[],
                                                    int                               lda,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -5700,6 +7960,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t
                                                           hipblasStride         strideA,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2StridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -5714,6 +7989,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZher2StridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -5795,6 +8086,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -5805,6 +8107,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -5891,6 +8204,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -5902,6 +8227,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -6000,6 +8337,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -6014,6 +8366,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhpmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -6086,6 +8454,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasComplex*       AP);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const float*          alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                                            hipblasFillMode_t           uplo,
                                            int                         n,
@@ -6093,6 +8469,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                                            const hipblasDoubleComplex* x,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const double*               alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP);
 //! @}
 
 /*! @{
@@ -6169,6 +8553,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChprBatched(hipblasHandle_t             ha
                                                   hipblasComplex* const       AP[],
                                                   int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChprBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const float*                alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                                   hipblasFillMode_t                 uplo,
                                                   int                               n,
@@ -6177,6 +8570,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched(hipblasHandle_t
                                                   int                               incx,
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const double*                     alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -6261,6 +8663,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       h
                                                          hipblasStride         strideA,
                                                          int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChprStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const float*          alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                                          hipblasFillMode_t           uplo,
                                                          int                         n,
@@ -6271,6 +8684,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t
                                                          hipblasDoubleComplex*       AP,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const double*               alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -6350,6 +8774,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
                                             int                   incy,
                                             hipblasComplex*       AP);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -6359,6 +8793,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* y,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP);
 //! @}
 
 /*! @{
@@ -6442,6 +8886,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             h
                                                    hipblasComplex* const       AP[],
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -6452,6 +8907,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t
                                                    int                               incy,
                                                    hipblasDoubleComplex* const       AP[],
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -6547,6 +9013,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t
                                                           hipblasStride         strideA,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -6560,6 +9040,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t
                                                           hipblasDoubleComplex*       AP,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhpr2StridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -6625,6 +9120,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                                             float*            y,
                                             int               incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               int64_t           k,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                                             hipblasFillMode_t uplo,
                                             int               n,
@@ -6637,6 +9145,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                                             const double*     beta,
                                             double*           y,
                                             int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               int64_t           k,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
 //! @}
 
 /*! @{
@@ -6709,6 +9230,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float*             y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    int                 n,
@@ -6722,6 +9257,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                                    double*             y[],
                                                    int                 incy,
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double*             y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -6812,6 +9361,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     stridey,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             int64_t           k,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      beta,
+                                                             float*            y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                                           hipblasFillMode_t uplo,
                                                           int               n,
@@ -6828,6 +9394,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   hand
                                                           int               incy,
                                                           hipblasStride     stridey,
                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             int64_t           k,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     beta,
+                                                             double*           y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -6885,6 +9468,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                                             float*            y,
                                             int               incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                                             hipblasFillMode_t uplo,
                                             int               n,
@@ -6895,6 +9489,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                                             const double*     beta,
                                             double*           y,
                                             int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
 //! @}
 
 /*! @{
@@ -6960,6 +9565,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float*             y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    int                 n,
@@ -6971,6 +9588,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                                    double*             y[],
                                                    int                 incy,
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double*             y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -7053,6 +9682,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     stridey,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      beta,
+                                                             float*            y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                                           hipblasFillMode_t uplo,
                                                           int               n,
@@ -7067,6 +9711,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   hand
                                                           int               incy,
                                                           hipblasStride     stridey,
                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     beta,
+                                                             double*           y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -7139,6 +9798,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
                                            int               incx,
                                            float*            AP);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              float*            AP);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                                            hipblasFillMode_t uplo,
                                            int               n,
@@ -7147,6 +9814,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                                            int               incx,
                                            double*           AP);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              double*           AP);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                                            hipblasFillMode_t     uplo,
                                            int                   n,
@@ -7155,6 +9830,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasComplex*       AP);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCspr_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                                            hipblasFillMode_t           uplo,
                                            int                         n,
@@ -7162,6 +9845,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                                            const hipblasDoubleComplex* x,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZspr_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP);
 //! @}
 
 /*! @{
@@ -7238,6 +9929,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                                   float* const       AP[],
                                                   int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsprBatched_64(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     float* const       AP[],
+                                                     int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                                   hipblasFillMode_t   uplo,
                                                   int                 n,
@@ -7247,6 +9947,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                                   double* const       AP[],
                                                   int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsprBatched_64(hipblasHandle_t     handle,
+                                                     hipblasFillMode_t   uplo,
+                                                     int64_t             n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     double* const       AP[],
+                                                     int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
                                                   hipblasFillMode_t           uplo,
                                                   int                         n,
@@ -7256,6 +9965,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             ha
                                                   hipblasComplex* const       AP[],
                                                   int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
                                                   hipblasFillMode_t                 uplo,
                                                   int                               n,
@@ -7264,6 +9982,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched(hipblasHandle_t
                                                   int                               incx,
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -7348,6 +10075,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handl
                                                          hipblasStride     strideA,
                                                          int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsprStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const float*      alpha,
+                                                            const float*      x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            float*            AP,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                                          hipblasFillMode_t uplo,
                                                          int               n,
@@ -7359,6 +10097,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handl
                                                          hipblasStride     strideA,
                                                          int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsprStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const double*     alpha,
+                                                            const double*     x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            double*           AP,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
                                                          hipblasFillMode_t     uplo,
                                                          int                   n,
@@ -7370,6 +10119,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       h
                                                          hipblasStride         strideA,
                                                          int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
                                                          hipblasFillMode_t           uplo,
                                                          int                         n,
@@ -7380,6 +10140,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t
                                                          hipblasDoubleComplex*       AP,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -7459,6 +10230,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
                                             int               incy,
                                             float*            AP);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      y,
+                                               int64_t           incy,
+                                               float*            AP);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                                             hipblasFillMode_t uplo,
                                             int               n,
@@ -7468,6 +10249,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                                             const double*     y,
                                             int               incy,
                                             double*           AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     y,
+                                               int64_t           incy,
+                                               double*           AP);
 //! @}
 
 /*! @{
@@ -7551,6 +10342,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                                    float* const       AP[],
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2Batched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float* const y[],
+                                                      int64_t            incy,
+                                                      float* const       AP[],
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    int                 n,
@@ -7561,6 +10363,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    double* const       AP[],
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double* const y[],
+                                                      int64_t             incy,
+                                                      double* const       AP[],
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -7656,6 +10469,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideA,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             float*            AP,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                                           hipblasFillMode_t uplo,
                                                           int               n,
@@ -7669,6 +10496,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   hand
                                                           double*           AP,
                                                           hipblasStride     strideA,
                                                           int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             double*           AP,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -7730,6 +10571,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                                             float*            y,
                                             int               incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                                             hipblasFillMode_t uplo,
                                             int               n,
@@ -7742,6 +10595,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                                             double*           y,
                                             int               incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             int                   n,
@@ -7754,6 +10619,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -7765,6 +10642,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
 //! @}
 
 /*! @{
@@ -7834,6 +10723,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float*             y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    int                 n,
@@ -7847,6 +10749,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double*             y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    int                         n,
@@ -7860,6 +10775,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex*             y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -7872,6 +10800,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex*             y[],
                                                    int                               incy,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex*             y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -7959,6 +10900,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     stridey,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      beta,
+                                                             float*            y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                                           hipblasFillMode_t uplo,
                                                           int               n,
@@ -7975,6 +10932,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     stridey,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     beta,
+                                                             double*           y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           int                   n,
@@ -7991,6 +10964,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -8006,6 +10995,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t
                                                           int                         incy,
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsymvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -8059,6 +11065,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
                                            float*            AP,
                                            int               lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const float*      alpha,
+                                              const float*      x,
+                                              int64_t           incx,
+                                              float*            AP,
+                                              int64_t           lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                                            hipblasFillMode_t uplo,
                                            int               n,
@@ -8068,6 +11083,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                                            double*           AP,
                                            int               lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr_64(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int64_t           n,
+                                              const double*     alpha,
+                                              const double*     x,
+                                              int64_t           incx,
+                                              double*           AP,
+                                              int64_t           lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                                            hipblasFillMode_t     uplo,
                                            int                   n,
@@ -8077,6 +11101,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                                            hipblasComplex*       AP,
                                            int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr_64(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasComplex*       AP,
+                                              int64_t               lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                                            hipblasFillMode_t           uplo,
                                            int                         n,
@@ -8085,6 +11118,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP,
                                            int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr_64(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       AP,
+                                              int64_t                     lda);
 //! @}
 
 /*! @{
@@ -8141,6 +11183,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                                   int                lda,
                                                   int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrBatched_64(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     int64_t            n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     float* const       AP[],
+                                                     int64_t            lda,
+                                                     int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                                   hipblasFillMode_t   uplo,
                                                   int                 n,
@@ -8151,6 +11203,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                                   int                 lda,
                                                   int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrBatched_64(hipblasHandle_t     handle,
+                                                     hipblasFillMode_t   uplo,
+                                                     int64_t             n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     double* const       AP[],
+                                                     int64_t             lda,
+                                                     int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                                   hipblasFillMode_t           uplo,
                                                   int                         n,
@@ -8161,6 +11223,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             ha
                                                   int                         lda,
                                                   int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched_64(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     int64_t                     n,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasComplex* const       AP[],
+                                                     int64_t                     lda,
+                                                     int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                                   hipblasFillMode_t                 uplo,
                                                   int                               n,
@@ -8170,6 +11242,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               lda,
                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched_64(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int64_t                           n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int64_t                           incx,
+                                                     hipblasDoubleComplex* const       AP[],
+                                                     int64_t                           lda,
+                                                     int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -8234,6 +11316,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handl
                                                          hipblasStride     strideA,
                                                          int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const float*      alpha,
+                                                            const float*      x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            float*            AP,
+                                                            int64_t           lda,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                                          hipblasFillMode_t uplo,
                                                          int               n,
@@ -8246,6 +11340,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handl
                                                          hipblasStride     strideA,
                                                          int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrStridedBatched_64(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int64_t           n,
+                                                            const double*     alpha,
+                                                            const double*     x,
+                                                            int64_t           incx,
+                                                            hipblasStride     stridex,
+                                                            double*           AP,
+                                                            int64_t           lda,
+                                                            hipblasStride     strideA,
+                                                            int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                                          hipblasFillMode_t     uplo,
                                                          int                   n,
@@ -8258,6 +11364,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       h
                                                          hipblasStride         strideA,
                                                          int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrStridedBatched_64(hipblasHandle_t       handle,
+                                                            hipblasFillMode_t     uplo,
+                                                            int64_t               n,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       AP,
+                                                            int64_t               lda,
+                                                            hipblasStride         strideA,
+                                                            int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                                          hipblasFillMode_t           uplo,
                                                          int                         n,
@@ -8269,6 +11387,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t
                                                          int                         lda,
                                                          hipblasStride               strideA,
                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched_64(hipblasHandle_t             handle,
+                                                            hipblasFillMode_t           uplo,
+                                                            int64_t                     n,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       AP,
+                                                            int64_t                     lda,
+                                                            hipblasStride               strideA,
+                                                            int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -8329,6 +11459,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
                                             float*            AP,
                                             int               lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      y,
+                                               int64_t           incy,
+                                               float*            AP,
+                                               int64_t           lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                                             hipblasFillMode_t uplo,
                                             int               n,
@@ -8340,6 +11481,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                                             double*           AP,
                                             int               lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     y,
+                                               int64_t           incy,
+                                               double*           AP,
+                                               int64_t           lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             int                   n,
@@ -8351,6 +11503,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                                             hipblasComplex*       AP,
                                             int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
@@ -8361,6 +11524,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       AP,
                                             int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda);
 //! @}
 
 /*! @{
@@ -8424,6 +11598,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                                    int                lda,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2Batched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float* const y[],
+                                                      int64_t            incy,
+                                                      float* const       AP[],
+                                                      int64_t            lda,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    int                 n,
@@ -8436,6 +11622,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                                    int                 lda,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2Batched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double* const y[],
+                                                      int64_t             incy,
+                                                      double* const       AP[],
+                                                      int64_t             lda,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    int                         n,
@@ -8448,6 +11646,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             h
                                                    int                         lda,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2Batched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      hipblasComplex* const       AP[],
+                                                      int64_t                     lda,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
@@ -8459,6 +11669,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       AP[],
                                                    int                               lda,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      hipblasDoubleComplex* const       AP[],
+                                                      int64_t                           lda,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -8534,6 +11756,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideA,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const float*      y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             float*            AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                                           hipblasFillMode_t uplo,
                                                           int               n,
@@ -8549,6 +11786,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideA,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2StridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const double*     y,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             double*           AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           int                   n,
@@ -8564,6 +11816,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t
                                                           hipblasStride         strideA,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2StridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
@@ -8578,6 +11845,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyr2StridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -8669,6 +11952,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
                                             float*             x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            k,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -8680,6 +11974,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                                             double*            x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            k,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -8691,6 +11996,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                                             hipblasComplex*       x,
                                             int                   incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               k,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -8701,6 +12017,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -8797,6 +12124,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                                    int                incx,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            k,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -8809,6 +12148,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                                    int                 incx,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      int64_t             k,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -8821,6 +12172,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      int64_t                     k,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -8832,6 +12195,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -8936,6 +12311,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            k,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -8950,6 +12339,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            k,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -8964,6 +12367,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             int64_t               k,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -8977,6 +12394,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtbmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -9052,6 +12484,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                                             float*             x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -9063,6 +12506,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                                             double*            x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -9074,6 +12528,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                                             hipblasComplex*       x,
                                             int                   incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -9084,6 +12549,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -9166,6 +12642,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                                    int                incx,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -9178,6 +12666,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                                    int                 incx,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -9190,6 +12690,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -9201,6 +12713,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9290,6 +12814,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -9304,6 +12842,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -9318,6 +12870,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -9331,6 +12897,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtbsvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -9401,6 +12982,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                                             float*             x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               float*             x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -9410,6 +13000,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                                             double*            x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               double*            x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -9419,6 +13018,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                                             hipblasComplex*       x,
                                             int                   incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -9427,6 +13035,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* AP,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -9493,6 +13110,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                                    int                incx,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -9503,6 +13130,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                                    int                 incx,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -9513,6 +13150,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -9522,6 +13169,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9599,6 +13256,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -9611,6 +13280,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -9623,6 +13304,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -9634,6 +13327,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtpmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -9698,6 +13404,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                                             float*             x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               float*             x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -9707,6 +13422,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                                             double*            x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               double*            x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -9716,6 +13440,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                                             hipblasComplex*       x,
                                             int                   incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -9724,6 +13457,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* AP,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -9793,6 +13535,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                                    int                incx,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -9803,6 +13555,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                                    int                 incx,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -9813,6 +13575,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -9822,6 +13594,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -9900,6 +13682,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -9912,6 +13706,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -9924,6 +13730,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -9935,6 +13753,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtpsvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -10001,6 +13832,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                                             float*             x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -10011,6 +13852,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                                             double*            x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -10021,6 +13872,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                                             hipblasComplex*       x,
                                             int                   incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -10030,6 +13891,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -10102,6 +13973,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                                    int                incx,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -10113,6 +13995,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                                    int                 incx,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -10124,6 +14017,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -10134,6 +14038,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -10217,6 +14132,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -10230,6 +14158,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -10243,6 +14184,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -10255,6 +14209,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrmvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -10321,6 +14289,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                                             float*             x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -10331,6 +14309,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                                             double*            x,
                                             int                incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -10341,6 +14329,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                                             hipblasComplex*       x,
                                             int                   incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -10350,6 +14348,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
 //! @}
 
 /*! @{
@@ -10422,6 +14430,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                                    int                incx,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -10433,6 +14452,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                                    int                 incx,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -10444,6 +14474,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -10454,6 +14495,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       x[],
+                                                      int64_t                           incx,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -10535,6 +14587,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -10548,6 +14613,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -10561,6 +14639,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -10573,6 +14664,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t
                                                           int                         incx,
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrsvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
 //! @}
 
 /*
@@ -10657,6 +14762,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
                                             hipblasHalf*       CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const hipblasHalf* alpha,
+                                               const hipblasHalf* AP,
+                                               int64_t            lda,
+                                               const hipblasHalf* BP,
+                                               int64_t            ldb,
+                                               const hipblasHalf* beta,
+                                               hipblasHalf*       CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                                             hipblasOperation_t transA,
                                             hipblasOperation_t transB,
@@ -10672,6 +14792,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                                             float*             CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                                             hipblasOperation_t transA,
                                             hipblasOperation_t transB,
@@ -10687,6 +14822,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                                             double*            CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                                             hipblasOperation_t    transA,
                                             hipblasOperation_t    transB,
@@ -10702,6 +14852,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                                             hipblasOperation_t          transA,
                                             hipblasOperation_t          transB,
@@ -10716,6 +14881,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transA,
+                                               hipblasOperation_t          transB,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -10794,6 +14974,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          hand
                                                    int                      ldc,
                                                    int                      batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched_64(hipblasHandle_t          handle,
+                                                      hipblasOperation_t       transA,
+                                                      hipblasOperation_t       transB,
+                                                      int64_t                  m,
+                                                      int64_t                  n,
+                                                      int64_t                  k,
+                                                      const hipblasHalf*       alpha,
+                                                      const hipblasHalf* const AP[],
+                                                      int64_t                  lda,
+                                                      const hipblasHalf* const BP[],
+                                                      int64_t                  ldb,
+                                                      const hipblasHalf*       beta,
+                                                      hipblasHalf* const       CP[],
+                                                      int64_t                  ldc,
+                                                      int64_t                  batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                                    hipblasOperation_t transA,
                                                    hipblasOperation_t transB,
@@ -10810,6 +15006,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                                    int                ldc,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                                    hipblasOperation_t  transA,
                                                    hipblasOperation_t  transB,
@@ -10826,6 +15038,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                                    int                 ldc,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
                                                    hipblasOperation_t          transA,
                                                    hipblasOperation_t          transB,
@@ -10842,6 +15070,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
                                                    hipblasOperation_t                transA,
                                                    hipblasOperation_t                transB,
@@ -10857,6 +15101,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -10953,6 +15213,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    han
                                                           long long          strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const hipblasHalf* alpha,
+                                                             const hipblasHalf* AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const hipblasHalf* BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const hipblasHalf* beta,
+                                                             hipblasHalf*       CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           hipblasOperation_t transB,
@@ -10972,6 +15251,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    han
                                                           long long          strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const float*       BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const float*       beta,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           hipblasOperation_t transB,
@@ -10991,6 +15289,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    han
                                                           long long          strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const double*      BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const double*      beta,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasOperation_t    transA,
                                                           hipblasOperation_t    transB,
@@ -11010,6 +15327,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t
                                                           long long             strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             long long             strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             long long             strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             long long             strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasOperation_t          transA,
                                                           hipblasOperation_t          transB,
@@ -11028,6 +15364,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           long long                   strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  hipblasOperation_t          transB,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  long long                   strideA,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  long long                   strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  long long                   strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -11114,6 +15470,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherk_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const float*          alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const float*          beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -11125,6 +15493,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                                             const double*               beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherk_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const double*               alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const double*               beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -11214,6 +15594,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const float*                alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const float*                beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -11226,6 +15619,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const double*                     alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const double*                     beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -11326,6 +15732,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const float*          alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const float*          beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -11340,6 +15761,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZherkStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const double*               alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const double*               beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -11439,6 +15876,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                                              hipblasComplex*       CP,
                                              int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkx_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const float*          beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                                              hipblasFillMode_t           uplo,
                                              hipblasOperation_t          transA,
@@ -11452,6 +15903,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                                              const double*               beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkx_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const double*               beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -11555,6 +16020,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherkxBatched(hipblasHandle_t
                                                     int                         ldc,
                                                     int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkxBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const float*                beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
                                                     hipblasFillMode_t                 uplo,
                                                     hipblasOperation_t                transA,
@@ -11569,6 +16049,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZherkxBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const double*                     beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -11687,6 +16183,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCherkxStridedBatched(hipblasHandle_t
                                                            hipblasStride         strideC,
                                                            int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkxStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const float*          beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
                                                            hipblasFillMode_t           uplo,
                                                            hipblasOperation_t          transA,
@@ -11704,6 +16218,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZherkxStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const double*               beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -11800,6 +16333,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2k(hipblasHandle_t       handle,
                                              hipblasComplex*       CP,
                                              int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2k_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const float*          beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                                              hipblasFillMode_t           uplo,
                                              hipblasOperation_t          transA,
@@ -11813,6 +16360,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                                              const double*               beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2k_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const double*               beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -11912,6 +16473,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2kBatched(hipblasHandle_t
                                                     int                         ldc,
                                                     int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2kBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const float*                beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
                                                     hipblasFillMode_t                 uplo,
                                                     hipblasOperation_t                transA,
@@ -11926,6 +16502,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZher2kBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const double*                     beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -12043,6 +16635,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2kStridedBatched(hipblasHandle_t
                                                            hipblasStride         strideC,
                                                            int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2kStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const float*          beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
                                                            hipblasFillMode_t           uplo,
                                                            hipblasOperation_t          transA,
@@ -12060,6 +16670,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZher2kStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const double*               beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -12154,6 +16783,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymm(hipblasHandle_t   handle,
                                             float*            CP,
                                             int               ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      BP,
+                                               int64_t           ldb,
+                                               const float*      beta,
+                                               float*            CP,
+                                               int64_t           ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
                                             hipblasSideMode_t side,
                                             hipblasFillMode_t uplo,
@@ -12168,6 +16811,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
                                             double*           CP,
                                             int               ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     BP,
+                                               int64_t           ldb,
+                                               const double*     beta,
+                                               double*           CP,
+                                               int64_t           ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
                                             hipblasFillMode_t     uplo,
@@ -12182,6 +16839,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
@@ -12195,6 +16866,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -12294,6 +16979,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
                                                    int                ldc,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                                    hipblasSideMode_t   side,
                                                    hipblasFillMode_t   uplo,
@@ -12309,6 +17009,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                                    int                 ldc,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      hipblasFillMode_t   uplo,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
                                                    hipblasSideMode_t           side,
                                                    hipblasFillMode_t           uplo,
@@ -12324,6 +17039,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
                                                    hipblasSideMode_t                 side,
                                                    hipblasFillMode_t                 uplo,
@@ -12338,6 +17068,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -12449,6 +17194,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideC,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const float*      alpha,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      BP,
+                                                             int64_t           ldb,
+                                                             hipblasStride     strideB,
+                                                             const float*      beta,
+                                                             float*            CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
                                                           hipblasSideMode_t side,
                                                           hipblasFillMode_t uplo,
@@ -12467,6 +17230,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideC,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             hipblasFillMode_t uplo,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const double*     alpha,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     BP,
+                                                             int64_t           ldb,
+                                                             hipblasStride     strideB,
+                                                             const double*     beta,
+                                                             double*           CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasSideMode_t     side,
                                                           hipblasFillMode_t     uplo,
@@ -12485,6 +17266,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           hipblasFillMode_t           uplo,
@@ -12502,6 +17301,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsymmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -12591,6 +17409,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                                             float*             CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -12603,6 +17433,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
                                             double*            CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -12615,6 +17457,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -12626,6 +17480,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -12718,6 +17584,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
                                                    int                ldc,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkBatched_64(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
@@ -12731,6 +17610,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                                    int                 ldc,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatched_64(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
@@ -12744,6 +17636,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatched_64(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
@@ -12756,6 +17661,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -12859,6 +17777,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       beta,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -12874,6 +17807,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      beta,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -12889,6 +17837,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -12903,6 +17866,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyrkStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -12999,6 +17978,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                                              float*             CP,
                                              int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2k_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const float*       alpha,
+                                                const float*       AP,
+                                                int64_t            lda,
+                                                const float*       BP,
+                                                int64_t            ldb,
+                                                const float*       beta,
+                                                float*             CP,
+                                                int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2k(hipblasHandle_t    handle,
                                              hipblasFillMode_t  uplo,
                                              hipblasOperation_t transA,
@@ -13013,6 +18006,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2k(hipblasHandle_t    handle,
                                              double*            CP,
                                              int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2k_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const double*      alpha,
+                                                const double*      AP,
+                                                int64_t            lda,
+                                                const double*      BP,
+                                                int64_t            ldb,
+                                                const double*      beta,
+                                                double*            CP,
+                                                int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2k(hipblasHandle_t       handle,
                                              hipblasFillMode_t     uplo,
                                              hipblasOperation_t    transA,
@@ -13027,6 +18034,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2k(hipblasHandle_t       handle,
                                              hipblasComplex*       CP,
                                              int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2k_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                                              hipblasFillMode_t           uplo,
                                              hipblasOperation_t          transA,
@@ -13040,6 +18061,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                                              const hipblasDoubleComplex* beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2k_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -13137,6 +18172,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2kBatched(hipblasHandle_t    handle,
                                                     int                ldc,
                                                     int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2kBatched_64(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       int64_t            n,
+                                                       int64_t            k,
+                                                       const float*       alpha,
+                                                       const float* const AP[],
+                                                       int64_t            lda,
+                                                       const float* const BP[],
+                                                       int64_t            ldb,
+                                                       const float*       beta,
+                                                       float* const       CP[],
+                                                       int64_t            ldc,
+                                                       int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                                     hipblasFillMode_t   uplo,
                                                     hipblasOperation_t  transA,
@@ -13152,6 +18202,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                                     int                 ldc,
                                                     int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kBatched_64(hipblasHandle_t     handle,
+                                                       hipblasFillMode_t   uplo,
+                                                       hipblasOperation_t  transA,
+                                                       int64_t             n,
+                                                       int64_t             k,
+                                                       const double*       alpha,
+                                                       const double* const AP[],
+                                                       int64_t             lda,
+                                                       const double* const BP[],
+                                                       int64_t             ldb,
+                                                       const double*       beta,
+                                                       double* const       CP[],
+                                                       int64_t             ldc,
+                                                       int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
                                                     hipblasFillMode_t           uplo,
                                                     hipblasOperation_t          transA,
@@ -13167,6 +18232,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t
                                                     int                         ldc,
                                                     int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const hipblasComplex*       beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
                                                     hipblasFillMode_t                 uplo,
                                                     hipblasOperation_t                transA,
@@ -13181,6 +18261,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyr2kBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const hipblasDoubleComplex*       beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -13297,6 +18393,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2kStridedBatched(hipblasHandle_t    ha
                                                            hipblasStride      strideC,
                                                            int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2kStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const float*       alpha,
+                                                              const float*       AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const float*       BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const float*       beta,
+                                                              float*             CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
                                                            hipblasFillMode_t  uplo,
                                                            hipblasOperation_t transA,
@@ -13315,6 +18429,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    ha
                                                            hipblasStride      strideC,
                                                            int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2kStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const double*      alpha,
+                                                              const double*      AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const double*      BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const double*      beta,
+                                                              double*            CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
                                                            hipblasFillMode_t     uplo,
                                                            hipblasOperation_t    transA,
@@ -13333,6 +18465,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t
                                                            hipblasStride         strideC,
                                                            int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2kStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const hipblasComplex* beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
                                                            hipblasFillMode_t           uplo,
                                                            hipblasOperation_t          transA,
@@ -13350,6 +18500,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyr2kStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const hipblasDoubleComplex* beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -13449,6 +18618,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkx(hipblasHandle_t    handle,
                                              float*             CP,
                                              int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkx_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const float*       alpha,
+                                                const float*       AP,
+                                                int64_t            lda,
+                                                const float*       BP,
+                                                int64_t            ldb,
+                                                const float*       beta,
+                                                float*             CP,
+                                                int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkx(hipblasHandle_t    handle,
                                              hipblasFillMode_t  uplo,
                                              hipblasOperation_t transA,
@@ -13463,6 +18646,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkx(hipblasHandle_t    handle,
                                              double*            CP,
                                              int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkx_64(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const double*      alpha,
+                                                const double*      AP,
+                                                int64_t            lda,
+                                                const double*      BP,
+                                                int64_t            ldb,
+                                                const double*      beta,
+                                                double*            CP,
+                                                int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkx(hipblasHandle_t       handle,
                                              hipblasFillMode_t     uplo,
                                              hipblasOperation_t    transA,
@@ -13477,6 +18674,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkx(hipblasHandle_t       handle,
                                              hipblasComplex*       CP,
                                              int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkx_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasOperation_t    transA,
+                                                int64_t               n,
+                                                int64_t               k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                const hipblasComplex* BP,
+                                                int64_t               ldb,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       CP,
+                                                int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                                              hipblasFillMode_t           uplo,
                                              hipblasOperation_t          transA,
@@ -13490,6 +18701,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                                              const hipblasDoubleComplex* beta,
                                              hipblasDoubleComplex*       CP,
                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkx_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasOperation_t          transA,
+                                                int64_t                     n,
+                                                int64_t                     k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                const hipblasDoubleComplex* BP,
+                                                int64_t                     ldb,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       CP,
+                                                int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -13592,6 +18817,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkxBatched(hipblasHandle_t    handle,
                                                     int                ldc,
                                                     int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkxBatched_64(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       int64_t            n,
+                                                       int64_t            k,
+                                                       const float*       alpha,
+                                                       const float* const AP[],
+                                                       int64_t            lda,
+                                                       const float* const BP[],
+                                                       int64_t            ldb,
+                                                       const float*       beta,
+                                                       float* const       CP[],
+                                                       int64_t            ldc,
+                                                       int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                                     hipblasFillMode_t   uplo,
                                                     hipblasOperation_t  transA,
@@ -13607,6 +18847,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                                     int                 ldc,
                                                     int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxBatched_64(hipblasHandle_t     handle,
+                                                       hipblasFillMode_t   uplo,
+                                                       hipblasOperation_t  transA,
+                                                       int64_t             n,
+                                                       int64_t             k,
+                                                       const double*       alpha,
+                                                       const double* const AP[],
+                                                       int64_t             lda,
+                                                       const double* const BP[],
+                                                       int64_t             ldb,
+                                                       const double*       beta,
+                                                       double* const       CP[],
+                                                       int64_t             ldc,
+                                                       int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
                                                     hipblasFillMode_t           uplo,
                                                     hipblasOperation_t          transA,
@@ -13622,6 +18877,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t
                                                     int                         ldc,
                                                     int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasOperation_t          transA,
+                                                       int64_t                     n,
+                                                       int64_t                     k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       const hipblasComplex* const BP[],
+                                                       int64_t                     ldb,
+                                                       const hipblasComplex*       beta,
+                                                       hipblasComplex* const       CP[],
+                                                       int64_t                     ldc,
+                                                       int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
                                                     hipblasFillMode_t                 uplo,
                                                     hipblasOperation_t                transA,
@@ -13636,6 +18906,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const       CP[],
                                                     int                               ldc,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyrkxBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasOperation_t                transA,
+                            int64_t                           n,
+                            int64_t                           k,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            const hipblasDoubleComplex* const BP[],
+                            int64_t                           ldb,
+                            const hipblasDoubleComplex*       beta,
+                            hipblasDoubleComplex* const       CP[],
+                            int64_t                           ldc,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -13753,6 +19039,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkxStridedBatched(hipblasHandle_t    ha
                                                            hipblasStride      strideC,
                                                            int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkxStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const float*       alpha,
+                                                              const float*       AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const float*       BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const float*       beta,
+                                                              float*             CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
                                                            hipblasFillMode_t  uplo,
                                                            hipblasOperation_t transA,
@@ -13771,6 +19075,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    ha
                                                            hipblasStride      strideC,
                                                            int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkxStridedBatched_64(hipblasHandle_t    handle,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const double*      alpha,
+                                                              const double*      AP,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const double*      BP,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const double*      beta,
+                                                              double*            CP,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
                                                            hipblasFillMode_t     uplo,
                                                            hipblasOperation_t    transA,
@@ -13789,6 +19111,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t
                                                            hipblasStride         strideC,
                                                            int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkxStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasOperation_t    transA,
+                                                              int64_t               n,
+                                                              int64_t               k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              const hipblasComplex* BP,
+                                                              int64_t               ldb,
+                                                              hipblasStride         strideB,
+                                                              const hipblasComplex* beta,
+                                                              hipblasComplex*       CP,
+                                                              int64_t               ldc,
+                                                              hipblasStride         strideC,
+                                                              int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
                                                            hipblasFillMode_t           uplo,
                                                            hipblasOperation_t          transA,
@@ -13806,6 +19146,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t
                                                            int                         ldc,
                                                            hipblasStride               strideC,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZsyrkxStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int64_t                     n,
+                                   int64_t                     k,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   const hipblasDoubleComplex* BP,
+                                   int64_t                     ldb,
+                                   hipblasStride               strideB,
+                                   const hipblasDoubleComplex* beta,
+                                   hipblasDoubleComplex*       CP,
+                                   int64_t                     ldc,
+                                   hipblasStride               strideC,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -13879,6 +19238,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
                                             float*             CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeam_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       beta,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               float*             CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                                             hipblasOperation_t transA,
                                             hipblasOperation_t transB,
@@ -13893,6 +19266,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                                             double*            CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      beta,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               double*            CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
                                             hipblasOperation_t    transA,
                                             hipblasOperation_t    transB,
@@ -13907,6 +19294,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* beta,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                                             hipblasOperation_t          transA,
                                             hipblasOperation_t          transB,
@@ -13920,6 +19321,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                                             int                         ldb,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transA,
+                                               hipblasOperation_t          transB,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* beta,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -14002,6 +19417,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
                                                    int                ldc,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float*       beta,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                                    hipblasOperation_t  transA,
                                                    hipblasOperation_t  transB,
@@ -14017,6 +19447,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                                    int                 ldc,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double*       beta,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
                                                    hipblasOperation_t          transA,
                                                    hipblasOperation_t          transB,
@@ -14032,6 +19477,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex*       beta,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
                                                    hipblasOperation_t                transA,
                                                    hipblasOperation_t                transB,
@@ -14046,6 +19506,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -14156,6 +19631,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       beta,
+                                                             const float*       BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           hipblasOperation_t transB,
@@ -14174,6 +19667,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      beta,
+                                                             const double*      BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
                                                           hipblasOperation_t    transA,
                                                           hipblasOperation_t    transB,
@@ -14192,6 +19703,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* beta,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
                                                           hipblasOperation_t          transA,
                                                           hipblasOperation_t          transB,
@@ -14209,6 +19738,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgeamStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  hipblasOperation_t          transB,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* beta,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -14304,6 +19852,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
@@ -14317,6 +19879,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -14417,6 +19993,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                                    hipblasSideMode_t                 side,
                                                    hipblasFillMode_t                 uplo,
@@ -14431,6 +20022,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -14546,6 +20152,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           hipblasFillMode_t           uplo,
@@ -14563,6 +20187,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZhemmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 // clang-format off
@@ -14682,6 +20325,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
                                             float*             BP,
                                             int                ldb);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               float*             BP,
+                                               int64_t            ldb);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                                             hipblasSideMode_t  side,
                                             hipblasFillMode_t  uplo,
@@ -14695,6 +20351,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                                             double*            BP,
                                             int                ldb);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               double*            BP,
+                                               int64_t            ldb);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
                                             hipblasFillMode_t     uplo,
@@ -14708,6 +20377,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                                             hipblasComplex*       BP,
                                             int                   ldb);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       BP,
+                                               int64_t               ldb);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
@@ -14720,6 +20402,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       BP,
                                             int                         ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       BP,
+                                               int64_t                     ldb);
 //! @}
 
 /*! @{
@@ -14836,6 +20531,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                                    int                ldb,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      float* const       BP[],
+                                                      int64_t            ldb,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                                    hipblasSideMode_t   side,
                                                    hipblasFillMode_t   uplo,
@@ -14850,6 +20559,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                                    int                 ldb,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasDiagType_t   diag,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      double* const       BP[],
+                                                      int64_t             ldb,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                                    hipblasSideMode_t           side,
                                                    hipblasFillMode_t           uplo,
@@ -14864,6 +20587,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             h
                                                    int                         ldb,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasComplex* const       BP[],
+                                                      int64_t                     ldb,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
                                                    hipblasSideMode_t                 side,
                                                    hipblasFillMode_t                 uplo,
@@ -14877,6 +20614,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       BP[],
                                                    int                               ldb,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasDiagType_t                 diag,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      hipblasDoubleComplex* const       BP[],
+                                                      int64_t                           ldb,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -15002,6 +20753,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideB,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasSideMode_t  side,
                                                           hipblasFillMode_t  uplo,
@@ -15018,6 +20785,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideB,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasSideMode_t     side,
                                                           hipblasFillMode_t     uplo,
@@ -15034,6 +20817,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideB,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           hipblasFillMode_t           uplo,
@@ -15049,6 +20848,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
                                                           int                         ldb,
                                                           hipblasStride               strideB,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrmmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -15155,6 +20971,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                                             float*             BP,
                                             int                ldb);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               float*             AP,
+                                               int64_t            lda,
+                                               float*             BP,
+                                               int64_t            ldb);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                                             hipblasSideMode_t  side,
                                             hipblasFillMode_t  uplo,
@@ -15168,6 +20997,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                                             double*            BP,
                                             int                ldb);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               double*            AP,
+                                               int64_t            lda,
+                                               double*            BP,
+                                               int64_t            ldb);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
                                             hipblasFillMode_t     uplo,
@@ -15181,6 +21023,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                                             hipblasComplex*       BP,
                                             int                   ldb);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       AP,
+                                               int64_t               lda,
+                                               hipblasComplex*       BP,
+                                               int64_t               ldb);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
@@ -15193,6 +21048,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                                             int                         lda,
                                             hipblasDoubleComplex*       BP,
                                             int                         ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       AP,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       BP,
+                                               int64_t                     ldb);
 //! @}
 
 /*! @{
@@ -15287,6 +21155,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
                                                    int                ldb,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      float* const       AP[],
+                                                      int64_t            lda,
+                                                      float*             BP[],
+                                                      int64_t            ldb,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
                                                    hipblasSideMode_t  side,
                                                    hipblasFillMode_t  uplo,
@@ -15301,6 +21183,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
                                                    int                ldb,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const double*      alpha,
+                                                      double* const      AP[],
+                                                      int64_t            lda,
+                                                      double*            BP[],
+                                                      int64_t            ldb,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
                                                    hipblasSideMode_t     side,
                                                    hipblasFillMode_t     uplo,
@@ -15315,6 +21211,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
                                                    int                   ldb,
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatched_64(hipblasHandle_t       handle,
+                                                      hipblasSideMode_t     side,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      hipblasDiagType_t     diag,
+                                                      int64_t               m,
+                                                      int64_t               n,
+                                                      const hipblasComplex* alpha,
+                                                      hipblasComplex* const AP[],
+                                                      int64_t               lda,
+                                                      hipblasComplex*       BP[],
+                                                      int64_t               ldb,
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
                                                    hipblasSideMode_t           side,
                                                    hipblasFillMode_t           uplo,
@@ -15328,6 +21238,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             h
                                                    hipblasDoubleComplex*       BP[],
                                                    int                         ldb,
                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      hipblasDoubleComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      hipblasDoubleComplex*       BP[],
+                                                      int64_t                     ldb,
+                                                      int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -15431,6 +21355,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideB,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             float*             AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             float*             BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasSideMode_t  side,
                                                           hipblasFillMode_t  uplo,
@@ -15447,6 +21387,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideB,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             double*            AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             double*            BP,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasSideMode_t     side,
                                                           hipblasFillMode_t     uplo,
@@ -15463,6 +21419,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideB,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex*       AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       BP,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           hipblasFillMode_t           uplo,
@@ -15478,6 +21450,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t
                                                           int                         ldb,
                                                           hipblasStride               strideB,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrsmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  hipblasDoubleComplex*       AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  hipblasDoubleComplex*       BP,
+                                  int64_t                     ldb,
+                                  hipblasStride               strideB,
+                                  int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -15528,6 +21517,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                                              float*            invA,
                                              int               ldinvA);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtri_64(hipblasHandle_t   handle,
+                                                hipblasFillMode_t uplo,
+                                                hipblasDiagType_t diag,
+                                                int64_t           n,
+                                                const float*      AP,
+                                                int64_t           lda,
+                                                float*            invA,
+                                                int64_t           ldinvA);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
                                              hipblasFillMode_t uplo,
                                              hipblasDiagType_t diag,
@@ -15537,6 +21535,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
                                              double*           invA,
                                              int               ldinvA);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtri_64(hipblasHandle_t   handle,
+                                                hipblasFillMode_t uplo,
+                                                hipblasDiagType_t diag,
+                                                int64_t           n,
+                                                const double*     AP,
+                                                int64_t           lda,
+                                                double*           invA,
+                                                int64_t           ldinvA);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
                                              hipblasFillMode_t     uplo,
                                              hipblasDiagType_t     diag,
@@ -15546,6 +21553,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
                                              hipblasComplex*       invA,
                                              int                   ldinvA);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtri_64(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                hipblasDiagType_t     diag,
+                                                int64_t               n,
+                                                const hipblasComplex* AP,
+                                                int64_t               lda,
+                                                hipblasComplex*       invA,
+                                                int64_t               ldinvA);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
                                              hipblasFillMode_t           uplo,
                                              hipblasDiagType_t           diag,
@@ -15554,6 +21570,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
                                              int                         lda,
                                              hipblasDoubleComplex*       invA,
                                              int                         ldinvA);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtri_64(hipblasHandle_t             handle,
+                                                hipblasFillMode_t           uplo,
+                                                hipblasDiagType_t           diag,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* AP,
+                                                int64_t                     lda,
+                                                hipblasDoubleComplex*       invA,
+                                                int64_t                     ldinvA);
 //! @}
 
 /*! @{
@@ -15611,6 +21636,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
                                                     int                ldinvA,
                                                     int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriBatched_64(hipblasHandle_t    handle,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasDiagType_t  diag,
+                                                       int64_t            n,
+                                                       const float* const AP[],
+                                                       int64_t            lda,
+                                                       float*             invA[],
+                                                       int64_t            ldinvA,
+                                                       int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
                                                     hipblasFillMode_t   uplo,
                                                     hipblasDiagType_t   diag,
@@ -15621,6 +21656,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
                                                     int                 ldinvA,
                                                     int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriBatched_64(hipblasHandle_t     handle,
+                                                       hipblasFillMode_t   uplo,
+                                                       hipblasDiagType_t   diag,
+                                                       int64_t             n,
+                                                       const double* const AP[],
+                                                       int64_t             lda,
+                                                       double*             invA[],
+                                                       int64_t             ldinvA,
+                                                       int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
                                                     hipblasFillMode_t           uplo,
                                                     hipblasDiagType_t           diag,
@@ -15631,6 +21676,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t
                                                     int                         ldinvA,
                                                     int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriBatched_64(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       hipblasDiagType_t           diag,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const AP[],
+                                                       int64_t                     lda,
+                                                       hipblasComplex*             invA[],
+                                                       int64_t                     ldinvA,
+                                                       int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
                                                     hipblasFillMode_t                 uplo,
                                                     hipblasDiagType_t                 diag,
@@ -15640,6 +21695,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t
                                                     hipblasDoubleComplex*             invA[],
                                                     int                               ldinvA,
                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrtriBatched_64(hipblasHandle_t                   handle,
+                            hipblasFillMode_t                 uplo,
+                            hipblasDiagType_t                 diag,
+                            int64_t                           n,
+                            const hipblasDoubleComplex* const AP[],
+                            int64_t                           lda,
+                            hipblasDoubleComplex*             invA[],
+                            int64_t                           ldinvA,
+                            int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -15705,6 +21771,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   han
                                                            hipblasStride     stride_invA,
                                                            int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriStridedBatched_64(hipblasHandle_t   handle,
+                                                              hipblasFillMode_t uplo,
+                                                              hipblasDiagType_t diag,
+                                                              int64_t           n,
+                                                              const float*      AP,
+                                                              int64_t           lda,
+                                                              hipblasStride     strideA,
+                                                              float*            invA,
+                                                              int64_t           ldinvA,
+                                                              hipblasStride     stride_invA,
+                                                              int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
                                                            hipblasFillMode_t uplo,
                                                            hipblasDiagType_t diag,
@@ -15717,6 +21795,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   han
                                                            hipblasStride     stride_invA,
                                                            int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriStridedBatched_64(hipblasHandle_t   handle,
+                                                              hipblasFillMode_t uplo,
+                                                              hipblasDiagType_t diag,
+                                                              int64_t           n,
+                                                              const double*     AP,
+                                                              int64_t           lda,
+                                                              hipblasStride     strideA,
+                                                              double*           invA,
+                                                              int64_t           ldinvA,
+                                                              hipblasStride     stride_invA,
+                                                              int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
                                                            hipblasFillMode_t     uplo,
                                                            hipblasDiagType_t     diag,
@@ -15729,6 +21819,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t
                                                            hipblasStride         stride_invA,
                                                            int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriStridedBatched_64(hipblasHandle_t       handle,
+                                                              hipblasFillMode_t     uplo,
+                                                              hipblasDiagType_t     diag,
+                                                              int64_t               n,
+                                                              const hipblasComplex* AP,
+                                                              int64_t               lda,
+                                                              hipblasStride         strideA,
+                                                              hipblasComplex*       invA,
+                                                              int64_t               ldinvA,
+                                                              hipblasStride         stride_invA,
+                                                              int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
                                                            hipblasFillMode_t           uplo,
                                                            hipblasDiagType_t           diag,
@@ -15740,6 +21842,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t
                                                            int                         ldinvA,
                                                            hipblasStride               stride_invA,
                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrtriStridedBatched_64(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasDiagType_t           diag,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* AP,
+                                   int64_t                     lda,
+                                   hipblasStride               strideA,
+                                   hipblasDoubleComplex*       invA,
+                                   int64_t                     ldinvA,
+                                   hipblasStride               stride_invA,
+                                   int64_t                     batchCount);
 //! @}
 
 /*! @{
@@ -15799,6 +21914,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
                                             float*            CP,
                                             int               ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const float*      AP,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               float*            CP,
+                                               int64_t           ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
                                             hipblasSideMode_t side,
                                             int               m,
@@ -15810,6 +21936,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
                                             double*           CP,
                                             int               ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm_64(hipblasHandle_t   handle,
+                                               hipblasSideMode_t side,
+                                               int64_t           m,
+                                               int64_t           n,
+                                               const double*     AP,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               double*           CP,
+                                               int64_t           ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
                                             int                   m,
@@ -15821,6 +21958,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             int                         m,
@@ -15831,6 +21979,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                                             int                         incx,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
 //! @}
 
 /*! @{
@@ -15898,6 +22057,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
                                                    int                ldc,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                                    hipblasSideMode_t   side,
                                                    int                 m,
@@ -15910,6 +22081,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                                    int                 ldc,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasSideMode_t   side,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
                                                    hipblasSideMode_t           side,
                                                    int                         m,
@@ -15922,6 +22105,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
                                                    hipblasSideMode_t                 side,
                                                    int                               m,
@@ -15933,6 +22128,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasSideMode_t                 side,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
 //! @}
 
 /*! @{
@@ -16012,6 +22219,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideC,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const float*      AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const float*      x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             float*            CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
                                                           hipblasSideMode_t side,
                                                           int               m,
@@ -16027,6 +22249,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideC,
                                                           int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched_64(hipblasHandle_t   handle,
+                                                             hipblasSideMode_t side,
+                                                             int64_t           m,
+                                                             int64_t           n,
+                                                             const double*     AP,
+                                                             int64_t           lda,
+                                                             hipblasStride     strideA,
+                                                             const double*     x,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             double*           CP,
+                                                             int64_t           ldc,
+                                                             hipblasStride     strideC,
+                                                             int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasSideMode_t     side,
                                                           int                   m,
@@ -16042,6 +22279,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           int                         m,
@@ -16056,6 +22308,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZdgmmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  hipblasStride               strideC,
+                                  int64_t                     batchCount);
 //! @}
 
 /*
@@ -17568,6 +23836,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                                              hipblasDatatype_t  computeType,
                                              hipblasGemmAlgo_t  algo);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_64(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int64_t            m,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                hipblasDatatype_t  aType,
+                                                int64_t            lda,
+                                                const void*        B,
+                                                hipblasDatatype_t  bType,
+                                                int64_t            ldb,
+                                                const void*        beta,
+                                                void*              C,
+                                                hipblasDatatype_t  cType,
+                                                int64_t            ldc,
+                                                hipblasDatatype_t  computeType,
+                                                hipblasGemmAlgo_t  algo);
+
 /*! \brief BLAS EX API
     \details
     gemmBatchedEx performs one of the batched matrix-matrix operations
@@ -17674,6 +23962,150 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                                     hipblasDatatype_t  computeType,
                                                     hipblasGemmAlgo_t  algo);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_64(hipblasHandle_t    handle,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int64_t            m,
+                                                       int64_t            n,
+                                                       int64_t            k,
+                                                       const void*        alpha,
+                                                       const void*        A[],
+                                                       hipblasDatatype_t  aType,
+                                                       int64_t            lda,
+                                                       const void*        B[],
+                                                       hipblasDatatype_t  bType,
+                                                       int64_t            ldb,
+                                                       const void*        beta,
+                                                       void*              C[],
+                                                       hipblasDatatype_t  cType,
+                                                       int64_t            ldc,
+                                                       int64_t            batchCount,
+                                                       hipblasDatatype_t  computeType,
+                                                       hipblasGemmAlgo_t  algo);
+
+/*! \brief BLAS EX API
+    \details
+    gemmGroupedBatchedEx performs the batched matrix-matrix operations of several groups
+        C_i = alpha_g*op_g(A_i)*op_g(B_i) + beta_g*C_i,
+    in one call. Group g has its own transposes, sizes, leading dimensions and scalars, which
+    are shared by its group_size[g] problems. The groups follow each other in A, B and C:
+    the problems of group 0 come first, then those of group 1 and so on.
+
+    - Supported types are determined by the backend. oneMKL runs all the groups as one group
+      gemm_batch, rocBLAS as one gemmBatchedEx call per group, and cuBLAS 12.5 and later has
+      a native grouped gemm.
+
+    The per group arrays, including alpha_array and beta_array, are host arrays, so the
+    pointer mode must be HIPBLAS_POINTER_MODE_HOST; HIPBLAS_STATUS_NOT_SUPPORTED is
+    returned otherwise. The arguments of all groups are checked before any group runs.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA_array [const hipblasOperation_t*]
+              host array of group_count forms of op( A ).
+    @param[in]
+    transB_array [const hipblasOperation_t*]
+              host array of group_count forms of op( B ).
+    @param[in]
+    m_array   [const int*]
+              host array of group_count matrix dimensions m.
+    @param[in]
+    n_array   [const int*]
+              host array of group_count matrix dimensions n.
+    @param[in]
+    k_array   [const int*]
+              host array of group_count matrix dimensions k.
+    @param[in]
+    alpha_array [const void *]
+              host array of group_count scalars alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing array of pointers to each matrix A_i of all groups.
+    @param[in]
+    aType    [hipblasDatatype_t]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda_array [const int*]
+              host array of group_count leading dimensions of A_i.
+    @param[in]
+    B         [void *]
+              device pointer storing array of pointers to each matrix B_i of all groups.
+    @param[in]
+    bType    [hipblasDatatype_t]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb_array [const int*]
+              host array of group_count leading dimensions of B_i.
+    @param[in]
+    beta_array [const void *]
+              host array of group_count scalars beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device array of device pointers to each matrix C_i of all groups.
+    @param[in]
+    cType    [hipblasDatatype_t]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc_array [const int*]
+              host array of group_count leading dimensions of C_i.
+    @param[in]
+    group_count
+              [int]
+              number of groups.
+    @param[in]
+    group_size [const int*]
+              host array of the group_count numbers of gemm operations in each group.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t transA_array[],
+                                                           const hipblasOperation_t transB_array[],
+                                                           const int                m_array[],
+                                                           const int                n_array[],
+                                                           const int                k_array[],
+                                                           const void*              alpha_array,
+                                                           const void*              A[],
+                                                           hipblasDatatype_t        aType,
+                                                           const int                lda_array[],
+                                                           const void*              B[],
+                                                           hipblasDatatype_t        bType,
+                                                           const int                ldb_array[],
+                                                           const void*              beta_array,
+                                                           void*                    C[],
+                                                           hipblasDatatype_t        cType,
+                                                           const int                ldc_array[],
+                                                           int                      group_count,
+                                                           const int                group_size[],
+                                                           hipblasDatatype_t        computeType);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmGroupedBatchedEx_64(hipblasHandle_t          handle,
+                                   const hipblasOperation_t transA_array[],
+                                   const hipblasOperation_t transB_array[],
+                                   const int64_t            m_array[],
+                                   const int64_t            n_array[],
+                                   const int64_t            k_array[],
+                                   const void*              alpha_array,
+                                   const void*              A[],
+                                   hipblasDatatype_t        aType,
+                                   const int64_t            lda_array[],
+                                   const void*              B[],
+                                   hipblasDatatype_t        bType,
+                                   const int64_t            ldb_array[],
+                                   const void*              beta_array,
+                                   void*                    C[],
+                                   hipblasDatatype_t        cType,
+                                   const int64_t            ldc_array[],
+                                   int64_t                  group_count,
+                                   const int64_t            group_size[],
+                                   hipblasDatatype_t        computeType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -17798,6 +24230,30 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    ha
                                                            hipblasDatatype_t  computeType,
                                                            hipblasGemmAlgo_t  algo);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_64(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transA,
+                                                              hipblasOperation_t transB,
+                                                              int64_t            m,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const void*        alpha,
+                                                              const void*        A,
+                                                              hipblasDatatype_t  aType,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const void*        B,
+                                                              hipblasDatatype_t  bType,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const void*        beta,
+                                                              void*              C,
+                                                              hipblasDatatype_t  cType,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount,
+                                                              hipblasDatatype_t  computeType,
+                                                              hipblasGemmAlgo_t  algo);
+
 /*! BLAS EX API
 
     \details
@@ -17935,6 +24391,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                                              int                invAsize,
                                              hipblasDatatype_t  computeType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmEx_64(hipblasHandle_t    handle,
+                                                hipblasSideMode_t  side,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                hipblasDiagType_t  diag,
+                                                int64_t            m,
+                                                int64_t            n,
+                                                const void*        alpha,
+                                                void*              A,
+                                                int64_t            lda,
+                                                void*              B,
+                                                int64_t            ldb,
+                                                const void*        invA,
+                                                int64_t            invAsize,
+                                                hipblasDatatype_t  computeType);
+
 /*! BLAS EX API
 
     \details
@@ -18078,6 +24550,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
                                                     int                invAsize,
                                                     hipblasDatatype_t  computeType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmBatchedEx_64(hipblasHandle_t    handle,
+                                                       hipblasSideMode_t  side,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       hipblasDiagType_t  diag,
+                                                       int64_t            m,
+                                                       int64_t            n,
+                                                       const void*        alpha,
+                                                       void*              A,
+                                                       int64_t            lda,
+                                                       void*              B,
+                                                       int64_t            ldb,
+                                                       int64_t            batchCount,
+                                                       const void*        invA,
+                                                       int64_t            invAsize,
+                                                       hipblasDatatype_t  computeType);
+
 /*! BLAS EX API
 
     \details
@@ -18237,6 +24726,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    ha
                                                            hipblasStride      strideInvA,
                                                            hipblasDatatype_t  computeType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmStridedBatchedEx_64(hipblasHandle_t    handle,
+                                                              hipblasSideMode_t  side,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              hipblasDiagType_t  diag,
+                                                              int64_t            m,
+                                                              int64_t            n,
+                                                              const void*        alpha,
+                                                              void*              A,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              void*              B,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              int64_t            batchCount,
+                                                              const void*        invA,
+                                                              int64_t            invAsize,
+                                                              hipblasStride      strideInvA,
+                                                              hipblasDatatype_t  computeType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -18290,6 +24799,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
                                              int               incy,
                                              hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       alpha,
+                                                hipblasDatatype_t alphaType,
+                                                const void*       x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                void*             y,
+                                                hipblasDatatype_t yType,
+                                                int64_t           incy,
+                                                hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -18348,6 +24869,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
                                                     int               batchCount,
                                                     hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       alpha,
+                                                       hipblasDatatype_t alphaType,
+                                                       const void*       x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       void*             y,
+                                                       hipblasDatatype_t yType,
+                                                       int64_t           incy,
+                                                       int64_t           batchCount,
+                                                       hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -18420,6 +24954,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   han
                                                            int               batchCount,
                                                            hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       alpha,
+                                                              hipblasDatatype_t alphaType,
+                                                              const void*       x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              void*             y,
+                                                              hipblasDatatype_t yType,
+                                                              int64_t           incy,
+                                                              hipblasStride     stridey,
+                                                              int64_t           batchCount,
+                                                              hipblasDatatype_t executionType);
+
 /*! @{
     \brief BLAS EX API
 
@@ -18481,6 +25030,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t resultType,
                                             hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               const void*       y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               void*             result,
+                                               hipblasDatatype_t resultType,
+                                               hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                                              int               n,
                                              const void*       x,
@@ -18492,6 +25053,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                                              void*             result,
                                              hipblasDatatype_t resultType,
                                              hipblasDatatype_t executionType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                const void*       y,
+                                                hipblasDatatype_t yType,
+                                                int64_t           incy,
+                                                void*             result,
+                                                hipblasDatatype_t resultType,
+                                                hipblasDatatype_t executionType);
 //! @}
 
 /*! @{
@@ -18562,6 +25135,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
                                                    hipblasDatatype_t resultType,
                                                    hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx_64(hipblasHandle_t   handle,
+                                                      int64_t           n,
+                                                      const void*       x,
+                                                      hipblasDatatype_t xType,
+                                                      int64_t           incx,
+                                                      const void*       y,
+                                                      hipblasDatatype_t yType,
+                                                      int64_t           incy,
+                                                      int64_t           batchCount,
+                                                      void*             result,
+                                                      hipblasDatatype_t resultType,
+                                                      hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                                     int               n,
                                                     const void*       x,
@@ -18574,6 +25160,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                                     void*             result,
                                                     hipblasDatatype_t resultType,
                                                     hipblasDatatype_t executionType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       const void*       y,
+                                                       hipblasDatatype_t yType,
+                                                       int64_t           incy,
+                                                       int64_t           batchCount,
+                                                       void*             result,
+                                                       hipblasDatatype_t resultType,
+                                                       hipblasDatatype_t executionType);
 //! @}
 
 /*! @{
@@ -18652,6 +25251,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   hand
                                                           hipblasDatatype_t resultType,
                                                           hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                             int64_t           n,
+                                                             const void*       x,
+                                                             hipblasDatatype_t xType,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const void*       y,
+                                                             hipblasDatatype_t yType,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount,
+                                                             void*             result,
+                                                             hipblasDatatype_t resultType,
+                                                             hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
                                                            int               n,
                                                            const void*       x,
@@ -18666,6 +25280,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   han
                                                            void*             result,
                                                            hipblasDatatype_t resultType,
                                                            hipblasDatatype_t executionType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              const void*       y,
+                                                              hipblasDatatype_t yType,
+                                                              int64_t           incy,
+                                                              hipblasStride     stridey,
+                                                              int64_t           batchCount,
+                                                              void*             result,
+                                                              hipblasDatatype_t resultType,
+                                                              hipblasDatatype_t executionType);
 //! @}
 
 /*! \brief BLAS_EX API
@@ -18713,6 +25342,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
                                              hipblasDatatype_t resultType,
                                              hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                void*             result,
+                                                hipblasDatatype_t resultType,
+                                                hipblasDatatype_t executionType);
+
 /*! \brief BLAS_EX API
 
     \details
@@ -18762,6 +25400,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
                                                     hipblasDatatype_t resultType,
                                                     hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       int64_t           batchCount,
+                                                       void*             result,
+                                                       hipblasDatatype_t resultType,
+                                                       hipblasDatatype_t executionType);
+
 /*! \brief BLAS_EX API
 
     \details
@@ -18818,6 +25466,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   han
                                                            hipblasDatatype_t resultType,
                                                            hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              int64_t           batchCount,
+                                                              void*             result,
+                                                              hipblasDatatype_t resultType,
+                                                              hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -18881,6 +25540,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t csType,
                                             hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               void*             x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               void*             y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               const void*       c,
+                                               const void*       s,
+                                               hipblasDatatype_t csType,
+                                               hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -18948,6 +25620,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
                                                    int               batchCount,
                                                    hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx_64(hipblasHandle_t   handle,
+                                                      int64_t           n,
+                                                      void*             x,
+                                                      hipblasDatatype_t xType,
+                                                      int64_t           incx,
+                                                      void*             y,
+                                                      hipblasDatatype_t yType,
+                                                      int64_t           incy,
+                                                      const void*       c,
+                                                      const void*       s,
+                                                      hipblasDatatype_t csType,
+                                                      int64_t           batchCount,
+                                                      hipblasDatatype_t executionType);
+
 /*! \brief BLAS Level 1 API
 
     \details
@@ -19023,6 +25709,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   hand
                                                           int               batchCount,
                                                           hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                             int64_t           n,
+                                                             void*             x,
+                                                             hipblasDatatype_t xType,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             void*             y,
+                                                             hipblasDatatype_t yType,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             const void*       c,
+                                                             const void*       s,
+                                                             hipblasDatatype_t csType,
+                                                             int64_t           batchCount,
+                                                             hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -19065,6 +25767,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
                                              int               incx,
                                              hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       alpha,
+                                                hipblasDatatype_t alphaType,
+                                                void*             x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -19111,6 +25822,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
                                                     int               batchCount,
                                                     hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       alpha,
+                                                       hipblasDatatype_t alphaType,
+                                                       void*             x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       int64_t           batchCount,
+                                                       hipblasDatatype_t executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -19165,6 +25886,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   han
                                                            int               batchCount,
                                                            hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       alpha,
+                                                              hipblasDatatype_t alphaType,
+                                                              void*             x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              int64_t           batchCount,
+                                                              hipblasDatatype_t executionType);
+
 /*! HIPBLAS Auxiliary API
 
     \details
@@ -0,0 +1,562 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include <hipblas.h>
+
+#include "logging.hpp"
+
+#include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace hipblas_logging
+{
+    namespace
+    {
+        int read_layer()
+        {
+            const char* env = getenv("HIPBLAS_LAYER");
+            return env ? int(strtol(env, nullptr, 0)) : layer_mode_none;
+        }
+
+        double time_us()
+        {
+            return std::chrono::duration<double, std::micro>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        // One output of the layer: the file named by path_env, stderr when unset
+        class log_stream
+        {
+        public:
+            explicit log_stream(const char* path_env)
+            {
+                const char* path = getenv(path_env);
+                if(path && *path)
+                    file.open(path);
+            }
+
+            void write(const std::string& line)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::ostream&               os = file.is_open() ? file : std::cerr;
+                os << line << '\n';
+                os.flush();
+            }
+
+        private:
+            std::mutex    mutex;
+            std::ofstream file;
+        };
+
+        log_stream& trace_stream()
+        {
+            static log_stream s("HIPBLAS_LOG_TRACE_PATH");
+            return s;
+        }
+
+        log_stream& bench_stream()
+        {
+            static log_stream s("HIPBLAS_LOG_BENCH_PATH");
+            return s;
+        }
+
+        // Call counts and wall time per signature, written when the library
+        // is unloaded, most expensive first
+        class profile_table
+        {
+        public:
+            void add(const std::string& signature, double us)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto&                       e = entries[signature];
+                e.first++;
+                e.second += us;
+            }
+
+            ~profile_table()
+            {
+                std::vector<std::pair<std::string, std::pair<size_t, double>>> sorted(
+                    entries.begin(), entries.end());
+                std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+                    return a.second.second > b.second.second;
+                });
+
+                log_stream out("HIPBLAS_LOG_PROFILE_PATH");
+                for(auto& e : sorted)
+                {
+                    std::ostringstream line;
+                    line << "- { " << e.first << ", call_count: " << e.second.first
+                         << ", total_us: " << e.second.second
+                         << ", mean_us: " << e.second.second / e.second.first << " }";
+                    out.write(line.str());
+                }
+            }
+
+        private:
+            std::mutex                                        mutex;
+            std::map<std::string, std::pair<size_t, double>> entries;
+        };
+
+        profile_table& profile()
+        {
+            static profile_table t;
+            return t;
+        }
+
+        float half_to_float(uint16_t h)
+        {
+            uint32_t sign = uint32_t(h & 0x8000) << 16;
+            uint32_t exp  = (h >> 10) & 0x1f;
+            uint32_t man  = h & 0x3ff;
+            uint32_t bits;
+            if(exp == 0x1f)
+                bits = sign | 0x7f800000 | (man << 13);
+            else if(exp != 0)
+                bits = sign | ((exp + 112) << 23) | (man << 13);
+            else if(man == 0)
+                bits = sign;
+            else
+            {
+                // subnormal half, normal float
+                exp = 113;
+                while(!(man & 0x400))
+                {
+                    man <<= 1;
+                    exp--;
+                }
+                bits = sign | (exp << 23) | ((man & 0x3ff) << 13);
+            }
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+
+        // Value of a host scalar, false for pointers of unknown type
+        bool read_scalar(scalar_kind kind, const void* p, double& re, double& im)
+        {
+            im = 0;
+            switch(kind)
+            {
+            case scalar_kind::f16:
+            {
+                uint16_t h;
+                memcpy(&h, p, sizeof(h));
+                re = half_to_float(h);
+                return true;
+            }
+            case scalar_kind::f32:
+            case scalar_kind::c32:
+            {
+                float v[2];
+                memcpy(v, p, sizeof(float) * (kind == scalar_kind::c32 ? 2 : 1));
+                re = v[0];
+                im = kind == scalar_kind::c32 ? v[1] : 0;
+                return true;
+            }
+            case scalar_kind::f64:
+            case scalar_kind::c64:
+            {
+                double v[2];
+                memcpy(v, p, sizeof(double) * (kind == scalar_kind::c64 ? 2 : 1));
+                re = v[0];
+                im = kind == scalar_kind::c64 ? v[1] : 0;
+                return true;
+            }
+            default:
+                return false;
+            }
+        }
+
+        scalar_kind kind_of_datatype(const std::string& t)
+        {
+            if(t == "f16_r")
+                return scalar_kind::f16;
+            if(t == "f32_r")
+                return scalar_kind::f32;
+            if(t == "f64_r")
+                return scalar_kind::f64;
+            if(t == "f32_c")
+                return scalar_kind::c32;
+            if(t == "f64_c")
+                return scalar_kind::c64;
+            return scalar_kind::none;
+        }
+
+        std::vector<std::string> split_names(const char* names)
+        {
+            std::vector<std::string> out;
+            std::string              cur;
+            for(const char* c = names;; c++)
+            {
+                if(*c == ',' || *c == '\0')
+                {
+                    out.push_back(cur);
+                    cur.clear();
+                    if(*c == '\0')
+                        break;
+                }
+                else if(!isspace(static_cast<unsigned char>(*c)))
+                    cur += *c;
+            }
+            return out;
+        }
+
+        std::string normalized(const std::string& name)
+        {
+            std::string out;
+            for(char c : name)
+                if(c != '_')
+                    out += char(tolower(static_cast<unsigned char>(c)));
+            return out;
+        }
+
+        bool is_scalar_name(const std::string& name)
+        {
+            return name == "alpha" || name == "beta";
+        }
+
+        // hipblas-bench function and precision options of a hipBLAS function,
+        // empty when the name carries neither a precision nor an Ex suffix
+        std::string bench_function(const std::string& func)
+        {
+            std::string name = func.substr(strlen("hipblas"));
+            std::string prefix;
+            std::string types;
+            auto        starts = [&](const char* p) { return name.compare(0, strlen(p), p) == 0; };
+
+            if(name.size() > 2 && name.compare(name.size() - 2, 2, "Ex") == 0)
+                ;
+            else if(starts("Bf"))
+                prefix = "bf16_r", name = name.substr(2);
+            else if(starts("Scnrm2") || starts("Scasum"))
+                prefix = "f32_c", name = name.substr(2);
+            else if(starts("Dznrm2") || starts("Dzasum"))
+                prefix = "f64_c", name = name.substr(2);
+            else if(starts("Csscal") || starts("Csrot"))
+                prefix = "f32_c", types = " --b_type f32_r", name = name.substr(2);
+            else if(starts("Zdscal") || starts("Zdrot"))
+                prefix = "f64_c", types = " --b_type f64_r", name = name.substr(2);
+            else if(name.size() > 2 && name[0] == 'I' && islower(static_cast<unsigned char>(name[2])))
+            {
+                std::string rest = name.substr(2);
+                prefix           = std::string(1, char(toupper(static_cast<unsigned char>(name[1]))));
+                name             = "i" + rest;
+            }
+            else if(name.size() > 1 && strchr("HSDCZ", name[0])
+                    && islower(static_cast<unsigned char>(name[1])))
+                prefix = name.substr(0, 1), name = name.substr(1);
+            else
+                return "";
+
+            static const std::map<std::string, std::string> precisions
+                = {{"H", "f16_r"}, {"S", "f32_r"}, {"D", "f64_r"}, {"C", "f32_c"}, {"Z", "f64_c"}};
+            auto p = precisions.find(prefix);
+            if(p != precisions.end())
+                prefix = p->second;
+
+            // complex rot takes a real c, csrot and zdrot a real s as well
+            if(starts("rot") && !starts("rotg") && !starts("rotm") && !types.empty())
+                types += types == " --b_type f32_r" ? " --c_type f32_r" : " --c_type f64_r";
+            else if(starts("rot") && !starts("rotg") && !starts("rotm")
+                    && (prefix == "f32_c" || prefix == "f64_c"))
+                types = prefix == "f32_c" ? " --b_type f32_r" : " --b_type f64_r";
+
+            std::string snake;
+            for(char c : name)
+            {
+                if(isupper(static_cast<unsigned char>(c)))
+                    snake += '_';
+                snake += char(tolower(static_cast<unsigned char>(c)));
+            }
+            if(!snake.empty() && snake[0] == '_')
+                snake = snake.substr(1);
+
+            std::string out = "-f " + snake;
+            if(!prefix.empty())
+                out += " -r " + prefix;
+            return out + types;
+        }
+
+        const std::map<std::string, std::string>& bench_options()
+        {
+            static const std::map<std::string, std::string> options = {
+                {"m", "-m"},
+                {"n", "-n"},
+                {"k", "-k"},
+                {"kl", "--kl"},
+                {"ku", "--ku"},
+                {"lda", "--lda"},
+                {"ldb", "--ldb"},
+                {"ldc", "--ldc"},
+                {"ldd", "--ldd"},
+                {"incx", "--incx"},
+                {"incy", "--incy"},
+                {"stridea", "--stride_a"},
+                {"strideap", "--stride_a"},
+                {"strideb", "--stride_b"},
+                {"stridec", "--stride_c"},
+                {"strided", "--stride_d"},
+                {"stridex", "--stride_x"},
+                {"stridey", "--stride_y"},
+                {"batchcount", "--batch_count"},
+                {"trans", "--transposeA"},
+                {"transa", "--transposeA"},
+                {"transb", "--transposeB"},
+                {"uplo", "--uplo"},
+                {"side", "--side"},
+                {"diag", "--diag"},
+            };
+            return options;
+        }
+    }
+
+    const int layer = read_layer();
+
+    thread_local bool in_api = false;
+
+    std::string pointer_value(const void* p)
+    {
+        std::ostringstream s;
+        s << p;
+        return s.str();
+    }
+
+    arg make_arg(hipblasOperation_t v)
+    {
+        return {v == HIPBLAS_OP_N ? "N" : v == HIPBLAS_OP_T ? "T" : "C"};
+    }
+
+    arg make_arg(hipblasFillMode_t v)
+    {
+        return {v == HIPBLAS_FILL_MODE_UPPER ? "U" : v == HIPBLAS_FILL_MODE_LOWER ? "L" : "F"};
+    }
+
+    arg make_arg(hipblasDiagType_t v)
+    {
+        return {v == HIPBLAS_DIAG_UNIT ? "U" : "N"};
+    }
+
+    arg make_arg(hipblasSideMode_t v)
+    {
+        return {v == HIPBLAS_SIDE_LEFT ? "L" : v == HIPBLAS_SIDE_RIGHT ? "R" : "B"};
+    }
+
+    arg make_arg(hipblasDatatype_t v)
+    {
+        const char* s;
+        switch(v)
+        {
+        case HIPBLAS_R_16F:
+            s = "f16_r";
+            break;
+        case HIPBLAS_R_32F:
+            s = "f32_r";
+            break;
+        case HIPBLAS_R_64F:
+            s = "f64_r";
+            break;
+        case HIPBLAS_C_16F:
+            s = "f16_c";
+            break;
+        case HIPBLAS_C_32F:
+            s = "f32_c";
+            break;
+        case HIPBLAS_C_64F:
+            s = "f64_c";
+            break;
+        case HIPBLAS_R_8I:
+            s = "i8_r";
+            break;
+        case HIPBLAS_R_8U:
+            s = "u8_r";
+            break;
+        case HIPBLAS_R_32I:
+            s = "i32_r";
+            break;
+        case HIPBLAS_R_32U:
+            s = "u32_r";
+            break;
+        case HIPBLAS_C_8I:
+            s = "i8_c";
+            break;
+        case HIPBLAS_C_8U:
+            s = "u8_c";
+            break;
+        case HIPBLAS_C_32I:
+            s = "i32_c";
+            break;
+        case HIPBLAS_C_32U:
+            s = "u32_c";
+            break;
+        case HIPBLAS_R_16B:
+            s = "bf16_r";
+            break;
+        case HIPBLAS_C_16B:
+            s = "bf16_c";
+            break;
+        default:
+            s = "invalid";
+        }
+        arg a{s};
+        a.datatype = true;
+        return a;
+    }
+
+    arg make_arg(hipblasGemmAlgo_t v)
+    {
+        return {std::to_string(int(v))};
+    }
+
+    void api_scope::log_call(const char*                func,
+                             const char*                names,
+                             hipblasHandle_t            h,
+                             std::initializer_list<arg> args)
+    {
+        std::vector<std::string> arg_names = split_names(names);
+        std::vector<arg>         values(args);
+
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+        if(h)
+            hipblasGetPointerMode(h, &mode);
+        bool host_scalars = h && mode == HIPBLAS_POINTER_MODE_HOST;
+
+        // void* scalars of the Ex functions have alphaType or else the compute type
+        scalar_kind ex_kind = scalar_kind::none;
+        for(size_t i = 0; i < values.size(); i++)
+        {
+            std::string n = normalized(arg_names[i]);
+            if(n == "alphatype"
+               || (ex_kind == scalar_kind::none
+                   && (n == "computetype" || n == "executiontype")))
+                ex_kind = kind_of_datatype(values[i].value);
+        }
+        for(auto& v : values)
+            if(v.pointer && v.kind == scalar_kind::none)
+                v.kind = ex_kind;
+
+        if(layer & layer_mode_log_trace)
+        {
+            std::string line = std::string(func) + " handle=" + pointer_value(h)
+                               + " pointer_mode=" + (mode == HIPBLAS_POINTER_MODE_HOST ? "host" : "device");
+            for(size_t i = 0; i < values.size(); i++)
+            {
+                double re, im;
+                line += " " + arg_names[i] + "=";
+                if(host_scalars && is_scalar_name(arg_names[i]) && values[i].ptr
+                   && read_scalar(values[i].kind, values[i].ptr, re, im))
+                {
+                    std::ostringstream s;
+                    s << re;
+                    if(values[i].kind == scalar_kind::c32 || values[i].kind == scalar_kind::c64)
+                        s << (im < 0 ? "" : "+") << im << "i";
+                    line += s.str();
+                }
+                else
+                    line += values[i].value;
+            }
+            trace_stream().write(line);
+        }
+
+        if(layer & layer_mode_log_bench)
+        {
+            std::string function = bench_function(func);
+            if(!function.empty())
+            {
+                std::ostringstream line;
+                line << "hipblas-bench " << function;
+
+                static const char* type_options[] = {"--a_type", "--b_type", "--c_type", "--d_type"};
+                size_t             type_index     = 0;
+                for(size_t i = 0; i < values.size(); i++)
+                {
+                    std::string n = normalized(arg_names[i]);
+                    double      re, im;
+                    if(values[i].datatype)
+                    {
+                        if(n == "computetype" || n == "executiontype")
+                            line << " --compute_type " << values[i].value;
+                        else if(type_index < 4)
+                        {
+                            if(type_index == 0)
+                                line << " -r " << values[i].value;
+                            line << " " << type_options[type_index++] << " " << values[i].value;
+                        }
+                    }
+                    else if(is_scalar_name(n))
+                    {
+                        // the bench client has no device pointer mode, its
+                        // defaults stand in for device scalars
+                        if(host_scalars && values[i].ptr
+                           && read_scalar(values[i].kind, values[i].ptr, re, im))
+                        {
+                            line << " --" << n << " " << re;
+                            if(im != 0)
+                                line << " --" << n << "i " << im;
+                        }
+                    }
+                    else
+                    {
+                        auto o = bench_options().find(n);
+                        if(o != bench_options().end() && !values[i].pointer)
+                            line << " " << o->second << " " << values[i].value;
+                    }
+                }
+                bench_stream().write(line.str());
+            }
+        }
+
+        if(layer & layer_mode_log_profile)
+        {
+            signature = std::string("function: ") + func;
+            for(size_t i = 0; i < values.size(); i++)
+                if(!values[i].pointer)
+                    signature += ", " + arg_names[i] + ": " + values[i].value;
+            function = func;
+            handle   = h;
+            start_us = time_us();
+        }
+    }
+
+    // The time covers the device work as well: the stream of the handle is
+    // synchronized before the clock is read
+    void api_scope::end()
+    {
+        hipStream_t stream = nullptr;
+        if(handle && hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS)
+            (void)hipStreamSynchronize(stream);
+        profile().add(signature, time_us() - start_us);
+    }
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "ilp64.hpp"
+#include <algorithm>
+#include <type_traits>
+
+// hipblasGemmGroupedBatchedEx on backends without a grouped gemm. The groups
+// are checked up front, so that a bad group fails the call before any group
+// runs, and then run as one hipblasGemmBatchedEx call per group. The A, B and
+// C arrays hold the pointers of all groups one after the other. The sizes are
+// int for hipblasGemmGroupedBatchedEx and int64_t for its _64 form, which runs
+// the groups through hipblasGemmBatchedEx_64.
+namespace hipblas_grouped
+{
+    // Arguments of every group; HIPBLAS_STATUS_SUCCESS when the call can run.
+    // The scalar arrays are host arrays, so device pointer mode is rejected.
+    template <typename I>
+    hipblasStatus_t check(hipblasHandle_t          handle,
+                          const hipblasOperation_t transA_array[],
+                          const hipblasOperation_t transB_array[],
+                          const I                  m_array[],
+                          const I                  n_array[],
+                          const I                  k_array[],
+                          const void*              alpha_array,
+                          const I                  lda_array[],
+                          const I                  ldb_array[],
+                          const void*              beta_array,
+                          const I                  ldc_array[],
+                          I                        group_count,
+                          const I                  group_size[])
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(group_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(group_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!transA_array || !transB_array || !m_array || !n_array || !k_array || !alpha_array
+           || !lda_array || !ldb_array || !beta_array || !ldc_array || !group_size)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(mode != HIPBLAS_POINTER_MODE_HOST)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        for(I g = 0; g < group_count; g++)
+        {
+            I m = m_array[g], n = n_array[g], k = k_array[g];
+            if(m < 0 || n < 0 || k < 0 || group_size[g] < 0
+               || lda_array[g] < std::max<I>(1, transA_array[g] == HIPBLAS_OP_N ? m : k)
+               || ldb_array[g] < std::max<I>(1, transB_array[g] == HIPBLAS_OP_N ? k : n)
+               || ldc_array[g] < std::max<I>(1, m))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename I>
+    hipblasStatus_t gemm_batched_sequence(hipblasHandle_t          handle,
+                                          const hipblasOperation_t transA_array[],
+                                          const hipblasOperation_t transB_array[],
+                                          const I                  m_array[],
+                                          const I                  n_array[],
+                                          const I                  k_array[],
+                                          const void*              alpha_array,
+                                          const void*              A[],
+                                          hipblasDatatype_t        aType,
+                                          const I                  lda_array[],
+                                          const void*              B[],
+                                          hipblasDatatype_t        bType,
+                                          const I                  ldb_array[],
+                                          const void*              beta_array,
+                                          void*                    C[],
+                                          hipblasDatatype_t        cType,
+                                          const I                  ldc_array[],
+                                          I                        group_count,
+                                          const I                  group_size[],
+                                          hipblasDatatype_t        computeType)
+    {
+        hipblasStatus_t status = check(handle,
+                                       transA_array,
+                                       transB_array,
+                                       m_array,
+                                       n_array,
+                                       k_array,
+                                       alpha_array,
+                                       lda_array,
+                                       ldb_array,
+                                       beta_array,
+                                       ldc_array,
+                                       group_count,
+                                       group_size);
+
+        auto gemm_batched = [](auto... args) {
+            if constexpr(std::is_same<I, int64_t>::value)
+                return hipblasGemmBatchedEx_64(args...);
+            else
+                return hipblasGemmBatchedEx(args...);
+        };
+
+        int64_t first = 0;
+        for(I g = 0; status == HIPBLAS_STATUS_SUCCESS && g < group_count; first += group_size[g++])
+        {
+            if(group_size[g] == 0)
+                continue;
+            status = gemm_batched(handle,
+                                  transA_array[g],
+                                  transB_array[g],
+                                  m_array[g],
+                                  n_array[g],
+                                  k_array[g],
+                                  hipblas_ilp64::advance(alpha_array, g, computeType),
+                                  A + first,
+                                  aType,
+                                  lda_array[g],
+                                  B + first,
+                                  bType,
+                                  ldb_array[g],
+                                  hipblas_ilp64::advance(beta_array, g, computeType),
+                                  C + first,
+                                  cType,
+                                  ldc_array[g],
+                                  group_size[g],
+                                  computeType,
+                                  HIPBLAS_GEMM_DEFAULT);
+        }
+        return status;
+    }
+}
@@ -0,0 +1,641 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// The _64 entry points on backends which only take 32-bit sizes. A call whose
+// sizes all fit in int goes straight to the 32-bit function. Longer vectors,
+// matrices with more than INT_MAX independent columns or rows, longer inner
+// dimensions and batch counts are split into chunks of 2^30 elements, columns,
+// rows or batches. Increments, leading dimensions and the sizes of banded,
+// packed, symmetric and triangular Level-2 matrices cannot be split and are
+// not supported above INT_MAX.
+//
+// The callbacks get the sizes of a chunk as int and the element offsets of its
+// first elements. Chunks after the first accumulate into the result, so a
+// split call reads device pointer mode scalars to the host, synchronizing the
+// stream, and runs the chunks in host pointer mode.
+namespace hipblas_ilp64
+{
+    constexpr int64_t chunk = int64_t(1) << 30;
+
+    inline bool fits(int64_t v)
+    {
+        return v >= INT_MIN && v <= INT_MAX;
+    }
+
+    template <typename... Ts>
+    bool fits(int64_t v, Ts... vs)
+    {
+        return fits(v) && fits(vs...);
+    }
+
+    // Negative sizes are passed on to the 32-bit function, which rejects them
+    // or returns early
+    inline int64_t clamp(int64_t v)
+    {
+        return std::max<int64_t>(v, INT_MIN);
+    }
+
+    // Offset of the first element of the chunk [start, start + count) of a
+    // vector of n elements; a negative increment walks the vector from its end
+    inline int64_t offset(int64_t n, int64_t start, int64_t count, int64_t inc)
+    {
+        return inc >= 0 ? start * inc : (n - start - count) * -inc;
+    }
+
+    // Offset of column j of op(M) for a column major M
+    inline int64_t op_column(hipblasOperation_t trans, int64_t j, int64_t ld)
+    {
+        return trans == HIPBLAS_OP_N ? j * ld : j;
+    }
+
+    // Offset of the block starting at column (side left) or row (side right)
+    // first, see sides()
+    inline int64_t block(hipblasSideMode_t side, int64_t first, int64_t ld)
+    {
+        return side == HIPBLAS_SIDE_LEFT ? first * ld : first;
+    }
+
+    template <typename P>
+    P advance(P p, int64_t elements, size_t size)
+    {
+        return (P)((const char*)p + elements * int64_t(size));
+    }
+
+    inline size_t datatype_size(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_8I:
+        case HIPBLAS_R_8U:
+            return 1;
+        case HIPBLAS_R_16F:
+        case HIPBLAS_R_16B:
+        case HIPBLAS_C_8I:
+        case HIPBLAS_C_8U:
+            return 2;
+        case HIPBLAS_R_32F:
+        case HIPBLAS_R_32I:
+        case HIPBLAS_R_32U:
+        case HIPBLAS_C_16F:
+        case HIPBLAS_C_16B:
+            return 4;
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_32F:
+        case HIPBLAS_C_32I:
+        case HIPBLAS_C_32U:
+            return 8;
+        case HIPBLAS_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    template <typename P>
+    P advance(P p, int64_t elements, hipblasDatatype_t type)
+    {
+        return advance(p, elements, datatype_size(type));
+    }
+
+    template <typename T>
+    struct datatype_of;
+    template <>
+    struct datatype_of<float>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_R_32F;
+    };
+    template <>
+    struct datatype_of<double>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_R_64F;
+    };
+    template <>
+    struct datatype_of<hipblasComplex>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_C_32F;
+    };
+    template <>
+    struct datatype_of<hipblasDoubleComplex>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_C_64F;
+    };
+
+    // Writes 1 of the given type, the beta of the chunks which accumulate
+    inline bool make_one(void* dst, hipblasDatatype_t type)
+    {
+        uint8_t value[16] = {};
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+        case HIPBLAS_C_16F:
+        {
+            uint16_t one = 0x3C00;
+            memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_16B:
+        case HIPBLAS_C_16B:
+        {
+            uint16_t one = 0x3F80;
+            memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_32F:
+        case HIPBLAS_C_32F:
+        {
+            float one = 1;
+            memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_64F:
+        {
+            double one = 1;
+            memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_32I:
+        case HIPBLAS_R_32U:
+        {
+            int32_t one = 1;
+            memcpy(value, &one, sizeof(one));
+            break;
+        }
+        default:
+            return false;
+        }
+        memcpy(dst, value, datatype_size(type));
+        return true;
+    }
+
+    // Switches a handle to host pointer mode for a split call and moves the
+    // scalars and results of the call between the host and the pointer mode
+    // of the caller
+    class host_pointer_mode
+    {
+    public:
+        explicit host_pointer_mode(hipblasHandle_t handle)
+            : handle(handle)
+        {
+            if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS)
+                throw HIPBLAS_STATUS_NOT_INITIALIZED;
+            if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+            {
+                hipStream_t stream = nullptr;
+                if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+                   || hipStreamSynchronize(stream) != hipSuccess)
+                    throw HIPBLAS_STATUS_INTERNAL_ERROR;
+                hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+            }
+        }
+
+        host_pointer_mode(const host_pointer_mode&) = delete;
+        host_pointer_mode& operator=(const host_pointer_mode&) = delete;
+
+        ~host_pointer_mode()
+        {
+            if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+                hipblasSetPointerMode(handle, mode);
+        }
+
+        void read(void* dst, const void* src, size_t size) const
+        {
+            if(mode == HIPBLAS_POINTER_MODE_HOST)
+                memcpy(dst, src, size);
+            else if(hipMemcpy(dst, src, size, hipMemcpyDeviceToHost) != hipSuccess)
+                throw HIPBLAS_STATUS_MAPPING_ERROR;
+        }
+
+        hipblasStatus_t write(void* dst, const void* src, size_t size) const
+        {
+            if(mode == HIPBLAS_POINTER_MODE_HOST)
+                memcpy(dst, src, size);
+            else if(hipMemcpy(dst, src, size, hipMemcpyHostToDevice) != hipSuccess)
+                return HIPBLAS_STATUS_MAPPING_ERROR;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+    private:
+        hipblasHandle_t      handle;
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+    };
+
+    enum class reduction
+    {
+        sum,
+        nrm2,
+    };
+
+    template <typename R, int N>
+    void combine_values(reduction op, void* total, const void* part)
+    {
+        R a[N], b[N];
+        memcpy(a, total, sizeof(a));
+        memcpy(b, part, sizeof(b));
+        for(int i = 0; i < N; i++)
+            a[i] = op == reduction::sum ? a[i] + b[i] : std::hypot(a[i], b[i]);
+        memcpy(total, a, sizeof(a));
+    }
+
+    // Result types a split reduction can combine
+    inline bool combines(reduction op, hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_32F || type == HIPBLAS_R_64F
+               || (op == reduction::sum && (type == HIPBLAS_C_32F || type == HIPBLAS_C_64F));
+    }
+
+    // total op= part
+    inline void combine(reduction op, void* total, const void* part, hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_32F:
+            return combine_values<float, 1>(op, total, part);
+        case HIPBLAS_R_64F:
+            return combine_values<double, 1>(op, total, part);
+        case HIPBLAS_C_32F:
+            return combine_values<float, 2>(op, total, part);
+        default:
+            return combine_values<double, 2>(op, total, part);
+        }
+    }
+
+    // f(int n, int64_t x_offset, int64_t y_offset)
+    template <typename F>
+    hipblasStatus_t vectors(int64_t n, int64_t incx, int64_t incy, F f)
+    {
+        n = clamp(n);
+        if(!fits(incx, incy))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(fits(n))
+            return f(int(n), 0, 0);
+
+        for(int64_t start = 0; start < n; start += chunk)
+        {
+            int64_t         count  = std::min(chunk, n - start);
+            hipblasStatus_t status = f(int(count),
+                                       offset(n, start, count, incx),
+                                       offset(n, start, count, incy));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // f(int count, int64_t first) on chunks [first, first + count) of count
+    // independent columns, rows or batches
+    template <typename F>
+    hipblasStatus_t chunks(int64_t count, F f)
+    {
+        count = clamp(count);
+        if(fits(count))
+            return f(int(count), 0);
+
+        for(int64_t first = 0; first < count; first += chunk)
+        {
+            hipblasStatus_t status = f(int(std::min(chunk, count - first)), first);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // f(int m, int n, int64_t first) on blocks of the columns of an m x n
+    // matrix for side left and of its rows for side right, which the triangular
+    // or symmetric matrix applied from that side does not mix
+    template <typename F>
+    hipblasStatus_t sides(hipblasSideMode_t side, int64_t m, int64_t n, F f)
+    {
+        bool left = side == HIPBLAS_SIDE_LEFT;
+        if(!fits(left ? m : n))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return chunks(left ? n : m, [&](int count, int64_t first) {
+            return f(left ? int(m) : count, left ? count : int(n), first);
+        });
+    }
+
+    // f(int n, int64_t x_offset, int64_t y_offset, void* result), where result
+    // is the caller's pointer for an unsplit call and host memory otherwise
+    template <typename F>
+    hipblasStatus_t reduce(hipblasHandle_t   handle,
+                           reduction         op,
+                           int64_t           n,
+                           int64_t           incx,
+                           int64_t           incy,
+                           void*             result,
+                           hipblasDatatype_t result_type,
+                           F                 f)
+    {
+        n = clamp(n);
+        if(!fits(incx, incy))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(fits(n))
+            return f(int(n), 0, 0, result);
+
+        if(!combines(op, result_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        alignas(16) uint8_t total[16], part[16];
+
+        host_pointer_mode mode(handle);
+        for(int64_t start = 0; start < n; start += chunk)
+        {
+            int64_t         count  = std::min(chunk, n - start);
+            hipblasStatus_t status = f(int(count),
+                                       offset(n, start, count, incx),
+                                       offset(n, start, count, incy),
+                                       start ? part : total);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(start)
+                combine(op, total, part, result_type);
+        }
+        return mode.write(result, total, datatype_size(result_type));
+    }
+
+    // f(int n, int64_t x_offset, int* result) with a host result. The 32-bit
+    // index is widened on the host, so device pointer mode results always
+    // synchronize the stream.
+    template <typename F>
+    hipblasStatus_t iamax_iamin(hipblasHandle_t   handle,
+                                bool              max,
+                                int64_t           n,
+                                const void*       x,
+                                hipblasDatatype_t x_type,
+                                int64_t           incx,
+                                int64_t*          result,
+                                F                 f)
+    {
+        n = clamp(n);
+        if(!fits(incx))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        host_pointer_mode mode(handle);
+        int64_t           index = 0;
+        if(fits(n))
+        {
+            int             index32 = 0;
+            hipblasStatus_t status  = f(int(n), 0, &index32);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            index = index32;
+            return mode.write(result, &index, sizeof(index));
+        }
+        if(incx <= 0)
+            return mode.write(result, &index, sizeof(index));
+
+        // |re| + |im| of an element, as amax and amin compare them
+        size_t size    = datatype_size(x_type);
+        bool   is_f64  = x_type == HIPBLAS_R_64F || x_type == HIPBLAS_C_64F;
+        auto   measure = [&](int64_t i) {
+            uint8_t bytes[16];
+            if(hipMemcpy(bytes, advance(x, i * incx, size), size, hipMemcpyDeviceToHost)
+               != hipSuccess)
+                throw HIPBLAS_STATUS_MAPPING_ERROR;
+            double value = 0;
+            for(size_t c = 0; c < size; c += is_f64 ? 8 : 4)
+            {
+                double part;
+                if(is_f64)
+                    memcpy(&part, bytes + c, 8);
+                else
+                {
+                    float f32;
+                    memcpy(&f32, bytes + c, 4);
+                    part = f32;
+                }
+                value += std::fabs(part);
+            }
+            return value;
+        };
+
+        double best = 0;
+        for(int64_t start = 0; start < n; start += chunk)
+        {
+            int64_t         count   = std::min(chunk, n - start);
+            int             index32 = 0;
+            hipblasStatus_t status  = f(int(count), start * incx, &index32);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(index32 < 1)
+                continue;
+            double value = measure(start + index32 - 1);
+            if(!index || (max ? value > best : value < best))
+            {
+                index = start + index32;
+                best  = value;
+            }
+        }
+        return mode.write(result, &index, sizeof(index));
+    }
+
+    // f(int m, int n, int64_t first, int* result) with a host result for the
+    // batches [first, first + n). The 32-bit indices are widened on the host.
+    template <typename F>
+    hipblasStatus_t iamax_iamin_batched(hipblasHandle_t handle,
+                                        int64_t         batch_count,
+                                        int64_t*        result,
+                                        F               f)
+    {
+        batch_count = clamp(batch_count);
+        if(batch_count <= 0)
+            return f(int(batch_count), 0, (int*)result);
+
+        host_pointer_mode    mode(handle);
+        std::vector<int>     index(std::min(chunk, batch_count));
+        std::vector<int64_t> wide(index.size());
+        for(int64_t first = 0; first < batch_count; first += chunk)
+        {
+            int             count  = int(std::min(chunk, batch_count - first));
+            hipblasStatus_t status = f(count, first, index.data());
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            std::copy(index.begin(), index.begin() + count, wide.begin());
+            status = mode.write(result + first, wide.data(), count * sizeof(int64_t));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // f(int k, const void* alpha, const void* beta, int64_t first) on blocks
+    // [first, first + k) of an inner dimension, the blocks after the first
+    // accumulating with beta = 1
+    template <typename F>
+    hipblasStatus_t inner(hipblasHandle_t   handle,
+                          int64_t           k,
+                          const void*       alpha,
+                          hipblasDatatype_t alpha_type,
+                          const void*       beta,
+                          hipblasDatatype_t beta_type,
+                          F                 f)
+    {
+        k = clamp(k);
+        if(fits(k))
+            return f(int(k), alpha, beta, 0);
+
+        size_t  alpha_size = datatype_size(alpha_type);
+        size_t  beta_size  = datatype_size(beta_type);
+        uint8_t alpha_h[16], beta_h[16], one[16];
+        if(!alpha_size || !make_one(one, beta_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        host_pointer_mode mode(handle);
+        mode.read(alpha_h, alpha, alpha_size);
+        mode.read(beta_h, beta, beta_size);
+        for(int64_t first = 0; first < k; first += chunk)
+        {
+            hipblasStatus_t status
+                = f(int(std::min(chunk, k - first)), alpha_h, first ? one : beta_h, first);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // f(int m, int n, const void* alpha, const void* beta, int64_t a_offset,
+    //   int64_t x_offset, int64_t y_offset)
+    template <typename F>
+    hipblasStatus_t gemv(hipblasHandle_t    handle,
+                         hipblasOperation_t trans,
+                         int64_t            m,
+                         int64_t            n,
+                         const void*        alpha,
+                         int64_t            lda,
+                         int64_t            incx,
+                         const void*        beta,
+                         int64_t            incy,
+                         hipblasDatatype_t  type,
+                         F                  f)
+    {
+        m = clamp(m);
+        n = clamp(n);
+        if(!fits(m, lda, incx, incy))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(fits(n))
+            return f(int(m), int(n), alpha, beta, 0, 0, 0);
+
+        // columns of A are chunks of x for op(A) = A and of y otherwise
+        size_t  size = datatype_size(type);
+        uint8_t alpha_h[16], beta_h[16], one[16];
+        make_one(one, type);
+
+        host_pointer_mode mode(handle);
+        mode.read(alpha_h, alpha, size);
+        mode.read(beta_h, beta, size);
+        for(int64_t start = 0; start < n; start += chunk)
+        {
+            int64_t         count  = std::min(chunk, n - start);
+            bool            notr   = trans == HIPBLAS_OP_N;
+            hipblasStatus_t status = f(int(m),
+                                       int(count),
+                                       alpha_h,
+                                       notr && start ? one : beta_h,
+                                       start * lda,
+                                       notr ? offset(n, start, count, incx) : 0,
+                                       notr ? 0 : offset(n, start, count, incy));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // f(int m, int n, int k, const void* alpha, const void* beta,
+    //   int64_t a_offset, int64_t b_offset, int64_t c_offset, int batch_count).
+    // The offsets include the strides of the batches a chunk starts at.
+    template <typename F>
+    hipblasStatus_t gemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transA,
+                         hipblasOperation_t transB,
+                         int64_t            m,
+                         int64_t            n,
+                         int64_t            k,
+                         const void*        alpha,
+                         int64_t            lda,
+                         int64_t            stride_a,
+                         int64_t            ldb,
+                         int64_t            stride_b,
+                         const void*        beta,
+                         int64_t            ldc,
+                         int64_t            stride_c,
+                         int64_t            batch_count,
+                         hipblasDatatype_t  scalar_type,
+                         F                  f)
+    {
+        m           = clamp(m);
+        n           = clamp(n);
+        k           = clamp(k);
+        batch_count = clamp(batch_count);
+        if(!fits(m, lda, ldb, ldc))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(fits(n, k, batch_count))
+            return f(int(m), int(n), int(k), alpha, beta, 0, 0, 0, int(batch_count));
+
+        // C is split into column blocks and the inner dimension into blocks
+        // accumulated with beta = 1
+        size_t  size = datatype_size(scalar_type);
+        uint8_t alpha_h[16], beta_h[16], one[16];
+        if(!size || !make_one(one, scalar_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        host_pointer_mode mode(handle);
+        mode.read(alpha_h, alpha, size);
+        mode.read(beta_h, beta, size);
+        for(int64_t b = 0; b < std::max<int64_t>(batch_count, 1); b += chunk)
+        {
+            int64_t batches = std::min(chunk, batch_count - b);
+            for(int64_t j = 0; j < std::max<int64_t>(n, 1); j += chunk)
+            {
+                int64_t cols = std::min(chunk, n - j);
+                for(int64_t l = 0; l < std::max<int64_t>(k, 1); l += chunk)
+                {
+                    int64_t         inner  = std::min(chunk, k - l);
+                    int64_t         a_off  = transA == HIPBLAS_OP_N ? l * lda : l;
+                    int64_t         b_off  = transB == HIPBLAS_OP_N ? l + j * ldb : j + l * ldb;
+                    hipblasStatus_t status = f(int(m),
+                                               int(std::max<int64_t>(cols, 0)),
+                                               int(std::max<int64_t>(inner, 0)),
+                                               alpha_h,
+                                               l ? one : beta_h,
+                                               a_off + b * stride_a,
+                                               b_off + b * stride_b,
+                                               j * ldc + b * stride_c,
+                                               int(std::max<int64_t>(batches, 0)));
+                    if(status != HIPBLAS_STATUS_SUCCESS)
+                        return status;
+                }
+            }
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
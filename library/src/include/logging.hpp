@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+
+// API logging shared by all backends. Every BLAS and solver entry point starts
+// with HIPBLAS_LOG_API; what is logged is selected by the HIPBLAS_LAYER bitmask:
+//   1  trace:   function name and arguments of every call
+//   2  bench:   the hipblas-bench command line repeating the call
+//   4  profile: call count and wall time per distinct call, written at exit
+// The output goes to HIPBLAS_LOG_TRACE_PATH, HIPBLAS_LOG_BENCH_PATH and
+// HIPBLAS_LOG_PROFILE_PATH, stderr when they are not set. With HIPBLAS_LAYER
+// unset a call costs one test of a global.
+namespace hipblas_logging
+{
+    enum layer_mode : int
+    {
+        layer_mode_none        = 0,
+        layer_mode_log_trace   = 1,
+        layer_mode_log_bench   = 2,
+        layer_mode_log_profile = 4,
+    };
+
+    // HIPBLAS_LAYER, read once when the library is loaded
+    extern const int layer;
+
+    // Set while a call is logged, so the calls the library makes to its own
+    // entry points are not logged again
+    extern thread_local bool in_api;
+
+    // Element type behind a pointer argument, for printing host scalars
+    enum class scalar_kind
+    {
+        none,
+        f16,
+        f32,
+        f64,
+        c32,
+        c64,
+    };
+
+    template <typename T>
+    struct kind_of
+    {
+        static constexpr scalar_kind value = scalar_kind::none;
+    };
+    template <>
+    struct kind_of<hipblasHalf>
+    {
+        static constexpr scalar_kind value = scalar_kind::f16;
+    };
+    template <>
+    struct kind_of<float>
+    {
+        static constexpr scalar_kind value = scalar_kind::f32;
+    };
+    template <>
+    struct kind_of<double>
+    {
+        static constexpr scalar_kind value = scalar_kind::f64;
+    };
+    template <>
+    struct kind_of<hipblasComplex>
+    {
+        static constexpr scalar_kind value = scalar_kind::c32;
+    };
+    template <>
+    struct kind_of<hipblasDoubleComplex>
+    {
+        static constexpr scalar_kind value = scalar_kind::c64;
+    };
+
+    // One argument as text; pointers keep their address and element type
+    struct arg
+    {
+        std::string value;
+        scalar_kind kind     = scalar_kind::none;
+        const void* ptr      = nullptr;
+        bool        pointer  = false;
+        bool        datatype = false;
+    };
+
+    std::string pointer_value(const void* p);
+
+    template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+    arg make_arg(T v)
+    {
+        return {std::to_string(v)};
+    }
+
+    template <typename T>
+    arg make_arg(T* p)
+    {
+        return {pointer_value(p), kind_of<std::remove_cv_t<T>>::value, p, true};
+    }
+
+    arg make_arg(hipblasOperation_t v);
+    arg make_arg(hipblasFillMode_t v);
+    arg make_arg(hipblasDiagType_t v);
+    arg make_arg(hipblasSideMode_t v);
+    arg make_arg(hipblasDatatype_t v);
+    arg make_arg(hipblasGemmAlgo_t v);
+
+    // Logs a call on construction and, when profiling, times it until the
+    // scope is left
+    class api_scope
+    {
+    public:
+        api_scope() = default;
+        api_scope(const api_scope&) = delete;
+        api_scope& operator=(const api_scope&) = delete;
+
+        ~api_scope()
+        {
+            if(function)
+                end();
+            if(outer)
+                in_api = false;
+        }
+
+        // names is the stringized argument list of HIPBLAS_LOG_API
+        template <typename... Ts>
+        void begin(const char* func, const char* names, hipblasHandle_t h, const Ts&... args)
+        {
+            if(in_api)
+                return;
+            in_api = outer = true;
+            log_call(func, names, h, {make_arg(args)...});
+        }
+
+    private:
+        void log_call(const char*                func,
+                      const char*                names,
+                      hipblasHandle_t            h,
+                      std::initializer_list<arg> args);
+        void end();
+
+        const char*     function = nullptr;
+        hipblasHandle_t handle   = nullptr;
+        std::string     signature;
+        double          start_us = 0;
+        bool            outer    = false;
+    };
+}
+
+#define HIPBLAS_LOG_API(handle, ...)              \
+    hipblas_logging::api_scope hipblas_api_scope; \
+    if(hipblas_logging::layer)                    \
+        hipblas_api_scope.begin(__func__, #__VA_ARGS__, handle, __VA_ARGS__)
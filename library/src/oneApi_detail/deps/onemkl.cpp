@@ -1,19 +1,74 @@
 #include "onemkl.h"
+#include "onemkl_kernels.hpp"
 #include "sycl.hpp"
 
 #include <oneapi/mkl.hpp>
 
-// SYCL & HIP backend used in blas, default is level0
-hipBlasBackend hipblas_backend = level0;
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Flushing: oneMKL submissions are pushed into the native Level Zero/OpenCL
+// queue by asking the runtime for the native handle of their event, which the
+// Intel SYCL runtime only returns once the command has been flushed. This is
+// unspecified but guaranteed behaviour; once the SYCL standard committee
+// approves sycl::queue::flush() it will be used instead. The backend the
+// handle's stream was created on tells which native handle to ask for.
+static void flush_event(syclQueue_t device_queue, const sycl::event &event) {
+    if (device_queue->backend == sycl::backend::opencl)
+        get_native<sycl::backend::opencl>(event);
+    else
+        get_native<sycl::backend::ext_oneapi_level_zero>(event);
+}
+
+// By default every submission is flushed on its own. With a flush batch of n
+// > 1 (syclQueue_st::flush_batch, HIPBLAS_ONEAPI_FLUSH_BATCH) only every n-th
+// submission on a queue is flushed, the others are pushed out by onemklFlush
+// at the next synchronization point. Flushing the last event of a queue
+// pushes out everything submitted to that queue before it. The pending event
+// and count live with the queue (syclQueue_st::pending), shared by all the
+// handles on the same native queue.
+
+static void submitted(syclQueue_t device_queue, const sycl::event &event) {
+    if (device_queue->val.ext_oneapi_get_state() == sycl::ext::oneapi::experimental::queue_state::recording) {
+        // part of a command graph, nothing to flush before it is launched
+        return;
+    }
+    int batch = device_queue->flush_batch;
+    if (batch <= 1) {
+        flush_event(device_queue, event);
+        return;
+    }
+    auto &pending = *device_queue->pending;
+    std::lock_guard<std::mutex> lock(pending.mutex);
+    pending.last = event;
+    if (++pending.count >= batch) {
+        flush_event(device_queue, event);
+        pending.count = 0;
+    }
+}
+
+#define __FORCE_MKL_FLUSH__(queue, cmd) submitted(queue, cmd)
+
+extern "C" void onemklFlush(syclQueue_t device_queue) {
+    auto &pending = *device_queue->pending;
+    std::lock_guard<std::mutex> lock(pending.mutex);
+    if (pending.count > 0) {
+        flush_event(device_queue, pending.last);
+        pending.count = 0;
+        pending.last = sycl::event();
+    }
+}
 
-// This is a workaround to flush MKL submissions into Level-zero queue, 
-// using unspecified but guaranteed behavior of intel-sycl runtime. 
-// Once SYCL standard committee approves sycl::queue::flush() we will change the macro to use the same 
-#define __FORCE_MKL_FLUSH__(cmd)                 \
-    if (hipblas_backend == opencl)               \
-        get_native<sycl::backend::opencl>(cmd);  \
-    else                                         \
-        get_native<sycl::backend::ext_oneapi_level_zero>(cmd);
+extern "C" void onemklSubmitted(syclQueue_t device_queue, syclEvent_t event) {
+    submitted(device_queue, event->val);
+}
 
 // gemm
 
@@ -57,6 +112,77 @@ oneapi::mkl::diag convert(onemklDiag val) {
     }
 }
 
+// Scalars (alpha, beta, c, s, ...) are always taken by pointer and forwarded
+// as oneapi::mkl::value_or_pointer. The handle's pointer mode, carried by its
+// queue, decides how: in HIPBLAS_POINTER_MODE_HOST the value is read here, at
+// submission time, as the caller may reuse the memory as soon as the call
+// returns (this holds for USM host/shared memory too). In
+// HIPBLAS_POINTER_MODE_DEVICE the pointer is read by the kernel on the device.
+template <typename T>
+oneapi::mkl::value_or_pointer<T> scalar(syclQueue_t device_queue, const T *val) {
+    if (device_queue->host_scalars) {
+        return *val;
+    }
+    return val;
+}
+
+oneapi::mkl::value_or_pointer<std::complex<float>> scalar(syclQueue_t device_queue, const float _Complex *val) {
+    return scalar(device_queue, reinterpret_cast<const std::complex<float> *>(val));
+}
+
+oneapi::mkl::value_or_pointer<std::complex<double>> scalar(syclQueue_t device_queue, const double _Complex *val) {
+    return scalar(device_queue, reinterpret_cast<const std::complex<double> *>(val));
+}
+
+oneapi::mkl::value_or_pointer<sycl::half> scalar(syclQueue_t device_queue, const uint16_t *val) {
+    return scalar(device_queue, reinterpret_cast<const sycl::half *>(val));
+}
+
+// Views of the C API arrays and scalars with the element types the SYCL
+// kernels in onemkl_kernels.hpp work on.
+template <typename T> struct sycl_type { using type = T; };
+template <typename T> struct sycl_type<const T> { using type = const typename sycl_type<T>::type; };
+template <> struct sycl_type<float _Complex> { using type = std::complex<float>; };
+template <> struct sycl_type<double _Complex> { using type = std::complex<double>; };
+template <> struct sycl_type<short> { using type = sycl::half; };
+template <> struct sycl_type<uint16_t> { using type = sycl::half; };
+
+template <typename T>
+typename sycl_type<T>::type *as_sycl(T *p) {
+    return reinterpret_cast<typename sycl_type<T>::type *>(p);
+}
+
+template <typename T>
+onemkl_kernels::pointer_batch<typename sycl_type<T>::type> batch_view(T **ptrs) {
+    return {reinterpret_cast<typename sycl_type<T>::type **>(ptrs)};
+}
+
+template <typename T>
+onemkl_kernels::strided_batch<typename sycl_type<T>::type> batch_view(T *base, int64_t stride) {
+    return {as_sycl(base), stride};
+}
+
+onemkl_kernels::op kernel_op(onemklTranspose val) {
+    switch (val) {
+    case ONEMKL_TRANSPOSE_NONTRANS:
+        return onemkl_kernels::op::none;
+    case ONEMKL_TRANSPOSE_TRANS:
+        return onemkl_kernels::op::trans;
+    case ONEMLK_TRANSPOSE_CONJTRANS:
+        return onemkl_kernels::op::conj_trans;
+    }
+}
+
+// the kernels accumulate half precision products in float
+template <typename T>
+using accumulate_type = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+template <typename T>
+onemkl_kernels::kernel_scalar<typename sycl_type<T>::type> scalar_arg(syclQueue_t device_queue, const T *val) {
+    return onemkl_kernels::make_scalar(device_queue->host_scalars,
+                                       reinterpret_cast<const typename sycl_type<T>::type *>(val));
+}
+
 extern "C" void onemklHdot(syclQueue_t device_queue, int64_t n,
                            const short *x, int64_t incx, const short *y,
                            int64_t incy, short *result) {
@@ -64,7 +190,7 @@ extern "C" void onemklHdot(syclQueue_t device_queue, int64_t n,
                             reinterpret_cast<const sycl::half *>(x), incx,
                             reinterpret_cast<const sycl::half *>(y), incy,
                             reinterpret_cast<sycl::half *>(result));
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSdot(syclQueue_t device_queue, int64_t n,
@@ -72,7 +198,7 @@ extern "C" void onemklSdot(syclQueue_t device_queue, int64_t n,
                            int64_t incy, float *result) {
     auto status = oneapi::mkl::blas::column_major::dot(device_queue->val, n, x,
                                                        incx, y, incy, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDdot(syclQueue_t device_queue, int64_t n,
@@ -80,7 +206,7 @@ extern "C" void onemklDdot(syclQueue_t device_queue, int64_t n,
                            int64_t incy, double *result) {
     auto status = oneapi::mkl::blas::column_major::dot(device_queue->val, n, x,
                                                        incx, y, incy, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCdotc(syclQueue_t device_queue, int64_t n,
@@ -90,7 +216,7 @@ extern "C" void onemklCdotc(syclQueue_t device_queue, int64_t n,
                                                 reinterpret_cast<const std::complex<float> *>(x), incx,
                                                 reinterpret_cast<const std::complex<float> *>(y), incy,
                                                 reinterpret_cast<std::complex<float> *>(result));
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZdotc(syclQueue_t device_queue, int64_t n,
@@ -100,7 +226,7 @@ extern "C" void onemklZdotc(syclQueue_t device_queue, int64_t n,
                                                 reinterpret_cast<const std::complex<double> *>(x), incx,
                                                 reinterpret_cast<const std::complex<double> *>(y), incy,
                                                 reinterpret_cast<std::complex<double> *>(result));
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCdotu(syclQueue_t device_queue, int64_t n,
@@ -110,7 +236,7 @@ extern "C" void onemklCdotu(syclQueue_t device_queue, int64_t n,
                                                 reinterpret_cast<const std::complex<float> *>(x), incx,
                                                 reinterpret_cast<const std::complex<float> *>(y), incy,
                                                 reinterpret_cast<std::complex<float> *>(result));
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZdotu(syclQueue_t device_queue, int64_t n,
@@ -120,7 +246,7 @@ extern "C" void onemklZdotu(syclQueue_t device_queue, int64_t n,
                                                 reinterpret_cast<const std::complex<double> *>(x), incx,
                                                 reinterpret_cast<const std::complex<double> *>(y), incy,
                                                 reinterpret_cast<std::complex<double> *>(result));
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSasum(syclQueue_t device_queue, int64_t n, 
@@ -128,7 +254,7 @@ extern "C" void onemklSasum(syclQueue_t device_queue, int64_t n,
                             float *result) {
     auto status = oneapi::mkl::blas::column_major::asum(device_queue->val, n, x,
                                                         incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDasum(syclQueue_t device_queue, int64_t n,
@@ -136,7 +262,7 @@ extern "C" void onemklDasum(syclQueue_t device_queue, int64_t n,
                             double *result) {
     auto status = oneapi::mkl::blas::column_major::asum(device_queue->val, n, x,
                                                         incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCasum(syclQueue_t device_queue, int64_t n,
@@ -145,7 +271,7 @@ extern "C" void onemklCasum(syclQueue_t device_queue, int64_t n,
     auto status = oneapi::mkl::blas::column_major::asum(device_queue->val, n, 
                                         reinterpret_cast<const std::complex<float> *>(x),
                                         incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZasum(syclQueue_t device_queue, int64_t n,
@@ -154,160 +280,926 @@ extern "C" void onemklZasum(syclQueue_t device_queue, int64_t n,
     auto status = oneapi::mkl::blas::column_major::asum(device_queue->val, n, 
                                         reinterpret_cast<const std::complex<double> *>(x),
                                         incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklHaxpy(syclQueue_t device_queue, int64_t n, uint16_t alpha,
+extern "C" void onemklHaxpy(syclQueue_t device_queue, int64_t n, const uint16_t *alpha,
                             const short *x, std::int64_t incx, short *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n,
-                            sycl::bit_cast<sycl::half>(alpha), reinterpret_cast<const sycl::half *>(x),
+                            scalar(device_queue, alpha), reinterpret_cast<const sycl::half *>(x),
                             incx, reinterpret_cast<sycl::half *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSaxpy(syclQueue_t device_queue, int64_t n, float alpha,
+extern "C" void onemklSaxpy(syclQueue_t device_queue, int64_t n, const float *alpha,
                             const float *x, std::int64_t incx, float *y, int64_t incy) {
-    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, alpha, x,
+    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, scalar(device_queue, alpha), x,
                                                 incx, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklDaxpy(syclQueue_t device_queue, int64_t n, double alpha, 
+extern "C" void onemklDaxpy(syclQueue_t device_queue, int64_t n, const double *alpha, 
                             const double *x, std::int64_t incx, double *y, int64_t incy) {
-    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, alpha, x,
+    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, scalar(device_queue, alpha), x,
                                                 incx, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklCaxpy(syclQueue_t device_queue, int64_t n, float _Complex alpha,
+extern "C" void onemklCaxpy(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
                         const float _Complex *x, std::int64_t incx, float _Complex *y, int64_t incy) {
-    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, scalar(device_queue, alpha),
                             reinterpret_cast<const std::complex<float> *>(x), incx,
                             reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklZaxpy(syclQueue_t device_queue, int64_t n, double _Complex alpha,
+extern "C" void onemklZaxpy(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
                         const double _Complex *x, std::int64_t incx, double _Complex *y, int64_t incy) {
-    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::axpy(device_queue->val, n, scalar(device_queue, alpha),
                             reinterpret_cast<const std::complex<double> *>(x), incx,
                             reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSaxpy_strided(syclQueue_t device_queue, int64_t n, float alpha, const float *x,
+extern "C" void onemklSaxpy_strided(syclQueue_t device_queue, int64_t n, const float *alpha, const float *x,
                 int64_t incx, int64_t stridex, float *y, int64_t incy, int64_t stridey, int64_t batch_size) {
-    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, alpha, x,
+    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, scalar(device_queue, alpha), x,
                                                 incx, stridex, y, incy, stridey, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklDaxpy_strided(syclQueue_t device_queue, int64_t n, double alpha, const double *x,
+extern "C" void onemklDaxpy_strided(syclQueue_t device_queue, int64_t n, const double *alpha, const double *x,
                 int64_t incx, int64_t stridex, double *y, int64_t incy, int64_t stridey, int64_t batch_size) {
-    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, alpha, x,
+    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, scalar(device_queue, alpha), x,
                                                 incx, stridex, y, incy, stridey, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklCaxpy_strided(syclQueue_t device_queue, int64_t n, float _Complex alpha,const float _Complex *x,
+extern "C" void onemklCaxpy_strided(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,const float _Complex *x,
                 int64_t incx, int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
-    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, scalar(device_queue, alpha),
                             reinterpret_cast<const std::complex<float> *>(x), incx, stridex,
                             reinterpret_cast<std::complex<float> *>(y), incy, stridey, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklZaxpy_strided(syclQueue_t device_queue, int64_t n, double _Complex alpha, const double _Complex *x,
+extern "C" void onemklZaxpy_strided(syclQueue_t device_queue, int64_t n, const double _Complex *alpha, const double _Complex *x,
                 int64_t incx, int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
-    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::axpy_batch(device_queue->val, n, scalar(device_queue, alpha),
                             reinterpret_cast<const std::complex<double> *>(x), incx, stridex,
                             reinterpret_cast<std::complex<double> *>(y), incy, stridey, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// Batched Level-1, a single kernel submission per batch (onemkl_kernels.hpp)
+extern "C" void onemklSscal_batch(syclQueue_t device_queue, int64_t n, const float *alpha, float **x,
+                int64_t incx, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDscal_batch(syclQueue_t device_queue, int64_t n, const double *alpha, double **x,
+                int64_t incx, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCscal_batch(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
+                float _Complex **x, int64_t incx, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZscal_batch(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
+                double _Complex **x, int64_t incx, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsscal_batch(syclQueue_t device_queue, int64_t n, const float *alpha,
+                float _Complex **x, int64_t incx, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdscal_batch(syclQueue_t device_queue, int64_t n, const double *alpha,
+                double _Complex **x, int64_t incx, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklHaxpy_batch(syclQueue_t device_queue, int64_t n, const uint16_t *alpha,
+                const short **x, int64_t incx, short **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::axpy(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSaxpy_batch(syclQueue_t device_queue, int64_t n, const float *alpha, const float **x,
+                int64_t incx, float **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::axpy(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDaxpy_batch(syclQueue_t device_queue, int64_t n, const double *alpha, const double **x,
+                int64_t incx, double **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::axpy(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCaxpy_batch(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
+                const float _Complex **x, int64_t incx, float _Complex **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::axpy(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZaxpy_batch(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
+                const double _Complex **x, int64_t incx, double _Complex **y, int64_t incy,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::axpy(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x), incx, batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklScopy_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                float **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDcopy_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                double **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCcopy_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, float _Complex **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZcopy_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, double _Complex **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSswap_batch(syclQueue_t device_queue, int64_t n, float **x, int64_t incx, float **y,
+                int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDswap_batch(syclQueue_t device_queue, int64_t n, double **x, int64_t incx, double **y,
+                int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCswap_batch(syclQueue_t device_queue, int64_t n, float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZswap_batch(syclQueue_t device_queue, int64_t n, double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSdot_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                const float **y, int64_t incy, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::dot<float, false>(device_queue->val, n, batch_view(x), incx, batch_view(y),
+                incy, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDdot_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                const double **y, int64_t incy, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::dot<double, false>(device_queue->val, n, batch_view(x), incx,
+                batch_view(y), incy, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdotu_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, const float _Complex **y, int64_t incy, int64_t batch_size,
+                float _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<float>, false>(device_queue->val, n, batch_view(x), incx,
+                batch_view(y), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdotc_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, const float _Complex **y, int64_t incy, int64_t batch_size,
+                float _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<float>, true>(device_queue->val, n, batch_view(x), incx,
+                batch_view(y), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdotu_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, const double _Complex **y, int64_t incy, int64_t batch_size,
+                double _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<double>, false>(device_queue->val, n, batch_view(x), incx,
+                batch_view(y), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdotc_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, const double _Complex **y, int64_t incy, int64_t batch_size,
+                double _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<double>, true>(device_queue->val, n, batch_view(x), incx,
+                batch_view(y), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSasum_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::asum<float>(device_queue->val, n, batch_view(x), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDasum_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::asum<double>(device_queue->val, n, batch_view(x), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCasum_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::asum<std::complex<float>>(device_queue->val, n, batch_view(x), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZasum_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::asum<std::complex<double>>(device_queue->val, n, batch_view(x), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSnrm2_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::nrm2<float>(device_queue->val, n, batch_view(x), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDnrm2_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::nrm2<double>(device_queue->val, n, batch_view(x), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCnrm2_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::nrm2<std::complex<float>>(device_queue->val, n, batch_view(x), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZnrm2_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::nrm2<std::complex<double>>(device_queue->val, n, batch_view(x), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamax_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<float, true>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamax_batch_64(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<float, true>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamax_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<double, true>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamax_batch_64(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<double, true>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamax_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, true>(device_queue->val, n, batch_view(x), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamax_batch_64(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, true>(device_queue->val, n, batch_view(x), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamax_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, true>(device_queue->val, n, batch_view(x),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamax_batch_64(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, true>(device_queue->val, n, batch_view(x),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamin_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<float, false>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamin_batch_64(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<float, false>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamin_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<double, false>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamin_batch_64(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<double, false>(device_queue->val, n, batch_view(x), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamin_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, false>(device_queue->val, n, batch_view(x),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamin_batch_64(syclQueue_t device_queue, int64_t n, const float _Complex **x,
+                int64_t incx, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, false>(device_queue->val, n, batch_view(x),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamin_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, false>(device_queue->val, n, batch_view(x),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamin_batch_64(syclQueue_t device_queue, int64_t n, const double _Complex **x,
+                int64_t incx, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, false>(device_queue->val, n, batch_view(x),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSrot_batch(syclQueue_t device_queue, int64_t n, float **x, int64_t incx, float **y,
+                int64_t incy, const float *c, const float *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                scalar_arg(device_queue, c), scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDrot_batch(syclQueue_t device_queue, int64_t n, double **x, int64_t incx, double **y,
+                int64_t incy, const double *c, const double *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                scalar_arg(device_queue, c), scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCrot_batch(syclQueue_t device_queue, int64_t n, float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, const float *c, const float _Complex *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                scalar_arg(device_queue, c), scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsrot_batch(syclQueue_t device_queue, int64_t n, float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, const float *c, const float *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                scalar_arg(device_queue, c), scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZrot_batch(syclQueue_t device_queue, int64_t n, double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, const double *c, const double _Complex *s,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                scalar_arg(device_queue, c), scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdrot_batch(syclQueue_t device_queue, int64_t n, double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, const double *c, const double *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x), incx, batch_view(y), incy,
+                scalar_arg(device_queue, c), scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSscal_strided(syclQueue_t device_queue, int64_t n, const float *alpha, float *x,
+                int64_t incx, int64_t stridex, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDscal_strided(syclQueue_t device_queue, int64_t n, const double *alpha, double *x,
+                int64_t incx, int64_t stridex, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCscal_strided(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
+                float _Complex *x, int64_t incx, int64_t stridex, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZscal_strided(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
+                double _Complex *x, int64_t incx, int64_t stridex, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsscal_strided(syclQueue_t device_queue, int64_t n, const float *alpha,
+                float _Complex *x, int64_t incx, int64_t stridex, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdscal_strided(syclQueue_t device_queue, int64_t n, const double *alpha,
+                double _Complex *x, int64_t incx, int64_t stridex, int64_t batch_size) {
+    auto status = onemkl_kernels::scal(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklHaxpy_strided(syclQueue_t device_queue, int64_t n, const uint16_t *alpha,
+                const short *x, int64_t incx, int64_t stridex, short *y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::axpy(device_queue->val, n, scalar_arg(device_queue, alpha),
+                batch_view(x, stridex), incx, batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklScopy_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, float *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDcopy_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, double *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCcopy_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZcopy_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::copy(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSswap_strided(syclQueue_t device_queue, int64_t n, float *x, int64_t incx,
+                int64_t stridex, float *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDswap_strided(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
+                int64_t stridex, double *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCswap_strided(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZswap_strided(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::swap(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSdot_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, const float *y, int64_t incy, int64_t stridey, int64_t batch_size,
+                float *result) {
+    auto status = onemkl_kernels::dot<float, false>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDdot_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, const double *y, int64_t incy, int64_t stridey, int64_t batch_size,
+                double *result) {
+    auto status = onemkl_kernels::dot<double, false>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdotu_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, const float _Complex *y, int64_t incy, int64_t stridey,
+                int64_t batch_size, float _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<float>, false>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_view(y, stridey), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdotc_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, const float _Complex *y, int64_t incy, int64_t stridey,
+                int64_t batch_size, float _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<float>, true>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_view(y, stridey), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdotu_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, const double _Complex *y, int64_t incy, int64_t stridey,
+                int64_t batch_size, double _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<double>, false>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_view(y, stridey), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdotc_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, const double _Complex *y, int64_t incy, int64_t stridey,
+                int64_t batch_size, double _Complex *result) {
+    auto status = onemkl_kernels::dot<std::complex<double>, true>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_view(y, stridey), incy, batch_size, as_sycl(result));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSasum_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::asum<float>(device_queue->val, n, batch_view(x, stridex), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDasum_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::asum<double>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCasum_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::asum<std::complex<float>>(device_queue->val, n, batch_view(x, stridex),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZasum_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::asum<std::complex<double>>(device_queue->val, n, batch_view(x, stridex),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSnrm2_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::nrm2<float>(device_queue->val, n, batch_view(x, stridex), incx, batch_size,
+                result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDnrm2_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::nrm2<double>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCnrm2_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, float *result) {
+    auto status = onemkl_kernels::nrm2<std::complex<float>>(device_queue->val, n, batch_view(x, stridex),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZnrm2_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, double *result) {
+    auto status = onemkl_kernels::nrm2<std::complex<double>>(device_queue->val, n, batch_view(x, stridex),
+                incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamax_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<float, true>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamax_strided_64(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<float, true>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamax_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<double, true>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamax_strided_64(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<double, true>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamax_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, true>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamax_strided_64(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, true>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamax_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, true>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamax_strided_64(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, true>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamin_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<float, false>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSamin_strided_64(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<float, false>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamin_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<double, false>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDamin_strided_64(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<double, false>(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamin_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, false>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCamin_strided_64(syclQueue_t device_queue, int64_t n, const float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<float>, false>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamin_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, false>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZamin_strided_64(syclQueue_t device_queue, int64_t n, const double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size, int64_t *result) {
+    auto status = onemkl_kernels::iamax<std::complex<double>, false>(device_queue->val, n,
+                batch_view(x, stridex), incx, batch_size, result);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSrot_strided(syclQueue_t device_queue, int64_t n, float *x, int64_t incx,
+                int64_t stridex, float *y, int64_t incy, int64_t stridey, const float *c, const float *s,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, scalar_arg(device_queue, c),
+                scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDrot_strided(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
+                int64_t stridex, double *y, int64_t incy, int64_t stridey, const double *c, const double *s,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, scalar_arg(device_queue, c),
+                scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCrot_strided(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, const float *c,
+                const float _Complex *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, scalar_arg(device_queue, c),
+                scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsrot_strided(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, const float *c,
+                const float *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, scalar_arg(device_queue, c),
+                scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZrot_strided(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, const double *c,
+                const double _Complex *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, scalar_arg(device_queue, c),
+                scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdrot_strided(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, const double *c,
+                const double *s, int64_t batch_size) {
+    auto status = onemkl_kernels::rot(device_queue->val, n, batch_view(x, stridex), incx,
+                batch_view(y, stridey), incy, scalar_arg(device_queue, c),
+                scalar_arg(device_queue, s), batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 // Support Level-1: SCAL primitive
-extern "C" void onemklDscal(syclQueue_t device_queue, int64_t n, double alpha,
+extern "C" void onemklDscal(syclQueue_t device_queue, int64_t n, const double *alpha,
                             double *x, int64_t incx) {
-    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, scalar(device_queue, alpha),
                                                     x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 
 }
 
-extern "C" void onemklSscal(syclQueue_t device_queue, int64_t n, float alpha,
+extern "C" void onemklSscal(syclQueue_t device_queue, int64_t n, const float *alpha,
                             float *x, int64_t incx) {
-    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, scalar(device_queue, alpha),
                                                          x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCscal(syclQueue_t device_queue, int64_t n,
-                            float _Complex alpha, float _Complex *x,
+                            const float _Complex *alpha, float _Complex *x,
                             int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n,
-                                        static_cast<std::complex<float> >(alpha),
+                                        scalar(device_queue, alpha),
                                         reinterpret_cast<std::complex<float> *>(x),incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCsscal(syclQueue_t device_queue, int64_t n,
-                            float alpha, float _Complex *x,
+                            const float *alpha, float _Complex *x,
                             int64_t incx) {
-    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, scalar(device_queue, alpha),
                                         reinterpret_cast<std::complex<float> *>(x),incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZscal(syclQueue_t device_queue, int64_t n,
-                            double _Complex alpha, double _Complex *x,
+                            const double _Complex *alpha, double _Complex *x,
                             int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n,
-                                        static_cast<std::complex<double> >(alpha),
+                                        scalar(device_queue, alpha),
                                         reinterpret_cast<std::complex<double> *>(x),incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZdscal(syclQueue_t device_queue, int64_t n,
-                            double alpha, double _Complex *x,
+                            const double *alpha, double _Complex *x,
                             int64_t incx) {
-    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, alpha,
+    auto status = oneapi::mkl::blas::column_major::scal(device_queue->val, n, scalar(device_queue, alpha),
                                         reinterpret_cast<std::complex<double> *>(x),incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDnrm2(syclQueue_t device_queue, int64_t n, const double *x,
                             int64_t incx, double *result) {
     auto status = oneapi::mkl::blas::column_major::nrm2(device_queue->val, n, x, incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSnrm2(syclQueue_t device_queue, int64_t n, const float *x,
                             int64_t incx, float *result) {
     auto status = oneapi::mkl::blas::column_major::nrm2(device_queue->val, n, x, incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCnrm2(syclQueue_t device_queue, int64_t n, const float _Complex *x,
                             int64_t incx, float *result) {
     auto status = oneapi::mkl::blas::column_major::nrm2(device_queue->val, n,
                     reinterpret_cast<const std::complex<float> *>(x), incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZnrm2(syclQueue_t device_queue, int64_t n, const double _Complex *x,
                             int64_t incx, double *result) {
     auto status = oneapi::mkl::blas::column_major::nrm2(device_queue->val, n,
                     reinterpret_cast<const std::complex<double> *>(x), incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDcopy(syclQueue_t device_queue, int64_t n, const double *x,
                             int64_t incx, double *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::copy(device_queue->val, n, x, incx, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklScopy(syclQueue_t device_queue, int64_t n, const float *x,
                             int64_t incx, float *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::copy(device_queue->val, n, x, incx, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZcopy(syclQueue_t device_queue, int64_t n, const double _Complex *x,
@@ -315,7 +1207,7 @@ extern "C" void onemklZcopy(syclQueue_t device_queue, int64_t n, const double _C
     auto status = oneapi::mkl::blas::column_major::copy(device_queue->val, n,
         reinterpret_cast<const std::complex<double> *>(x), incx,
         reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCcopy(syclQueue_t device_queue, int64_t n, const float _Complex *x,
@@ -323,65 +1215,81 @@ extern "C" void onemklCcopy(syclQueue_t device_queue, int64_t n, const float _Co
     auto status = oneapi::mkl::blas::column_major::copy(device_queue->val, n,
         reinterpret_cast<const std::complex<float> *>(x), incx,
         reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDamax(syclQueue_t device_queue, int64_t n, const double *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamax(device_queue->val, n, x, incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklSamax(syclQueue_t device_queue, int64_t n, const float  *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamax(device_queue->val, n, x, incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZamax(syclQueue_t device_queue, int64_t n, const double _Complex *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamax(device_queue->val, n,
                             reinterpret_cast<const std::complex<double> *>(x), incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCamax(syclQueue_t device_queue, int64_t n, const float _Complex *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamax(device_queue->val, n,
                             reinterpret_cast<const std::complex<float> *>(x), incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDamin(syclQueue_t device_queue, int64_t n, const double *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamin(device_queue->val, n, x, incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklSamin(syclQueue_t device_queue, int64_t n, const float  *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamin(device_queue->val, n, x, incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZamin(syclQueue_t device_queue, int64_t n, const double _Complex *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamin(device_queue->val, n,
                             reinterpret_cast<const std::complex<double> *>(x), incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCamin(syclQueue_t device_queue, int64_t n, const float _Complex *x,
                             int64_t incx, int64_t *result){
     auto status = oneapi::mkl::blas::column_major::iamin(device_queue->val, n,
                             reinterpret_cast<const std::complex<float> *>(x), incx, result);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// oneMKL returns a 0-based int64_t index while hipBLAS expects a 1-based int,
+// convert it on the device so the result never has to visit the host.
+extern "C" void onemklIndexResultToInt(syclQueue_t device_queue, const int64_t *src, int *dst){
+    auto status = device_queue->val.single_task([=]() {
+        *dst = (int)(*src + 1);
+    });
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklIndexResultToInt64(syclQueue_t device_queue, const int64_t *src, int64_t *dst){
+    auto status = device_queue->val.single_task([=]() {
+        *dst = *src + 1;
+    });
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSswap(syclQueue_t device_queue, int64_t n, float *x, int64_t incx,\
                             float *y, int64_t incy){
     auto status = oneapi::mkl::blas::column_major::swap(device_queue->val, n, x, incx, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDswap(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
                             double *y, int64_t incy){
     auto status = oneapi::mkl::blas::column_major::swap(device_queue->val, n, x, incx, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCswap(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
@@ -389,7 +1297,7 @@ extern "C" void onemklCswap(syclQueue_t device_queue, int64_t n, float _Complex
     auto status = oneapi::mkl::blas::column_major::swap(device_queue->val, n,
                             reinterpret_cast<std::complex<float> *>(x), incx,
                             reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZswap(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
@@ -397,558 +1305,766 @@ extern "C" void onemklZswap(syclQueue_t device_queue, int64_t n, double _Complex
     auto status = oneapi::mkl::blas::column_major::swap(device_queue->val, n,
                             reinterpret_cast<std::complex<double> *>(x), incx,
                             reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSrot(syclQueue_t device_queue, int n, float* x, int incx, float* y, int incy,
-                const float c, const float s){
-    auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n, x, incx, y, incy, c, s);
-    __FORCE_MKL_FLUSH__(status);
+extern "C" void onemklSrot(syclQueue_t device_queue, int64_t n, float* x, int64_t incx, float* y, int64_t incy,
+                const float *c, const float *s){
+    auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n, x, incx, y, incy, scalar(device_queue, c), scalar(device_queue, s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklDrot(syclQueue_t device_queue, int n, double* x, int incx, double* y, int incy,
-                const double c, const double s){
-    auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n, x, incx, y, incy, c, s);
-    __FORCE_MKL_FLUSH__(status);
+extern "C" void onemklDrot(syclQueue_t device_queue, int64_t n, double* x, int64_t incx, double* y, int64_t incy,
+                const double *c, const double *s){
+    auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n, x, incx, y, incy, scalar(device_queue, c), scalar(device_queue, s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklCrot(syclQueue_t device_queue, int n, float _Complex* x, int incx, float _Complex* y, int incy,
-                const float c, const float _Complex s){
+extern "C" void onemklCrot(syclQueue_t device_queue, int64_t n, float _Complex* x, int64_t incx, float _Complex* y, int64_t incy,
+                const float *c, const float _Complex *s){
     auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n,
                     reinterpret_cast<std::complex<float> *>(x), incx,
                     reinterpret_cast<std::complex<float> *>(y), incy,
-                    c, static_cast<std::complex<float> >(s));
-    __FORCE_MKL_FLUSH__(status);
+                    scalar(device_queue, c), scalar(device_queue, s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklCsrot(syclQueue_t device_queue, int n, float _Complex* x, int incx, float _Complex* y, int incy,
-                const float c, const float s){
+extern "C" void onemklCsrot(syclQueue_t device_queue, int64_t n, float _Complex* x, int64_t incx, float _Complex* y, int64_t incy,
+                const float *c, const float *s){
     auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n,
                     reinterpret_cast<std::complex<float> *>(x), incx,
-                    reinterpret_cast<std::complex<float> *>(y), incy, c, s);
-    __FORCE_MKL_FLUSH__(status);
+                    reinterpret_cast<std::complex<float> *>(y), incy, scalar(device_queue, c), scalar(device_queue, s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklZrot(syclQueue_t device_queue, int n, double _Complex* x, int incx, double _Complex* y, int incy,
-                const double c, const double _Complex s){
+extern "C" void onemklZrot(syclQueue_t device_queue, int64_t n, double _Complex* x, int64_t incx, double _Complex* y, int64_t incy,
+                const double *c, const double _Complex *s){
     auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n,
                     reinterpret_cast<std::complex<double> *>(x), incx,
                     reinterpret_cast<std::complex<double> *>(y), incy,
-                    c, static_cast<std::complex<double> >(s));
-    __FORCE_MKL_FLUSH__(status);
+                    scalar(device_queue, c), scalar(device_queue, s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklZdrot(syclQueue_t device_queue, int n, double _Complex* x, int incx, double _Complex* y, int incy,
-                const double c, const double s){
+extern "C" void onemklZdrot(syclQueue_t device_queue, int64_t n, double _Complex* x, int64_t incx, double _Complex* y, int64_t incy,
+                const double *c, const double *s){
     auto status = oneapi::mkl::blas::column_major::rot(device_queue->val, n,
                     reinterpret_cast<std::complex<double> *>(x), incx,
-                    reinterpret_cast<std::complex<double> *>(y), incy, c, s);
-    __FORCE_MKL_FLUSH__(status);
+                    reinterpret_cast<std::complex<double> *>(y), incy, scalar(device_queue, c), scalar(device_queue, s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// rotg, rotmg and rotm follow the pointer mode of the handle. With
+// HIPBLAS_POINTER_MODE_HOST the arguments are plain host memory (for Batched a
+// host array of host pointers), the values are computed right here and nothing
+// is submitted. Device pointers are handled by one kernel for the whole batch,
+// so the results never leave the device.
+template <typename BA, typename BB, typename BC, typename BS>
+void rotg_batch(syclQueue_t device_queue, BA a, BB b, BC c, BS s, int64_t batch_size) {
+    if (device_queue->host_scalars) {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            onemkl_kernels::rotg_values(a[i][0], b[i][0], c[i][0], s[i][0]);
+        }
+        return;
+    }
+    auto status = onemkl_kernels::rotg(device_queue->val, a, b, c, s, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSrotg(syclQueue_t device_queue, float* a, float* b, float* c, float* s){
-    auto status = oneapi::mkl::blas::column_major::rotg(device_queue->val, a, b, c, s);
-    __FORCE_MKL_FLUSH__(status);
+template <typename BD1, typename BD2, typename BX, typename BY, typename BP>
+void rotmg_batch(syclQueue_t device_queue, BD1 d1, BD2 d2, BX x1, BY y1, BP param, int64_t batch_size) {
+    if (device_queue->host_scalars) {
+        for (int64_t i = 0; i < batch_size; ++i) {
+            onemkl_kernels::rotmg_values(d1[i][0], d2[i][0], x1[i][0], y1[i][0], param[i]);
+        }
+        return;
+    }
+    auto status = onemkl_kernels::rotmg(device_queue->val, d1, d2, x1, y1, param, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// x and y are always device vectors. Host parameters are staged in
+// 'workspace', a device buffer of 5 * batch_size elements owned by the handle.
+// The transfer reads a private copy of them, which a host task submitted after
+// the kernel keeps alive, so nothing here waits for the device.
+template <typename T, typename BX, typename BY, typename BP>
+void rotm_batch(syclQueue_t device_queue, int64_t n, BX x, int64_t incx, BY y, int64_t incy, BP param,
+                int64_t batch_size, T *workspace) {
+    auto &q = device_queue->val;
+    if (!device_queue->host_scalars) {
+        auto status = onemkl_kernels::rotm<T>(q, n, x, incx, y, incy, param, batch_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+        return;
+    }
+    auto h_param = std::make_shared<std::vector<T>>(5 * batch_size);
+    for (int64_t i = 0; i < batch_size; ++i) {
+        std::copy(param[i], param[i] + 5, h_param->begin() + 5 * i);
+    }
+    auto copy = q.memcpy(workspace, h_param->data(), h_param->size() * sizeof(T));
+    auto status = onemkl_kernels::rotm<T>(q, n, x, incx, y, incy,
+                onemkl_kernels::strided_batch<const T>{workspace, 5}, batch_size);
+    q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(copy);
+        cgh.host_task([h_param] {});
+    });
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSrotg(syclQueue_t device_queue, float* a, float* b, float* c, float* s){
+    auto &q = device_queue->val;
+    if (device_queue->host_scalars) {
+        onemkl_kernels::rotg_values(*a, *b, *c, *s);
+        return;
+    }
+    auto status = oneapi::mkl::blas::column_major::rotg(q, a, b, c, s);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDrotg(syclQueue_t device_queue, double* a, double* b, double* c, double* s){
-    auto status = oneapi::mkl::blas::column_major::rotg(device_queue->val, a, b, c, s);
-    __FORCE_MKL_FLUSH__(status);
+    auto &q = device_queue->val;
+    if (device_queue->host_scalars) {
+        onemkl_kernels::rotg_values(*a, *b, *c, *s);
+        return;
+    }
+    auto status = oneapi::mkl::blas::column_major::rotg(q, a, b, c, s);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCrotg(syclQueue_t device_queue, float _Complex* a, float _Complex* b, float* c, float _Complex* s){
-    auto status = oneapi::mkl::blas::column_major::rotg(device_queue->val,
-                                                        reinterpret_cast<std::complex<float> *>(a),
-                                                        reinterpret_cast<std::complex<float> *>(b), c,
-                                                        reinterpret_cast<std::complex<float> *>(s));
-    __FORCE_MKL_FLUSH__(status);
+    auto &q = device_queue->val;
+    if (device_queue->host_scalars) {
+        onemkl_kernels::rotg_values(*as_sycl(a), *as_sycl(b), *c, *as_sycl(s));
+        return;
+    }
+    auto status = oneapi::mkl::blas::column_major::rotg(q, as_sycl(a), as_sycl(b), c, as_sycl(s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZrotg(syclQueue_t device_queue, double _Complex* a, double _Complex* b, double* c, double _Complex* s){
-    auto status = oneapi::mkl::blas::column_major::rotg(device_queue->val,
-                                                        reinterpret_cast<std::complex<double> *>(a),
-                                                        reinterpret_cast<std::complex<double> *>(b), c,
-                                                        reinterpret_cast<std::complex<double> *>(s));
-    __FORCE_MKL_FLUSH__(status);
+    auto &q = device_queue->val;
+    if (device_queue->host_scalars) {
+        onemkl_kernels::rotg_values(*as_sycl(a), *as_sycl(b), *c, *as_sycl(s));
+        return;
+    }
+    auto status = oneapi::mkl::blas::column_major::rotg(q, as_sycl(a), as_sycl(b), c, as_sycl(s));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSrotm(syclQueue_t device_queue, int64_t n, float *x, int64_t incx,
-                float *y, int64_t incy, float* param) {
-    auto status = oneapi::mkl::blas::column_major::rotm(device_queue->val, n, x, incx, y, incy, param);
-    __FORCE_MKL_FLUSH__(status);
+                float *y, int64_t incy, const float *param, float *workspace) {
+    if (device_queue->host_scalars) {
+        rotm_batch<float>(device_queue, n, batch_view(x, 0), incx, batch_view(y, 0), incy, batch_view(param, 0), 1,
+                        workspace);
+        return;
+    }
+    auto status = oneapi::mkl::blas::column_major::rotm(device_queue->val, n, x, incx, y, incy,
+                const_cast<float *>(param));
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDrotm(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
-                double *y, int64_t incy, double* param){
-    auto status = oneapi::mkl::blas::column_major::rotm(device_queue->val, n, x, incx, y, incy, param);
-    __FORCE_MKL_FLUSH__(status);
+                double *y, int64_t incy, const double *param, double *workspace) {
+    if (device_queue->host_scalars) {
+        rotm_batch<double>(device_queue, n, batch_view(x, 0), incx, batch_view(y, 0), incy, batch_view(param, 0), 1,
+                        workspace);
+        return;
+    }
+    auto status = oneapi::mkl::blas::column_major::rotm(device_queue->val, n, x, incx, y, incy,
+                const_cast<double *>(param));
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSrotg_batch(syclQueue_t device_queue, float **a, float **b, float **c, float **s,
+                int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a), batch_view(b), batch_view(c), batch_view(s), batch_size);
+}
+extern "C" void onemklDrotg_batch(syclQueue_t device_queue, double **a, double **b, double **c, double **s,
+                int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a), batch_view(b), batch_view(c), batch_view(s), batch_size);
+}
+extern "C" void onemklCrotg_batch(syclQueue_t device_queue, float _Complex **a, float _Complex **b, float **c,
+                float _Complex **s, int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a), batch_view(b), batch_view(c), batch_view(s), batch_size);
+}
+extern "C" void onemklZrotg_batch(syclQueue_t device_queue, double _Complex **a, double _Complex **b, double **c,
+                double _Complex **s, int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a), batch_view(b), batch_view(c), batch_view(s), batch_size);
+}
+
+extern "C" void onemklSrotg_strided(syclQueue_t device_queue, float *a, int64_t stridea, float *b,
+                int64_t strideb, float *c, int64_t stridec, float *s, int64_t strides, int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a, stridea), batch_view(b, strideb), batch_view(c, stridec),
+               batch_view(s, strides), batch_size);
+}
+extern "C" void onemklDrotg_strided(syclQueue_t device_queue, double *a, int64_t stridea, double *b,
+                int64_t strideb, double *c, int64_t stridec, double *s, int64_t strides, int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a, stridea), batch_view(b, strideb), batch_view(c, stridec),
+               batch_view(s, strides), batch_size);
+}
+extern "C" void onemklCrotg_strided(syclQueue_t device_queue, float _Complex *a, int64_t stridea,
+                float _Complex *b, int64_t strideb, float *c, int64_t stridec, float _Complex *s,
+                int64_t strides, int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a, stridea), batch_view(b, strideb), batch_view(c, stridec),
+               batch_view(s, strides), batch_size);
+}
+extern "C" void onemklZrotg_strided(syclQueue_t device_queue, double _Complex *a, int64_t stridea,
+                double _Complex *b, int64_t strideb, double *c, int64_t stridec, double _Complex *s,
+                int64_t strides, int64_t batch_size) {
+    rotg_batch(device_queue, batch_view(a, stridea), batch_view(b, strideb), batch_view(c, stridec),
+               batch_view(s, strides), batch_size);
+}
+
+extern "C" void onemklSrotm_batch(syclQueue_t device_queue, int64_t n, float **x, int64_t incx, float **y,
+                int64_t incy, const float **param, int64_t batch_size, float *workspace) {
+    rotm_batch<float>(device_queue, n, batch_view(x), incx, batch_view(y), incy,
+                      batch_view(param), batch_size, workspace);
+}
+extern "C" void onemklDrotm_batch(syclQueue_t device_queue, int64_t n, double **x, int64_t incx, double **y,
+                int64_t incy, const double **param, int64_t batch_size, double *workspace) {
+    rotm_batch<double>(device_queue, n, batch_view(x), incx, batch_view(y), incy,
+                       batch_view(param), batch_size, workspace);
+}
+
+extern "C" void onemklSrotm_strided(syclQueue_t device_queue, int64_t n, float *x, int64_t incx, int64_t stridex,
+                float *y, int64_t incy, int64_t stridey, const float *param, int64_t strideparam,
+                int64_t batch_size, float *workspace) {
+    rotm_batch<float>(device_queue, n, batch_view(x, stridex), incx, batch_view(y, stridey), incy,
+                      batch_view(param, strideparam), batch_size, workspace);
+}
+extern "C" void onemklDrotm_strided(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
+                int64_t stridex, double *y, int64_t incy, int64_t stridey, const double *param,
+                int64_t strideparam, int64_t batch_size, double *workspace) {
+    rotm_batch<double>(device_queue, n, batch_view(x, stridex), incx, batch_view(y, stridey),
+                       incy, batch_view(param, strideparam), batch_size, workspace);
+}
+
+extern "C" void onemklSrotmg(syclQueue_t device_queue, float *d1, float *d2, float *x1, const float *y1,
+                float *param) {
+    rotmg_batch(device_queue, batch_view(d1, 0), batch_view(d2, 0), batch_view(x1, 0),
+                batch_view(y1, 0), batch_view(param, 0), 1);
+}
+extern "C" void onemklDrotmg(syclQueue_t device_queue, double *d1, double *d2, double *x1, const double *y1,
+                double *param) {
+    rotmg_batch(device_queue, batch_view(d1, 0), batch_view(d2, 0), batch_view(x1, 0),
+                batch_view(y1, 0), batch_view(param, 0), 1);
+}
+
+extern "C" void onemklSrotmg_batch(syclQueue_t device_queue, float **d1, float **d2, float **x1,
+                const float **y1, float **param, int64_t batch_size) {
+    rotmg_batch(device_queue, batch_view(d1), batch_view(d2), batch_view(x1), batch_view(y1),
+                batch_view(param), batch_size);
+}
+extern "C" void onemklDrotmg_batch(syclQueue_t device_queue, double **d1, double **d2, double **x1,
+                const double **y1, double **param, int64_t batch_size) {
+    rotmg_batch(device_queue, batch_view(d1), batch_view(d2), batch_view(x1), batch_view(y1),
+                batch_view(param), batch_size);
+}
+
+extern "C" void onemklSrotmg_strided(syclQueue_t device_queue, float *d1, int64_t strided1, float *d2,
+                int64_t strided2, float *x1, int64_t stridex1, const float *y1, int64_t stridey1, float *param,
+                int64_t strideparam, int64_t batch_size) {
+    rotmg_batch(device_queue, batch_view(d1, strided1), batch_view(d2, strided2),
+                batch_view(x1, stridex1), batch_view(y1, stridey1), batch_view(param, strideparam), batch_size);
+}
+extern "C" void onemklDrotmg_strided(syclQueue_t device_queue, double *d1, int64_t strided1, double *d2,
+                int64_t strided2, double *x1, int64_t stridex1, const double *y1, int64_t stridey1,
+                double *param, int64_t strideparam, int64_t batch_size) {
+    rotmg_batch(device_queue, batch_view(d1, strided1), batch_view(d2, strided2),
+                batch_view(x1, stridex1), batch_view(y1, stridey1), batch_view(param, strideparam), batch_size);
 }
 
 // Level-2
 extern "C" void onemklSgbmv(syclQueue_t device_queue, onemklTranspose trans,
                             int64_t m, int64_t n, int64_t kl, int64_t ku,
-                            float alpha, const float *a, int64_t lda,
-                            const float *x, int64_t incx, float beta, float *y,
+                            const float *alpha, const float *a, int64_t lda,
+                            const float *x, int64_t incx, const float *beta, float *y,
                             int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gbmv(device_queue->val,
-                                convert(trans), m, n, kl, ku, alpha, a, lda, x,
-                                incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                convert(trans), m, n, kl, ku, scalar(device_queue, alpha), a, lda, x,
+                                incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDgbmv(syclQueue_t device_queue, onemklTranspose trans,
                             int64_t m, int64_t n, int64_t kl, int64_t ku,
-                            double alpha, const double *a, int64_t lda,
-                            const double *x, int64_t incx, double beta, double *y,
+                            const double *alpha, const double *a, int64_t lda,
+                            const double *x, int64_t incx, const double *beta, double *y,
                             int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gbmv(device_queue->val, convert(trans),
-                                    m, n, kl, ku, alpha, a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                    m, n, kl, ku, scalar(device_queue, alpha), a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCgbmv(syclQueue_t device_queue, onemklTranspose trans,
                             int64_t m, int64_t n, int64_t kl, int64_t ku,
-                            float _Complex alpha, const float _Complex *a, int64_t lda,
-                            const float _Complex *x, int64_t incx, float _Complex beta,
+                            const float _Complex *alpha, const float _Complex *a, int64_t lda,
+                            const float _Complex *x, int64_t incx, const float _Complex *beta,
                             float _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gbmv(device_queue->val, convert(trans),
-                                    m, n, kl, ku, static_cast<std::complex<float> >(alpha),
+                                    m, n, kl, ku, scalar(device_queue, alpha),
                                     reinterpret_cast<const std::complex<float> *>(a),
                                     lda, reinterpret_cast<const std::complex<float> *>(x),
-                                    incx, static_cast<std::complex<float> >(beta),
+                                    incx, scalar(device_queue, beta),
                                     reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZgbmv(syclQueue_t device_queue, onemklTranspose trans,
                             int64_t m, int64_t n, int64_t kl, int64_t ku,
-                            double _Complex alpha, const double _Complex *a, int64_t lda,
-                            const double _Complex *x, int64_t incx, double _Complex beta,
+                            const double _Complex *alpha, const double _Complex *a, int64_t lda,
+                            const double _Complex *x, int64_t incx, const double _Complex *beta,
                             double _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gbmv(device_queue->val, convert(trans), m,
-                                        n, kl, ku, static_cast<std::complex<double> >(alpha),
+                                        n, kl, ku, scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<double> *>(a),
                                         lda, reinterpret_cast<const std::complex<double> *>(x), incx,
-                                        static_cast<std::complex<double> >(beta),
+                                        scalar(device_queue, beta),
                                         reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSgemv(syclQueue_t device_queue, onemklTranspose trans,
-                            int64_t m, int64_t n, float alpha, const float *a,
-                            int64_t lda, const float *x, int64_t incx, float beta,
+                            int64_t m, int64_t n, const float *alpha, const float *a,
+                            int64_t lda, const float *x, int64_t incx, const float *beta,
                             float *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gemv(device_queue->val, convert(trans),
-                                            m, n, alpha, a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                            m, n, scalar(device_queue, alpha), a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDgemv(syclQueue_t device_queue, onemklTranspose trans,
-                            int64_t m, int64_t n, double alpha, const double *a,
-                            int64_t lda, const double *x, int64_t incx, double beta,
+                            int64_t m, int64_t n, const double *alpha, const double *a,
+                            int64_t lda, const double *x, int64_t incx, const double *beta,
                             double *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gemv(device_queue->val, convert(trans),
-                                            m, n, alpha, a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                            m, n, scalar(device_queue, alpha), a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCgemv(syclQueue_t device_queue, onemklTranspose trans,
-                            int64_t m, int64_t n, float _Complex alpha,
+                            int64_t m, int64_t n, const float _Complex *alpha,
                             const float _Complex *a, int64_t lda,
                             const float _Complex *x, int64_t incx,
-                            float _Complex beta, float _Complex *y,
+                            const float _Complex *beta, float _Complex *y,
                             int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gemv(device_queue->val, convert(trans), m, n,
-                                            static_cast<std::complex<float> >(alpha),
+                                            scalar(device_queue, alpha),
                                             reinterpret_cast<const std::complex<float> *>(a), lda,
                                             reinterpret_cast<const std::complex<float> *>(x), incx,
-                                            static_cast<std::complex<float> >(beta),
+                                            scalar(device_queue, beta),
                                             reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZgemv(syclQueue_t device_queue, onemklTranspose trans,
-                            int64_t m, int64_t n, double _Complex alpha,
+                            int64_t m, int64_t n, const double _Complex *alpha,
                             const double _Complex *a, int64_t lda,
                             const double _Complex *x, int64_t incx,
-                            double _Complex beta, double _Complex *y,
+                            const double _Complex *beta, double _Complex *y,
                             int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::gemv(device_queue->val, convert(trans), m, n,
-                                            static_cast<std::complex<double> >(alpha),
+                                            scalar(device_queue, alpha),
                                             reinterpret_cast<const std::complex<double> *>(a), lda,
                                             reinterpret_cast<const std::complex<double> *>(x), incx,
-                                            static_cast<std::complex<double> >(beta),
+                                            scalar(device_queue, beta),
                                             reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSger(syclQueue_t device_queue, int64_t m, int64_t n, float alpha,
+extern "C" void onemklSger(syclQueue_t device_queue, int64_t m, int64_t n, const float *alpha,
                            const float *x, int64_t incx, const float *y, int64_t incy,
                            float *a, int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::ger(device_queue->val, m, n, alpha, x,
+    auto status = oneapi::mkl::blas::column_major::ger(device_queue->val, m, n, scalar(device_queue, alpha), x,
                                                     incx, y, incy, a, lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklDger(syclQueue_t device_queue, int64_t m, int64_t n, double alpha,
+extern "C" void onemklDger(syclQueue_t device_queue, int64_t m, int64_t n, const double *alpha,
                            const double *x, int64_t incx, const double *y, int64_t incy,
                            double *a, int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::ger(device_queue->val, m, n, alpha, x,
+    auto status = oneapi::mkl::blas::column_major::ger(device_queue->val, m, n, scalar(device_queue, alpha), x,
                                                     incx, y, incy, a, lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklCgerc(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex alpha,
+extern "C" void onemklCgerc(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
                            const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                            float _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::gerc(device_queue->val, m, n,
-                                            static_cast<std::complex<float> >(alpha),
+                                            scalar(device_queue, alpha),
                                             reinterpret_cast<const std::complex<float> *>(x), incx,
                                             reinterpret_cast<const std::complex<float> *>(y), incy,
                                             reinterpret_cast<std::complex<float> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklCgeru(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex alpha,
+extern "C" void onemklCgeru(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
                            const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                            float _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::geru(device_queue->val, m, n,
-                                            static_cast<std::complex<float> >(alpha),
+                                            scalar(device_queue, alpha),
                                             reinterpret_cast<const std::complex<float> *>(x), incx,
                                             reinterpret_cast<const std::complex<float> *>(y), incy,
                                             reinterpret_cast<std::complex<float> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklZgerc(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex alpha,
+extern "C" void onemklZgerc(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
                            const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                            double _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::gerc(device_queue->val, m, n,
-                                          static_cast<std::complex<float> >(alpha),
+                                          scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<double> *>(x), incx,
                                           reinterpret_cast<const std::complex<double> *>(y), incy,
                                           reinterpret_cast<std::complex<double> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklZgeru(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex alpha,
+extern "C" void onemklZgeru(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
                            const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                            double _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::geru(device_queue->val, m, n,
-                                          static_cast<std::complex<float> >(alpha),
+                                          scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<double> *>(x), incx,
                                           reinterpret_cast<const std::complex<double> *>(y), incy,
                                           reinterpret_cast<std::complex<double> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklChbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                            int64_t k, float _Complex alpha, const float _Complex *a,
-                            int64_t lda, const float _Complex *x, int64_t incx, float _Complex beta,
+                            int64_t k, const float _Complex *alpha, const float _Complex *a,
+                            int64_t lda, const float _Complex *x, int64_t incx, const float _Complex *beta,
                             float _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::hbmv(device_queue->val, convert(uplo), n,
-                                          k, static_cast<std::complex<float> >(alpha),
+                                          k, scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<float> *>(a),
                                           lda, reinterpret_cast<const std::complex<float> *>(x),
-                                          incx, static_cast<std::complex<float> >(beta),
+                                          incx, scalar(device_queue, beta),
                                           reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZhbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                            int64_t k, double _Complex alpha, const double _Complex *a,
-                            int64_t lda, const double _Complex *x, int64_t incx, double _Complex beta,
+                            int64_t k, const double _Complex *alpha, const double _Complex *a,
+                            int64_t lda, const double _Complex *x, int64_t incx, const double _Complex *beta,
                             double _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::hbmv(device_queue->val, convert(uplo), n,
-                                          k, static_cast<std::complex<double> >(alpha),
+                                          k, scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<double> *>(a),
                                           lda, reinterpret_cast<const std::complex<double> *>(x),
-                                          incx, static_cast<std::complex<double> >(beta),
+                                          incx, scalar(device_queue, beta),
                                           reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklChemv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                            float _Complex alpha, const float _Complex *a, int64_t lda,
-                            const float _Complex *x, int64_t incx, float _Complex beta,
+                            const float _Complex *alpha, const float _Complex *a, int64_t lda,
+                            const float _Complex *x, int64_t incx, const float _Complex *beta,
                             float _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::hemv(device_queue->val, convert(uplo), n,
-                                          static_cast<std::complex<float> >(alpha),
+                                          scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<float> *>(a),
                                           lda, reinterpret_cast<const std::complex<float> *>(x), incx,
-                                          static_cast<std::complex<float> >(beta),
+                                          scalar(device_queue, beta),
                                           reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZhemv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                            double _Complex alpha, const double _Complex *a, int64_t lda,
-                            const double _Complex *x, int64_t incx, double _Complex beta,
+                            const double _Complex *alpha, const double _Complex *a, int64_t lda,
+                            const double _Complex *x, int64_t incx, const double _Complex *beta,
                             double _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::hemv(device_queue->val, convert(uplo), n,
-                                          static_cast<std::complex<double> >(alpha),
+                                          scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<double> *>(a),
                                           lda, reinterpret_cast<const std::complex<double> *>(x), incx,
-                                          static_cast<std::complex<double> >(beta),
+                                          scalar(device_queue, beta),
                                           reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// oneMKL's her, her2, hpr and hpr2 overwrite A for a zero alpha. hipBLAS
+// returns early for it in host pointer mode; a device alpha is instead read by
+// onemkl_kernels::her, which leaves A untouched without a host round trip.
+template <bool Two, bool Packed, typename S, typename T>
+sycl::event her_device(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const S *alpha, const T *x,
+                int64_t incx, const T *y, int64_t incy, T *a, int64_t lda) {
+    return onemkl_kernels::her<typename sycl_type<T>::type, Two, Packed>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(x, 0), incx,
+                batch_view(y, 0), incy, batch_view(a, 0), lda, 1);
 }
 
-extern "C" void onemklCher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+extern "C" void onemklCher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                            const float _Complex *x, int64_t incx, float _Complex *a,
                            int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::her(device_queue->val, convert(uplo), n, alpha,
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::her(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<float> *>(x), incx,
-                                        reinterpret_cast<std::complex<float> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+                                        reinterpret_cast<std::complex<float> *>(a), lda)
+                : her_device<false, false>(device_queue, uplo, n, alpha, x, incx, x, incx, a, lda);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklZher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+extern "C" void onemklZher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                            const double _Complex *x, int64_t incx, double _Complex *a,
                            int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::her(device_queue->val, convert(uplo), n, alpha,
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::her(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<double> *>(x), incx,
-                                        reinterpret_cast<std::complex<double> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+                                        reinterpret_cast<std::complex<double> *>(a), lda)
+                : her_device<false, false>(device_queue, uplo, n, alpha, x, incx, x, incx, a, lda);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklCher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+extern "C" void onemklCher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                             const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                             float _Complex *a, int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::her2(device_queue->val, convert(uplo), n,
-                                          static_cast<std::complex<float> >(alpha),
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::her2(device_queue->val, convert(uplo), n,
+                                          scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<float> *>(x), incx,
                                           reinterpret_cast<const std::complex<float> *>(y), incy,
-                                          reinterpret_cast<std::complex<float> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+                                          reinterpret_cast<std::complex<float> *>(a), lda)
+                : her_device<true, false>(device_queue, uplo, n, alpha, x, incx, y, incy, a, lda);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklZher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+extern "C" void onemklZher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                             const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                             double _Complex *a, int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::her2(device_queue->val, convert(uplo), n,
-                                          static_cast<std::complex<double> >(alpha),
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::her2(device_queue->val, convert(uplo), n,
+                                          scalar(device_queue, alpha),
                                           reinterpret_cast<const std::complex<double> *>(x), incx,
                                           reinterpret_cast<const std::complex<double> *>(y), incy,
-                                          reinterpret_cast<std::complex<double> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+                                          reinterpret_cast<std::complex<double> *>(a), lda)
+                : her_device<true, false>(device_queue, uplo, n, alpha, x, incx, y, incy, a, lda);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklChpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+extern "C" void onemklChpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                 const float _Complex *a, const float _Complex *x, int64_t incx,
-                float _Complex beta, float _Complex *y, int64_t incy)
+                const float _Complex *beta, float _Complex *y, int64_t incy)
 {
     auto status = oneapi::mkl::blas::column_major::hpmv(device_queue->val, convert(uplo), n,
-                                        static_cast<std::complex<float> >(alpha),
+                                        scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<float> *>(a),
                                         reinterpret_cast<const std::complex<float> *>(x), incx,
-                                        static_cast<std::complex<float> >(beta),
+                                        scalar(device_queue, beta),
                                         reinterpret_cast<std::complex<float> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklZhpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+extern "C" void onemklZhpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                 const double _Complex *a, const double _Complex *x, int64_t incx,
-                double _Complex beta, double _Complex *y, int64_t incy)
+                const double _Complex *beta, double _Complex *y, int64_t incy)
 {
     auto status = oneapi::mkl::blas::column_major::hpmv(device_queue->val, convert(uplo), n,
-                                        static_cast<std::complex<double> >(alpha),
+                                        scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<double> *>(a),
                                         reinterpret_cast<const std::complex<double> *>(x), incx,
-                                        static_cast<std::complex<double> >(beta),
+                                        scalar(device_queue, beta),
                                         reinterpret_cast<std::complex<double> *>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklChpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+extern "C" void onemklChpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                 const float _Complex *x, int64_t incx, float _Complex *a)
 {
-    auto status = oneapi::mkl::blas::column_major::hpr(device_queue->val, convert(uplo), n,
-                                        alpha, reinterpret_cast<const std::complex<float> *>(x), incx,
-                                        reinterpret_cast<std::complex<float> *>(a));
-    __FORCE_MKL_FLUSH__(status);
-}
-extern "C" void onemklZhpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::hpr(device_queue->val, convert(uplo), n,
+                                        scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(x), incx,
+                                        reinterpret_cast<std::complex<float> *>(a))
+                : her_device<false, true>(device_queue, uplo, n, alpha, x, incx, x, incx, a, 0);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZhpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                 const double _Complex *x, int64_t incx, double _Complex *a)
 {
-    auto status = oneapi::mkl::blas::column_major::hpr(device_queue->val, convert(uplo), n,
-                                        alpha, reinterpret_cast<const std::complex<double> *>(x), incx,
-                                        reinterpret_cast<std::complex<double> *>(a));
-    __FORCE_MKL_FLUSH__(status);
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::hpr(device_queue->val, convert(uplo), n,
+                                        scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(x), incx,
+                                        reinterpret_cast<std::complex<double> *>(a))
+                : her_device<false, true>(device_queue, uplo, n, alpha, x, incx, x, incx, a, 0);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklChpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+extern "C" void onemklChpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                 const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy, float _Complex *a)
 {
-    auto status = oneapi::mkl::blas::column_major::hpr2(device_queue->val, convert(uplo), n,
-                                        static_cast<std::complex<float> >(alpha),
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::hpr2(device_queue->val, convert(uplo), n,
+                                        scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<float> *>(x), incx,
                                         reinterpret_cast<const std::complex<float> *>(y), incy,
-                                        reinterpret_cast<std::complex<float> *>(a));
-    __FORCE_MKL_FLUSH__(status);
+                                        reinterpret_cast<std::complex<float> *>(a))
+                : her_device<true, true>(device_queue, uplo, n, alpha, x, incx, y, incy, a, 0);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklZhpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+extern "C" void onemklZhpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                 const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy, double _Complex *a)
 {
-    auto status = oneapi::mkl::blas::column_major::hpr2(device_queue->val, convert(uplo), n,
-                                        static_cast<std::complex<double> >(alpha),
+    auto status = device_queue->host_scalars
+                ? oneapi::mkl::blas::column_major::hpr2(device_queue->val, convert(uplo), n,
+                                        scalar(device_queue, alpha),
                                         reinterpret_cast<const std::complex<double> *>(x), incx,
                                         reinterpret_cast<const std::complex<double> *>(y), incy,
-                                        reinterpret_cast<std::complex<double> *>(a));
-    __FORCE_MKL_FLUSH__(status);
+                                        reinterpret_cast<std::complex<double> *>(a))
+                : her_device<true, true>(device_queue, uplo, n, alpha, x, incx, y, incy, a, 0);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSsbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, int64_t k,
-                            float alpha, const float *a, int64_t lda, const float *x,
-                            int64_t incx, float beta, float *y, int64_t incy) {
+                            const float *alpha, const float *a, int64_t lda, const float *x,
+                            int64_t incx, const float *beta, float *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::sbmv(device_queue->val, convert(uplo), n, k,
-                                                    alpha, a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                                    scalar(device_queue, alpha), a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDsbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, int64_t k,
-                            double alpha, const double *a, int64_t lda, const double *x,
-                            int64_t incx, double beta, double *y, int64_t incy) {
+                            const double *alpha, const double *a, int64_t lda, const double *x,
+                            int64_t incx, const double *beta, double *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::sbmv(device_queue->val, convert(uplo), n, k,
-                                                    alpha, a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                                    scalar(device_queue, alpha), a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSspmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                            float alpha, const float *a, const float *x,
-                            int64_t incx, float beta, float *y, int64_t incy) {
+                            const float *alpha, const float *a, const float *x,
+                            int64_t incx, const float *beta, float *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::spmv(device_queue->val, convert(uplo), n,
-                                                    alpha, a, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                                    scalar(device_queue, alpha), a, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDspmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                            double alpha, const double *a, const double *x,
-                            int64_t incx, double beta, double *y, int64_t incy) {
+                            const double *alpha, const double *a, const double *x,
+                            int64_t incx, const double *beta, double *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::spmv(device_queue->val, convert(uplo), n,
-                                                    alpha, a, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+                                                    scalar(device_queue, alpha), a, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSspr(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 float alpha, const float *x, int64_t incx, float *a) {
-    auto status = oneapi::mkl::blas::column_major::spr(device_queue->val, convert(uplo), n, alpha, x, incx, a);
-    __FORCE_MKL_FLUSH__(status);
+                 const float *alpha, const float *x, int64_t incx, float *a) {
+    auto status = oneapi::mkl::blas::column_major::spr(device_queue->val, convert(uplo), n, scalar(device_queue, alpha), x, incx, a);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDspr(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double alpha, const double *x, int64_t incx, double *a) {
-    auto status = oneapi::mkl::blas::column_major::spr(device_queue->val, convert(uplo), n, alpha, x, incx, a);
-    __FORCE_MKL_FLUSH__(status);
+                 const double *alpha, const double *x, int64_t incx, double *a) {
+    auto status = oneapi::mkl::blas::column_major::spr(device_queue->val, convert(uplo), n, scalar(device_queue, alpha), x, incx, a);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSspr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 float alpha, const float *x, int64_t incx,
+                 const float *alpha, const float *x, int64_t incx,
                  const float *y, int64_t incy, float *a) {
-    auto status = oneapi::mkl::blas::column_major::spr2(device_queue->val, convert(uplo), n, alpha,
+    auto status = oneapi::mkl::blas::column_major::spr2(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
                  x, incx, y, incy, a);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDspr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double alpha, const double *x, int64_t incx,
+                 const double *alpha, const double *x, int64_t incx,
                  const double *y, int64_t incy, double *a) {
-    auto status = oneapi::mkl::blas::column_major::spr2(device_queue->val, convert(uplo), n, alpha,
+    auto status = oneapi::mkl::blas::column_major::spr2(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
                  x, incx, y, incy, a);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
-                            const float *a, int64_t lda, const float *x, int64_t incx, float beta,
+extern "C" void onemklSsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
+                            const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
                             float *y, int64_t incy) {
-    auto status = oneapi::mkl::blas::column_major::symv(device_queue->val, convert(uplo), n, alpha,
-                                                    a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    auto status = oneapi::mkl::blas::column_major::symv(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
+                                                    a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklDsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
-                            const double *a, int64_t lda, const double *x, int64_t incx, double beta,
+extern "C" void onemklDsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
+                            const double *a, int64_t lda, const double *x, int64_t incx, const double *beta,
                             double *y, int64_t incy) {
-    auto status = oneapi::mkl::blas::column_major::symv(device_queue->val, convert(uplo), n, alpha,
-                                                    a, lda, x, incx, beta, y, incy);
-    __FORCE_MKL_FLUSH__(status);
+    auto status = oneapi::mkl::blas::column_major::symv(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
+                                                    a, lda, x, incx, scalar(device_queue, beta), y, incy);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklCsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+extern "C" void onemklCsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                  const float _Complex *a, int64_t lda, const float _Complex *x, int64_t incx,
-                 float _Complex beta, float _Complex *y, int64_t incy) {
+                 const float _Complex *beta, float _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::symv(device_queue->val, convert(uplo), n,
-                                                    static_cast<std::complex<float>>(alpha),
+                                                    scalar(device_queue, alpha),
                                                     reinterpret_cast<const std::complex<float> *>(a), lda,
                                                     reinterpret_cast<const std::complex<float> *>(x), incx,
-                                                    static_cast<std::complex<float>>(beta),
+                                                    scalar(device_queue, beta),
                                                     reinterpret_cast<std::complex<float>*>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double _Complex alpha, const double _Complex *a, int64_t lda, const double _Complex *x,
-                 int64_t incx, double _Complex beta, double _Complex *y, int64_t incy) {
+                 const double _Complex *alpha, const double _Complex *a, int64_t lda, const double _Complex *x,
+                 int64_t incx, const double _Complex *beta, double _Complex *y, int64_t incy) {
     auto status = oneapi::mkl::blas::column_major::symv(device_queue->val, convert(uplo), n,
-                                                    static_cast<std::complex<double>>(alpha),
+                                                    scalar(device_queue, alpha),
                                                     reinterpret_cast<const std::complex<double> *>(a), lda,
                                                     reinterpret_cast<const std::complex<double> *>(x), incx,
-                                                    static_cast<std::complex<double>>(beta),
+                                                    scalar(device_queue, beta),
                                                     reinterpret_cast<std::complex<double>*>(y), incy);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+extern "C" void onemklSsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                            const float *x, int64_t incx, float *a, int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::syr(device_queue->val, convert(uplo), n, alpha,
+    auto status = oneapi::mkl::blas::column_major::syr(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
                                                     x, incx, a, lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklDsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+extern "C" void onemklDsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                            const double *x, int64_t incx, double *a, int64_t lda) {
-    auto status = oneapi::mkl::blas::column_major::syr(device_queue->val, convert(uplo), n, alpha,
+    auto status = oneapi::mkl::blas::column_major::syr(device_queue->val, convert(uplo), n, scalar(device_queue, alpha),
                                                     x, incx, a, lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklCsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+extern "C" void onemklCsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                            const float _Complex *x, int64_t incx, float _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::syr(device_queue->val, convert(uplo), n,
-                                                    static_cast<std::complex<float>>(alpha),
+                                                    scalar(device_queue, alpha),
                                                     reinterpret_cast<const std::complex<float> *>(x), incx,
                                                     reinterpret_cast<std::complex<float> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklZsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+extern "C" void onemklZsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                            const double _Complex *x, int64_t incx, double _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::syr(device_queue->val, convert(uplo), n,
-                                                    static_cast<std::complex<double>>(alpha),
+                                                    scalar(device_queue, alpha),
                                                     reinterpret_cast<const std::complex<double> *>(x), incx,
                                                     reinterpret_cast<std::complex<double> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
-extern "C" void onemklSsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+extern "C" void onemklSsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                            const float *x, int64_t incx, const float *y, int64_t incy, float *a, int64_t lda)
 {
-    auto status = oneapi::mkl::blas::column_major::syr2(device_queue->val, convert(uplo), n, alpha, x, incx, y, incy, a, lda);
-    __FORCE_MKL_FLUSH__(status);
+    auto status = oneapi::mkl::blas::column_major::syr2(device_queue->val, convert(uplo), n, scalar(device_queue, alpha), x, incx, y, incy, a, lda);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklDsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+extern "C" void onemklDsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                            const double *x, int64_t incx, const double *y, int64_t incy, double *a, int64_t lda)
 
 {
-    auto status = oneapi::mkl::blas::column_major::syr2(device_queue->val, convert(uplo), n, alpha, x, incx, y, incy, a, lda);
-    __FORCE_MKL_FLUSH__(status);
+    auto status = oneapi::mkl::blas::column_major::syr2(device_queue->val, convert(uplo), n, scalar(device_queue, alpha), x, incx, y, incy, a, lda);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklCsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+extern "C" void onemklCsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                            const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                            float _Complex *a, int64_t lda) {
     auto status = oneapi::mkl::blas::column_major::syr2(device_queue->val, convert(uplo), n,
-                           static_cast<std::complex<float>>(alpha),
+                           scalar(device_queue, alpha),
                            reinterpret_cast<const std::complex<float> *>(x), incx,
                            reinterpret_cast<const std::complex<float> *>(y), incy,
                            reinterpret_cast<std::complex<float> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
-extern "C" void onemklZsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+extern "C" void onemklZsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                            const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                            double _Complex *a, int64_t lda){
     auto status = oneapi::mkl::blas::column_major::syr2(device_queue->val, convert(uplo), n,
-                           static_cast<std::complex<double>>(alpha),
+                           scalar(device_queue, alpha),
                            reinterpret_cast<const std::complex<double> *>(x), incx,
                            reinterpret_cast<const std::complex<double> *>(y), incy,
                            reinterpret_cast<std::complex<double> *>(a), lda);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklStbmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -956,7 +2072,7 @@ extern "C" void onemklStbmv(syclQueue_t device_queue, onemklUplo uplo,
                             int64_t k, const float *a, int64_t lda, float *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tbmv(device_queue->val, convert(uplo), convert(trans),
                                                         convert(diag), n, k, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDtbmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -964,7 +2080,7 @@ extern "C" void onemklDtbmv(syclQueue_t device_queue, onemklUplo uplo,
                             int64_t k, const double *a, int64_t lda, double *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tbmv(device_queue->val, convert(uplo), convert(trans),
                                                     convert(diag), n, k, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCtbmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -974,7 +2090,7 @@ extern "C" void onemklCtbmv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tbmv(device_queue->val, convert(uplo), convert(trans),
                                             convert(diag), n, k, reinterpret_cast<const std::complex<float> *>(a),
                                             lda, reinterpret_cast<std::complex<float> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZtbmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -984,7 +2100,7 @@ extern "C" void onemklZtbmv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tbmv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, k, reinterpret_cast<const std::complex<double> *>(a),
                                         lda, reinterpret_cast<std::complex<double> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklStbsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -992,7 +2108,7 @@ extern "C" void onemklStbsv(syclQueue_t device_queue, onemklUplo uplo,
                             int64_t k, const float *a, int64_t lda, float *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tbsv(device_queue->val, convert(uplo), convert(trans),
                                                         convert(diag), n, k, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDtbsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1000,7 +2116,7 @@ extern "C" void onemklDtbsv(syclQueue_t device_queue, onemklUplo uplo,
                             int64_t k, const double *a, int64_t lda, double *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tbsv(device_queue->val, convert(uplo), convert(trans),
                                                     convert(diag), n, k, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCtbsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1010,7 +2126,7 @@ extern "C" void onemklCtbsv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tbsv(device_queue->val, convert(uplo), convert(trans),
                                             convert(diag), n, k, reinterpret_cast<const std::complex<float> *>(a),
                                             lda, reinterpret_cast<std::complex<float> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZtbsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1020,7 +2136,7 @@ extern "C" void onemklZtbsv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tbsv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, k, reinterpret_cast<const std::complex<double> *>(a),
                                         lda, reinterpret_cast<std::complex<double> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklStpmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1028,7 +2144,7 @@ extern "C" void onemklStpmv(syclQueue_t device_queue, onemklUplo uplo,
                 const float *a, float *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tpmv(device_queue->val, convert(uplo), convert(trans),
                                                     convert(diag), n, a, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDtpmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1036,7 +2152,7 @@ extern "C" void onemklDtpmv(syclQueue_t device_queue, onemklUplo uplo,
                 const double *a, double *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tpmv(device_queue->val, convert(uplo), convert(trans),
                                                     convert(diag), n, a, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCtpmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1045,7 +2161,7 @@ extern "C" void onemklCtpmv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tpmv(device_queue->val, convert(uplo), convert(trans),
                                             convert(diag), n, reinterpret_cast<const std::complex<float> *>(a),
                                             reinterpret_cast<std::complex<float> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZtpmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1054,7 +2170,7 @@ extern "C" void onemklZtpmv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tpmv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, reinterpret_cast<const std::complex<double> *>(a),
                                         reinterpret_cast<std::complex<double> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklStpsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1062,7 +2178,7 @@ extern "C" void onemklStpsv(syclQueue_t device_queue, onemklUplo uplo,
                 const float *a, float *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tpsv(device_queue->val, convert(uplo), convert(trans),
                                                     convert(diag), m, a, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDtpsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1070,7 +2186,7 @@ extern "C" void onemklDtpsv(syclQueue_t device_queue, onemklUplo uplo,
                 const double *a, double *x, int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::tpsv(device_queue->val, convert(uplo), convert(trans),
                                                     convert(diag), m, a, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCtpsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1079,7 +2195,7 @@ extern "C" void onemklCtpsv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tpsv(device_queue->val, convert(uplo), convert(trans),
                                             convert(diag), m, reinterpret_cast<const std::complex<float> *>(a),
                                             reinterpret_cast<std::complex<float> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZtpsv(syclQueue_t device_queue, onemklUplo uplo,
@@ -1088,7 +2204,7 @@ extern "C" void onemklZtpsv(syclQueue_t device_queue, onemklUplo uplo,
     auto status = oneapi::mkl::blas::column_major::tpsv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), m, reinterpret_cast<const std::complex<double> *>(a),
                                         reinterpret_cast<std::complex<double> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 // trmv - level2
@@ -1097,7 +2213,7 @@ extern "C" void onemklStrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
                             int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::trmv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDtrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
@@ -1105,7 +2221,7 @@ extern "C" void onemklDtrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
                             int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::trmv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCtrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
@@ -1114,7 +2230,7 @@ extern "C" void onemklCtrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
     auto status = oneapi::mkl::blas::column_major::trmv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, reinterpret_cast<const std::complex<float> *>(a),
                                         lda, reinterpret_cast<std::complex<float> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZtrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
@@ -1123,7 +2239,7 @@ extern "C" void onemklZtrmv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
     auto status = oneapi::mkl::blas::column_major::trmv(device_queue->val, convert(uplo), convert(trans),
                                         convert(diag), n, reinterpret_cast<const std::complex<double> *>(a),
                                         lda, reinterpret_cast<std::complex<double> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 // trsv
@@ -1132,7 +2248,7 @@ extern "C" void onemklStrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
                             int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::trsv(device_queue->val, convert(uplo), convert(trans),
                                           convert(diag), n, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklDtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
@@ -1140,7 +2256,7 @@ extern "C" void onemklDtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
                             int64_t incx) {
     auto status = oneapi::mkl::blas::column_major::trsv(device_queue->val, convert(uplo), convert(trans),
                                           convert(diag), n, a, lda, x, incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
@@ -1149,7 +2265,7 @@ extern "C" void onemklCtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
     auto status = oneapi::mkl::blas::column_major::trsv(device_queue->val, convert(uplo), convert(trans),
                                           convert(diag), n, reinterpret_cast<const std::complex<float> *>(a),
                                           lda, reinterpret_cast<std::complex<float> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
@@ -1158,392 +2274,3497 @@ extern "C" void onemklZtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTra
     auto status = oneapi::mkl::blas::column_major::trsv(device_queue->val, convert(uplo), convert(trans),
                                           convert(diag), n, reinterpret_cast<const std::complex<double> *>(a),
                                           lda, reinterpret_cast<std::complex<double> *>(x), incx);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// Tile split: with a minimum in syclQueue_st::tile_split_min, gemm, syrk and
+// trsm calls with at least that many independent columns (rows for a
+// right-side trsm) are cut into one block per sub-device (tile) of the device.
+// The blocks run on per-tile queues after a barrier on the handle's queue, and
+// a second barrier on the handle's queue joins them back, so work queued on
+// the stream afterwards waits for every tile.
+static std::vector<sycl::queue> &tile_queues(syclQueue_t device_queue) {
+    std::call_once(device_queue->tiles_once, [&] {
+        auto &q = device_queue->val;
+        try {
+            auto tiles = q.get_device().create_sub_devices<
+                        sycl::info::partition_property::partition_by_affinity_domain>(
+                        sycl::info::partition_affinity_domain::next_partitionable);
+            for (auto &tile : tiles) {
+                device_queue->tiles.emplace_back(q.get_context(), tile, sycl::property::queue::in_order());
+            }
+        } catch (const sycl::exception &) {
+            // a single tile device
+            device_queue->tiles.clear();
+        }
+    });
+    return device_queue->tiles;
+}
+
+// Calls submit(tile_queue, first, count, dependencies) for one block of
+// 'extent' per tile. Returns false, submitting nothing, when the call is not
+// to be split.
+template <typename F>
+bool split_across_tiles(syclQueue_t device_queue, int64_t extent, F submit) {
+    int64_t min_columns = device_queue->tile_split_min;
+    if (min_columns == 0 || extent < min_columns) {
+        return false;
+    }
+    auto &q = device_queue->val;
+    if (q.ext_oneapi_get_state() == sycl::ext::oneapi::experimental::queue_state::recording) {
+        // a capture only records the handle's queue
+        return false;
+    }
+    auto &tiles = tile_queues(device_queue);
+    int64_t ntiles = tiles.size();
+    if (ntiles < 2) {
+        return false;
+    }
+
+    std::vector<sycl::event> ready = {q.ext_oneapi_submit_barrier()};
+    std::vector<sycl::event> done;
+    int64_t block = (extent + ntiles - 1) / ntiles;
+    for (int64_t t = 0; t < ntiles && t * block < extent; t++) {
+        int64_t first = t * block;
+        sycl::event status = submit(tiles[t], first, std::min(block, extent - first), ready);
+        // nothing else flushes the tile queues
+        flush_event(device_queue, status);
+        done.push_back(status);
+    }
+    auto status = q.ext_oneapi_submit_barrier(done);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+    return true;
+}
+
+template <typename T>
+bool split_gemm(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB, int64_t m,
+                int64_t n, int64_t k, const T *alpha, const T *A, int64_t lda, const T *B, int64_t ldb,
+                const T *beta, T *C, int64_t ldc) {
+    return split_across_tiles(device_queue, n, [&](sycl::queue &tile, int64_t j, int64_t nb,
+                const std::vector<sycl::event> &deps) {
+        // columns j.. of C are columns j.. of op(B)
+        const T *Bj = transB == ONEMKL_TRANSPOSE_NONTRANS ? B + j * ldb : B + j;
+        return oneapi::mkl::blas::column_major::gemm(tile, convert(transA), convert(transB), m, nb, k,
+                    scalar(device_queue, alpha), A, lda, Bj, ldb, scalar(device_queue, beta), C + j * ldc, ldc, deps);
+    });
+}
+
+template <typename T>
+bool split_syrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                const T *alpha, const T *a, int64_t lda, const T *beta, T *c, int64_t ldc) {
+    bool nontrans = trans == ONEMKL_TRANSPOSE_NONTRANS;
+    // rows i.. of op(A), and the transposes that make a gemm compute op(A) op(A)^T
+    auto rows = [&](int64_t i) { return nontrans ? a + i : a + i * lda; };
+    auto ta = nontrans ? oneapi::mkl::transpose::nontrans : oneapi::mkl::transpose::trans;
+    auto tb = nontrans ? oneapi::mkl::transpose::trans : oneapi::mkl::transpose::nontrans;
+    return split_across_tiles(device_queue, n, [&](sycl::queue &tile, int64_t j, int64_t nb,
+                const std::vector<sycl::event> &deps) {
+        // the diagonal block, then the rest of the column block within the stored triangle
+        auto status = oneapi::mkl::blas::column_major::syrk(tile, convert(uplo), convert(trans), nb, k,
+                    scalar(device_queue, alpha), rows(j), lda, scalar(device_queue, beta), c + j + j * ldc, ldc, deps);
+        if (uplo == ONEMKL_UPLO_LOWER && j + nb < n) {
+            status = oneapi::mkl::blas::column_major::gemm(tile, ta, tb, n - j - nb, nb, k, scalar(device_queue, alpha),
+                        rows(j + nb), lda, rows(j), lda, scalar(device_queue, beta), c + j + nb + j * ldc, ldc);
+        } else if (uplo == ONEMKL_UPLO_UPPER && j > 0) {
+            status = oneapi::mkl::blas::column_major::gemm(tile, ta, tb, j, nb, k, scalar(device_queue, alpha), rows(0),
+                        lda, rows(j), lda, scalar(device_queue, beta), c + j * ldc, ldc);
+        }
+        return status;
+    });
+}
+
+template <typename T>
+bool split_trsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const T *alpha, const T *a, int64_t lda, T *b,
+                int64_t ldb) {
+    if (side == ONEMKL_SIDE_LEFT) {
+        // op(A) X = alpha B, the columns of B are independent
+        return split_across_tiles(device_queue, n, [&](sycl::queue &tile, int64_t j, int64_t nb,
+                    const std::vector<sycl::event> &deps) {
+            return oneapi::mkl::blas::column_major::trsm(tile, convert(side), convert(uplo), convert(trans),
+                        convert(diag), m, nb, scalar(device_queue, alpha), a, lda, b + j * ldb, ldb, deps);
+        });
+    }
+    // X op(A) = alpha B, the rows of B are independent
+    return split_across_tiles(device_queue, m, [&](sycl::queue &tile, int64_t i, int64_t mb,
+                const std::vector<sycl::event> &deps) {
+        return oneapi::mkl::blas::column_major::trsm(tile, convert(side), convert(uplo), convert(trans),
+                    convert(diag), mb, n, scalar(device_queue, alpha), a, lda, b + i, ldb, deps);
+    });
 }
 
 extern "C" int onemklHgemm(syclQueue_t device_queue, onemklTranspose transA,
                            onemklTranspose transB, int64_t m, int64_t n,
-                           int64_t k, uint16_t alpha, const short *A, int64_t lda,
-                           const short *B, int64_t ldb, uint16_t beta, short *C,
+                           int64_t k, const uint16_t *alpha, const short *A, int64_t lda,
+                           const short *B, int64_t ldb, const uint16_t *beta, short *C,
                            int64_t ldc) {
+    if (split_gemm(device_queue, transA, transB, m, n, k, reinterpret_cast<const sycl::half *>(alpha),
+                reinterpret_cast<const sycl::half *>(A), lda, reinterpret_cast<const sycl::half *>(B), ldb,
+                reinterpret_cast<const sycl::half *>(beta), reinterpret_cast<sycl::half *>(C), ldc)) {
+        return 0;
+    }
     auto status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k,sycl::bit_cast<sycl::half>(alpha),
+                                          convert(transB), m, n, k,scalar(device_queue, alpha),
                                           reinterpret_cast<const sycl::half *>(A), lda,
                                           reinterpret_cast<const sycl::half *>(B), ldb,
-                                          sycl::bit_cast<sycl::half>(beta),
+                                          scalar(device_queue, beta),
                                           reinterpret_cast<sycl::half *>(C), ldc);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 
 extern "C" int onemklSgemm(syclQueue_t device_queue, onemklTranspose transA,
                            onemklTranspose transB, int64_t m, int64_t n,
-                           int64_t k, float alpha, const float *A, int64_t lda,
-                           const float *B, int64_t ldb, float beta, float *C,
+                           int64_t k, const float *alpha, const float *A, int64_t lda,
+                           const float *B, int64_t ldb, const float *beta, float *C,
                            int64_t ldc) {
+    if (split_gemm(device_queue, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc)) {
+        return 0;
+    }
     auto status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, A,
-                                          lda, B, ldb, beta, C, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), A,
+                                          lda, B, ldb, scalar(device_queue, beta), C, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 
 extern "C" int onemklDgemm(syclQueue_t device_queue, onemklTranspose transA,
                            onemklTranspose transB, int64_t m, int64_t n,
-                           int64_t k, double alpha, const double *A,
+                           int64_t k, const double *alpha, const double *A,
                            int64_t lda, const double *B, int64_t ldb,
-                           double beta, double *C, int64_t ldc) {
+                           const double *beta, double *C, int64_t ldc) {
+    if (split_gemm(device_queue, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc)) {
+        return 0;
+    }
     auto status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, A,
-                                          lda, B, ldb, beta, C, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), A,
+                                          lda, B, ldb, scalar(device_queue, beta), C, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 
 extern "C" int onemklCgemm(syclQueue_t device_queue, onemklTranspose transA,
                            onemklTranspose transB, int64_t m, int64_t n,
-                           int64_t k, float _Complex alpha,
+                           int64_t k, const float _Complex *alpha,
                            const float _Complex *A, int64_t lda,
                            const float _Complex *B, int64_t ldb,
-                           float _Complex beta, float _Complex *C,
+                           const float _Complex *beta, float _Complex *C,
                            int64_t ldc) {
+    if (split_gemm(device_queue, transA, transB, m, n, k,
+                reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> *>(A), lda,
+                reinterpret_cast<const std::complex<float> *>(B), ldb,
+                reinterpret_cast<const std::complex<float> *>(beta),
+                reinterpret_cast<std::complex<float> *>(C), ldc)) {
+        return 0;
+    }
     auto status = oneapi::mkl::blas::column_major::gemm(
-        device_queue->val, convert(transA), convert(transB), m, n, k, alpha,
+        device_queue->val, convert(transA), convert(transB), m, n, k, scalar(device_queue, alpha),
         reinterpret_cast<const std::complex<float> *>(A), lda,
-        reinterpret_cast<const std::complex<float> *>(B), ldb, beta,
+        reinterpret_cast<const std::complex<float> *>(B), ldb, scalar(device_queue, beta),
         reinterpret_cast<std::complex<float> *>(C), ldc);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 
 extern "C" int onemklZgemm(syclQueue_t device_queue, onemklTranspose transA,
                            onemklTranspose transB, int64_t m, int64_t n,
-                           int64_t k, double _Complex alpha,
+                           int64_t k, const double _Complex *alpha,
                            const double _Complex *A, int64_t lda,
                            const double _Complex *B, int64_t ldb,
-                           double _Complex beta, double _Complex *C,
+                           const double _Complex *beta, double _Complex *C,
                            int64_t ldc) {
+    if (split_gemm(device_queue, transA, transB, m, n, k,
+                reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> *>(A), lda,
+                reinterpret_cast<const std::complex<double> *>(B), ldb,
+                reinterpret_cast<const std::complex<double> *>(beta),
+                reinterpret_cast<std::complex<double> *>(C), ldc)) {
+        return 0;
+    }
     auto status = oneapi::mkl::blas::column_major::gemm(
-        device_queue->val, convert(transA), convert(transB), m, n, k, alpha,
+        device_queue->val, convert(transA), convert(transB), m, n, k, scalar(device_queue, alpha),
         reinterpret_cast<const std::complex<double> *>(A), lda,
-        reinterpret_cast<const std::complex<double> *>(B), ldb, beta,
+        reinterpret_cast<const std::complex<double> *>(B), ldb, scalar(device_queue, beta),
         reinterpret_cast<std::complex<double> *>(C), ldc);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 
 extern "C" int onemklSgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float alpha, const float *A, int64_t lda, int64_t stridea,
-                const float *B, int64_t ldb, int64_t strideb, float beta,
+                const float *alpha, const float *A, int64_t lda, int64_t stridea,
+                const float *B, int64_t ldb, int64_t strideb, const float *beta,
                 float *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::gemm_batch(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, A,
-                                          lda, stridea, B, ldb, strideb, beta, C, ldc, stridec, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), A,
+                                          lda, stridea, B, ldb, strideb, scalar(device_queue, beta), C, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 extern "C" int onemklDgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                double alpha, const double *A, int64_t lda, int64_t stridea,
-                const double *B, int64_t ldb, int64_t strideb, double beta,
+                const double *alpha, const double *A, int64_t lda, int64_t stridea,
+                const double *B, int64_t ldb, int64_t strideb, const double *beta,
                 double *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::gemm_batch(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, A,
-                                          lda, stridea, B, ldb, strideb, beta, C, ldc, stridec, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), A,
+                                          lda, stridea, B, ldb, strideb, scalar(device_queue, beta), C, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 extern "C" int onemklCgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex *A, int64_t lda, int64_t stridea,
-                const float _Complex *B, int64_t ldb, int64_t strideb, float _Complex beta,
+                const float _Complex *alpha, const float _Complex *A, int64_t lda, int64_t stridea,
+                const float _Complex *B, int64_t ldb, int64_t strideb, const float _Complex *beta,
                 float _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::gemm_batch(
-        device_queue->val, convert(transA), convert(transB), m, n, k, alpha,
+        device_queue->val, convert(transA), convert(transB), m, n, k, scalar(device_queue, alpha),
         reinterpret_cast<const std::complex<float> *>(A), lda, stridea,
-        reinterpret_cast<const std::complex<float> *>(B), ldb, strideb, beta,
+        reinterpret_cast<const std::complex<float> *>(B), ldb, strideb, scalar(device_queue, beta),
         reinterpret_cast<std::complex<float> *>(C), ldc, stridec, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 extern "C" int onemklZgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex *A, int64_t lda, int64_t stridea,
-                const double _Complex *B, int64_t ldb, int64_t strideb, double _Complex beta,
+                const double _Complex *alpha, const double _Complex *A, int64_t lda, int64_t stridea,
+                const double _Complex *B, int64_t ldb, int64_t strideb, const double _Complex *beta,
                 double _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::gemm_batch(
-        device_queue->val, convert(transA), convert(transB), m, n, k, alpha,
+        device_queue->val, convert(transA), convert(transB), m, n, k, scalar(device_queue, alpha),
         reinterpret_cast<const std::complex<double> *>(A), lda, stridea,
-        reinterpret_cast<const std::complex<double> *>(B), ldb, strideb, beta,
+        reinterpret_cast<const std::complex<double> *>(B), ldb, strideb, scalar(device_queue, beta),
         reinterpret_cast<std::complex<double> *>(C), ldc, stridec, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+    return 0;
+}
+// gemm_batch (group API)
+// A single group of batch_size problems, so the whole pointer-array batch is
+// one launch. The group API only takes host alpha and beta, so with device
+// scalars (HIPBLAS_POINTER_MODE_DEVICE) oneMKL computes the plain products
+// op(A) * op(B) into 'workspace' and onemkl_kernels::geam applies alpha and
+// beta on the device: a read back would block, and cannot be recorded into a
+// graph. See onemklGemmBatchWorkspaceSize for the layout. Without a workspace
+// onemkl_kernels::gemm runs the whole call instead.
+extern "C" size_t onemklGemmBatchWorkspaceSize(int64_t m, int64_t n, int64_t batch_size, size_t element_size) {
+    // the pointer array to the products first, then the products, m x n each
+    return batch_size * (sizeof(void *) + m * n * element_size);
+}
+
+template <typename T>
+sycl::event gemm_batch_group(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, int64_t k, const T *alpha, const T **A, int64_t lda,
+                const T **B, int64_t ldb, const T *beta, T **C, int64_t ldc, int64_t batch_size,
+                void *workspace) {
+    auto &q = device_queue->val;
+    auto ta = convert(transA);
+    auto tb = convert(transB);
+    if (!device_queue->host_scalars) {
+        if (workspace == nullptr) {
+            return onemkl_kernels::gemm<accumulate_type<T>>(q, kernel_op(transA), kernel_op(transB), m, n, k,
+                        scalar_arg(device_queue, alpha), batch_view(A), lda, batch_view(B), ldb,
+                        scalar_arg(device_queue, beta), batch_view(C), ldc, batch_size);
+        }
+        T **products = static_cast<T **>(workspace);
+        T *product = reinterpret_cast<T *>(products + batch_size);
+        int64_t mn = m * n;
+        onemkl_kernels::for_each_element(q, 1, batch_size, [=](int64_t b, int64_t) {
+            products[b] = product + b * mn;
+        });
+        T one = T(1);
+        T zero = T(0);
+        oneapi::mkl::blas::column_major::gemm_batch(q, &ta, &tb, &m, &n, &k, &one, A, &lda, B, &ldb, &zero,
+                    products, &m, 1, &batch_size);
+        return onemkl_kernels::geam(q, onemkl_kernels::op::none, onemkl_kernels::op::none, m, n,
+                    scalar_arg(device_queue, alpha), batch_view(product, mn), m, scalar_arg(device_queue, beta),
+                    batch_view(C), ldc, batch_view(C), ldc, batch_size);
+    }
+    T h_alpha = *alpha;
+    T h_beta = *beta;
+    return oneapi::mkl::blas::column_major::gemm_batch(q, &ta, &tb, &m, &n, &k, &h_alpha, A, &lda,
+                                          B, &ldb, &h_beta, C, &ldc, 1, &batch_size);
+}
+
+extern "C" int onemklHgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const uint16_t *alpha, const short **A, int64_t lda,
+                const short **B, int64_t ldb, const uint16_t *beta,
+                short **C, int64_t ldc, int64_t batch_size,
+                void *workspace) {
+    auto status = gemm_batch_group(device_queue, transA, transB, m, n, k,
+                reinterpret_cast<const sycl::half *>(alpha), reinterpret_cast<const sycl::half **>(A), lda,
+                reinterpret_cast<const sycl::half **>(B), ldb, reinterpret_cast<const sycl::half *>(beta),
+                reinterpret_cast<sycl::half **>(C), ldc, batch_size, workspace);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
+
+extern "C" int onemklSgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const float *alpha, const float **A, int64_t lda,
+                const float **B, int64_t ldb, const float *beta,
+                float **C, int64_t ldc, int64_t batch_size,
+                void *workspace) {
+    auto status = gemm_batch_group(device_queue, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc, batch_size, workspace);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+    return 0;
+}
+
+extern "C" int onemklDgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const double *alpha, const double **A, int64_t lda,
+                const double **B, int64_t ldb, const double *beta,
+                double **C, int64_t ldc, int64_t batch_size,
+                void *workspace) {
+    auto status = gemm_batch_group(device_queue, transA, transB, m, n, k,
+                alpha, A, lda, B, ldb, beta, C, ldc, batch_size, workspace);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+    return 0;
+}
+
+extern "C" int onemklCgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const float _Complex *alpha, const float _Complex **A, int64_t lda,
+                const float _Complex **B, int64_t ldb, const float _Complex *beta,
+                float _Complex **C, int64_t ldc, int64_t batch_size,
+                void *workspace) {
+    auto status = gemm_batch_group(device_queue, transA, transB, m, n, k,
+                reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> **>(A), lda,
+                reinterpret_cast<const std::complex<float> **>(B), ldb,
+                reinterpret_cast<const std::complex<float> *>(beta),
+                reinterpret_cast<std::complex<float> **>(C), ldc, batch_size, workspace);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+    return 0;
+}
+
+extern "C" int onemklZgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const double _Complex *alpha, const double _Complex **A, int64_t lda,
+                const double _Complex **B, int64_t ldb, const double _Complex *beta,
+                double _Complex **C, int64_t ldc, int64_t batch_size,
+                void *workspace) {
+    auto status = gemm_batch_group(device_queue, transA, transB, m, n, k,
+                reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> **>(A), lda,
+                reinterpret_cast<const std::complex<double> **>(B), ldb,
+                reinterpret_cast<const std::complex<double> *>(beta),
+                reinterpret_cast<std::complex<double> **>(C), ldc, batch_size, workspace);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+    return 0;
+}
+
+// gemv_batch: the strided flavour maps onto oneMKL directly, the pointer-array
+// flavour goes through the group API like gemm_batch above, or with device
+// scalars through onemkl_kernels::gemv.
+template <typename T>
+sycl::event gemv_batch_group(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const T *alpha, const T **a, int64_t lda, const T **x, int64_t incx,
+                const T *beta, T **y, int64_t incy, int64_t batch_size) {
+    auto &q = device_queue->val;
+    if (!device_queue->host_scalars) {
+        return onemkl_kernels::gemv(q, kernel_op(trans), m, n, scalar_arg(device_queue, alpha), batch_view(a),
+                    lda, batch_view(x), incx, scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    }
+    auto t = convert(trans);
+    T h_alpha = *alpha;
+    T h_beta = *beta;
+    return oneapi::mkl::blas::column_major::gemv_batch(q, &t, &m, &n, &h_alpha, a, &lda, x, &incx,
+                                          &h_beta, y, &incy, 1, &batch_size);
+}
+
+extern "C" void onemklSgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float *alpha, const float **a, int64_t lda, const float **x, int64_t incx,
+                const float *beta, float **y, int64_t incy, int64_t batch_size) {
+    auto status = gemv_batch_group(device_queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double *alpha, const double **a, int64_t lda, const double **x, int64_t incx,
+                const double *beta, double **y, int64_t incy, int64_t batch_size) {
+    auto status = gemv_batch_group(device_queue, trans, m, n, alpha, a, lda, x, incx, beta, y, incy,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **x,
+                int64_t incx, const float _Complex *beta, float _Complex **y, int64_t incy,
+                int64_t batch_size) {
+    auto status = gemv_batch_group(device_queue, trans, m, n,
+                reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> **>(a), lda,
+                reinterpret_cast<const std::complex<float> **>(x), incx,
+                reinterpret_cast<const std::complex<float> *>(beta),
+                reinterpret_cast<std::complex<float> **>(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                const double _Complex **x, int64_t incx, const double _Complex *beta, double _Complex **y,
+                int64_t incy, int64_t batch_size) {
+    auto status = gemv_batch_group(device_queue, trans, m, n,
+                reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> **>(a), lda,
+                reinterpret_cast<const std::complex<double> **>(x), incx,
+                reinterpret_cast<const std::complex<double> *>(beta),
+                reinterpret_cast<std::complex<double> **>(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *x,
+                int64_t incx, int64_t stridex, const float *beta, float *y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::gemv_batch(device_queue->val, convert(trans), m, n,
+                scalar(device_queue, alpha), a, lda, stridea, x, incx, stridex,
+                scalar(device_queue, beta), y, incy, stridey, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *x,
+                int64_t incx, int64_t stridex, const double *beta, double *y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::gemv_batch(device_queue->val, convert(trans), m, n,
+                scalar(device_queue, alpha), a, lda, stridea, x, incx, stridex,
+                scalar(device_queue, beta), y, incy, stridey, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea,
+                const float _Complex *x, int64_t incx, int64_t stridex, const float _Complex *beta,
+                float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::gemv_batch(device_queue->val, convert(trans), m, n,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                stridea, reinterpret_cast<const std::complex<float> *>(x), incx, stridex,
+                scalar(device_queue, beta), reinterpret_cast<std::complex<float> *>(y), incy, stridey,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea,
+                const double _Complex *x, int64_t incx, int64_t stridex, const double _Complex *beta,
+                double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::gemv_batch(device_queue->val, convert(trans), m, n,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                stridea, reinterpret_cast<const std::complex<double> *>(x), incx, stridex,
+                scalar(device_queue, beta), reinterpret_cast<std::complex<double> *>(y), incy, stridey,
+                batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// ger, symv and hemv have no oneMKL batched entry point (onemkl_kernels.hpp)
+extern "C" void onemklSger_batch(syclQueue_t device_queue, int64_t m, int64_t n, const float *alpha,
+                const float **x, int64_t incx, const float **y, int64_t incy, float **a, int64_t lda,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::ger<float, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x), incx, batch_view(y), incy,
+                batch_view(a), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDger_batch(syclQueue_t device_queue, int64_t m, int64_t n, const double *alpha,
+                const double **x, int64_t incx, const double **y, int64_t incy, double **a, int64_t lda,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::ger<double, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x), incx, batch_view(y), incy,
+                batch_view(a), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgeru_batch(syclQueue_t device_queue, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex **x, int64_t incx,
+                const float _Complex **y, int64_t incy, float _Complex **a, int64_t lda, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<float>, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x), incx, batch_view(y), incy,
+                batch_view(a), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgerc_batch(syclQueue_t device_queue, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex **x, int64_t incx,
+                const float _Complex **y, int64_t incy, float _Complex **a, int64_t lda, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<float>, true>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x), incx, batch_view(y), incy,
+                batch_view(a), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgeru_batch(syclQueue_t device_queue, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex **x, int64_t incx,
+                const double _Complex **y, int64_t incy, double _Complex **a, int64_t lda, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<double>, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x), incx, batch_view(y), incy,
+                batch_view(a), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgerc_batch(syclQueue_t device_queue, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex **x, int64_t incx,
+                const double _Complex **y, int64_t incy, double _Complex **a, int64_t lda, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<double>, true>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x), incx, batch_view(y), incy,
+                batch_view(a), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSger_strided(syclQueue_t device_queue, int64_t m, int64_t n, const float *alpha,
+                const float *x, int64_t incx, int64_t stridex, const float *y, int64_t incy, int64_t stridey,
+                float *a, int64_t lda, int64_t stridea, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<float, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x, stridex), incx, batch_view(y, stridey),
+                incy, batch_view(a, stridea), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDger_strided(syclQueue_t device_queue, int64_t m, int64_t n, const double *alpha,
+                const double *x, int64_t incx, int64_t stridex, const double *y, int64_t incy,
+                int64_t stridey, double *a, int64_t lda, int64_t stridea, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<double, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x, stridex), incx, batch_view(y, stridey),
+                incy, batch_view(a, stridea), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgeru_strided(syclQueue_t device_queue, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex *x, int64_t incx, int64_t stridex,
+                const float _Complex *y, int64_t incy, int64_t stridey, float _Complex *a, int64_t lda,
+                int64_t stridea, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<float>, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x, stridex), incx, batch_view(y, stridey),
+                incy, batch_view(a, stridea), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgerc_strided(syclQueue_t device_queue, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex *x, int64_t incx, int64_t stridex,
+                const float _Complex *y, int64_t incy, int64_t stridey, float _Complex *a, int64_t lda,
+                int64_t stridea, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<float>, true>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x, stridex), incx, batch_view(y, stridey),
+                incy, batch_view(a, stridea), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgeru_strided(syclQueue_t device_queue, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex *x, int64_t incx, int64_t stridex,
+                const double _Complex *y, int64_t incy, int64_t stridey, double _Complex *a, int64_t lda,
+                int64_t stridea, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<double>, false>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x, stridex), incx, batch_view(y, stridey),
+                incy, batch_view(a, stridea), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgerc_strided(syclQueue_t device_queue, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex *x, int64_t incx, int64_t stridex,
+                const double _Complex *y, int64_t incy, int64_t stridey, double _Complex *a, int64_t lda,
+                int64_t stridea, int64_t batch_size) {
+    auto status = onemkl_kernels::ger<std::complex<double>, true>(device_queue->val, m, n,
+                scalar_arg(device_queue, alpha), batch_view(x, stridex), incx, batch_view(y, stridey),
+                incy, batch_view(a, stridea), lda, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
+                const float **a, int64_t lda, const float **x, int64_t incx, const float *beta, float **y,
+                int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<float, false>(device_queue->val, uplo == ONEMKL_UPLO_UPPER, n,
+                scalar_arg(device_queue, alpha), batch_view(a), lda, batch_view(x), incx,
+                scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
+                const double **a, int64_t lda, const double **x, int64_t incx, const double *beta,
+                double **y, int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<double, false>(device_queue->val, uplo == ONEMKL_UPLO_UPPER, n,
+                scalar_arg(device_queue, alpha), batch_view(a), lda, batch_view(x), incx,
+                scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **x,
+                int64_t incx, const float _Complex *beta, float _Complex **y, int64_t incy,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<float>, false>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a), lda,
+                batch_view(x), incx, scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                const double _Complex **x, int64_t incx, const double _Complex *beta, double _Complex **y,
+                int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<double>, false>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a), lda,
+                batch_view(x), incx, scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklChemv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **x,
+                int64_t incx, const float _Complex *beta, float _Complex **y, int64_t incy,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<float>, true>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a), lda,
+                batch_view(x), incx, scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZhemv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                const double _Complex **x, int64_t incx, const double _Complex *beta, double _Complex **y,
+                int64_t incy, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<double>, true>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a), lda,
+                batch_view(x), incx, scalar_arg(device_queue, beta), batch_view(y), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
+                const float *a, int64_t lda, int64_t stridea, const float *x, int64_t incx, int64_t stridex,
+                const float *beta, float *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<float, false>(device_queue->val, uplo == ONEMKL_UPLO_UPPER, n,
+                scalar_arg(device_queue, alpha), batch_view(a, stridea), lda, batch_view(x, stridex),
+                incx, scalar_arg(device_queue, beta), batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *x,
+                int64_t incx, int64_t stridex, const double *beta, double *y, int64_t incy, int64_t stridey,
+                int64_t batch_size) {
+    auto status = onemkl_kernels::symv<double, false>(device_queue->val, uplo == ONEMKL_UPLO_UPPER, n,
+                scalar_arg(device_queue, alpha), batch_view(a, stridea), lda, batch_view(x, stridex),
+                incx, scalar_arg(device_queue, beta), batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea,
+                const float _Complex *x, int64_t incx, int64_t stridex, const float _Complex *beta,
+                float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<float>, false>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a, stridea),
+                lda, batch_view(x, stridex), incx, scalar_arg(device_queue, beta),
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea,
+                const double _Complex *x, int64_t incx, int64_t stridex, const double _Complex *beta,
+                double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<double>, false>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a, stridea),
+                lda, batch_view(x, stridex), incx, scalar_arg(device_queue, beta),
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklChemv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea,
+                const float _Complex *x, int64_t incx, int64_t stridex, const float _Complex *beta,
+                float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<float>, true>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a, stridea),
+                lda, batch_view(x, stridex), incx, scalar_arg(device_queue, beta),
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZhemv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
+                const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea,
+                const double _Complex *x, int64_t incx, int64_t stridex, const double _Complex *beta,
+                double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size) {
+    auto status = onemkl_kernels::symv<std::complex<double>, true>(device_queue->val,
+                uplo == ONEMKL_UPLO_UPPER, n, scalar_arg(device_queue, alpha), batch_view(a, stridea),
+                lda, batch_view(x, stridex), incx, scalar_arg(device_queue, beta),
+                batch_view(y, stridey), incy, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
 extern "C" int onemklSgemmEx(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float alpha, const void *A, onemklDatatype_t Atype, int64_t lda, const void *B,
-                onemklDatatype_t Btype, int64_t ldb, float beta, void *C, onemklDatatype_t Ctype, int64_t ldc) {
+                const float *alpha, const void *A, onemklDatatype_t Atype, int64_t lda, const void *B,
+                onemklDatatype_t Btype, int64_t ldb, const float *beta, void *C, onemklDatatype_t Ctype, int64_t ldc) {
     sycl::event status;
     if  (Atype == ONEMKL_R_16F && Btype == ONEMKL_R_16F && Ctype == ONEMKL_R_16F){
     status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, reinterpret_cast<const sycl::half *>(A),
-                                          lda, reinterpret_cast<const sycl::half *>(B), ldb, beta,
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), reinterpret_cast<const sycl::half *>(A),
+                                          lda, reinterpret_cast<const sycl::half *>(B), ldb, scalar(device_queue, beta),
                                           reinterpret_cast<sycl::half *>(C), ldc);
     } else if (Atype == ONEMKL_R_16F && Btype == ONEMKL_R_16F && Ctype == ONEMKL_R_32F) {
     status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, reinterpret_cast<const sycl::half *>(A),
-                                          lda, reinterpret_cast<const sycl::half *>(B), ldb, beta,
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), reinterpret_cast<const sycl::half *>(A),
+                                          lda, reinterpret_cast<const sycl::half *>(B), ldb, scalar(device_queue, beta),
                                           reinterpret_cast<float *>(C), ldc);
     } else if(Atype == ONEMKL_R_16B && Btype == ONEMKL_R_16B && Ctype == ONEMKL_R_16B) {
     status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, reinterpret_cast<const oneapi::mkl::bfloat16 *>(A),
-                                          lda, reinterpret_cast<const oneapi::mkl::bfloat16 *>(B), ldb, beta,
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), reinterpret_cast<const oneapi::mkl::bfloat16 *>(A),
+                                          lda, reinterpret_cast<const oneapi::mkl::bfloat16 *>(B), ldb, scalar(device_queue, beta),
                                           reinterpret_cast<oneapi::mkl::bfloat16 *>(C), ldc);
     } else if(Atype == ONEMKL_R_16B && Btype == ONEMKL_R_16B && Ctype == ONEMKL_R_32F) {
     status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, reinterpret_cast<const oneapi::mkl::bfloat16 *>(A),
-                                          lda, reinterpret_cast<const oneapi::mkl::bfloat16 *>(B), ldb, beta,
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), reinterpret_cast<const oneapi::mkl::bfloat16 *>(A),
+                                          lda, reinterpret_cast<const oneapi::mkl::bfloat16 *>(B), ldb, scalar(device_queue, beta),
                                           reinterpret_cast<float *>(C), ldc);
     } else if(Atype == ONEMKL_R_8I && Btype == ONEMKL_R_8I && Ctype == ONEMKL_R_32F) {
     status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, reinterpret_cast<const int8_t *>(A),
-                                          lda, reinterpret_cast<const int8_t *>(B), ldb, beta,
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), reinterpret_cast<const int8_t *>(A),
+                                          lda, reinterpret_cast<const int8_t *>(B), ldb, scalar(device_queue, beta),
                                           reinterpret_cast<float *>(C), ldc);
     } else if(Atype == ONEMKL_R_32F && Btype == ONEMKL_R_32F && Ctype == ONEMKL_R_32F) {
     status = oneapi::mkl::blas::column_major::gemm(device_queue->val, convert(transA),
-                                          convert(transB), m, n, k, alpha, reinterpret_cast<const float *>(A),
-                                          lda, reinterpret_cast<const float *>(B), ldb, beta,
+                                          convert(transB), m, n, k, scalar(device_queue, alpha), reinterpret_cast<const float *>(A),
+                                          lda, reinterpret_cast<const float *>(B), ldb, scalar(device_queue, beta),
                                           reinterpret_cast<float *>(C), ldc);
     }
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
     return 0;
 }
 
+// gemm_ex: hipblasGemm*Ex type combinations. A and B share a type, alpha and
+// beta have the compute type. oneMKL takes float scalars for int8 inputs, so
+// the int32 scalars hipBLAS passes in that case are converted.
+template <typename Tab, typename Tc, typename Ts, typename Th = Ts>
+struct gemm_ex_types {
+    using ab_type = Tab;
+    using c_type = Tc;
+    using scalar_type = Ts;
+    using hipblas_scalar_type = Th;
+};
+
+template <typename F>
+bool gemm_ex_dispatch(onemklDatatype_t Atype, onemklDatatype_t Btype, onemklDatatype_t Ctype,
+                onemklDatatype_t computeType, F f) {
+    using half = sycl::half;
+    using bf16 = oneapi::mkl::bfloat16;
+    if (Atype != Btype) {
+        return false;
+    }
+    if (Atype == ONEMKL_R_16F && Ctype == ONEMKL_R_16F && computeType == ONEMKL_R_16F) {
+        f(gemm_ex_types<half, half, half>());
+    } else if (Atype == ONEMKL_R_16F && Ctype == ONEMKL_R_16F && computeType == ONEMKL_R_32F) {
+        f(gemm_ex_types<half, half, float>());
+    } else if (Atype == ONEMKL_R_16F && Ctype == ONEMKL_R_32F && computeType == ONEMKL_R_32F) {
+        f(gemm_ex_types<half, float, float>());
+    } else if (Atype == ONEMKL_R_16B && Ctype == ONEMKL_R_16B && computeType == ONEMKL_R_32F) {
+        f(gemm_ex_types<bf16, bf16, float>());
+    } else if (Atype == ONEMKL_R_16B && Ctype == ONEMKL_R_32F && computeType == ONEMKL_R_32F) {
+        f(gemm_ex_types<bf16, float, float>());
+    } else if (Atype == ONEMKL_R_8I && Ctype == ONEMKL_R_32I && computeType == ONEMKL_R_32I) {
+        f(gemm_ex_types<int8_t, int32_t, float, int32_t>());
+    } else if (Atype == ONEMKL_R_32F && Ctype == ONEMKL_R_32F && computeType == ONEMKL_R_32F) {
+        f(gemm_ex_types<float, float, float>());
+    } else if (Atype == ONEMKL_R_64F && Ctype == ONEMKL_R_64F && computeType == ONEMKL_R_64F) {
+        f(gemm_ex_types<double, double, double>());
+    } else if (Atype == ONEMKL_C_32F && Ctype == ONEMKL_C_32F && computeType == ONEMKL_C_32F) {
+        f(gemm_ex_types<std::complex<float>, std::complex<float>, std::complex<float>>());
+    } else if (Atype == ONEMKL_C_64F && Ctype == ONEMKL_C_64F && computeType == ONEMKL_C_64F) {
+        f(gemm_ex_types<std::complex<double>, std::complex<double>, std::complex<double>>());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// alpha/beta as the oneMKL scalar type, forwarded by pointer when no
+// conversion is needed. A device scalar that needs one has no oneMKL slot, see
+// gemm_ex_kernel.
+template <typename Types>
+oneapi::mkl::value_or_pointer<typename Types::scalar_type> ex_scalar(syclQueue_t device_queue, const void *val) {
+    using Ts = typename Types::scalar_type;
+    using Th = typename Types::hipblas_scalar_type;
+    if constexpr (std::is_same_v<Ts, Th>) {
+        return scalar(device_queue, static_cast<const Ts *>(val));
+    } else {
+        return Ts(*static_cast<const Th *>(val));
+    }
+}
+
+// whether oneMKL can take the scalars, else gemm_ex_kernel runs the call
+template <typename Types>
+bool gemm_ex_onemkl(syclQueue_t device_queue) {
+    return device_queue->host_scalars
+        || std::is_same_v<typename Types::scalar_type, typename Types::hipblas_scalar_type>;
+}
+
+// The whole batch in one launch of onemkl_kernels::gemm, which reads device
+// scalars on the device, for the cases oneMKL's scalar slots cannot take.
+template <typename Types, typename BA, typename BB, typename BC>
+sycl::event gemm_ex_kernel(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, int64_t k, const void *alpha, BA a, int64_t lda, BB b, int64_t ldb,
+                const void *beta, BC c, int64_t ldc, int64_t batch_size) {
+    using Ts = typename Types::scalar_type;
+    using Th = typename Types::hipblas_scalar_type;
+    return onemkl_kernels::gemm<accumulate_type<Ts>>(device_queue->val, kernel_op(transA), kernel_op(transB),
+                m, n, k, scalar_arg(device_queue, static_cast<const Th *>(alpha)), a, lda, b, ldb,
+                scalar_arg(device_queue, static_cast<const Th *>(beta)), c, ldc, batch_size);
+}
+
+extern "C" int onemklGemmExSupported(onemklDatatype_t Atype, onemklDatatype_t Btype, onemklDatatype_t Ctype,
+                onemklDatatype_t computeType) {
+    return gemm_ex_dispatch(Atype, Btype, Ctype, computeType, [](auto) {});
+}
+
+extern "C" int onemklGemmEx(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, int64_t k, const void *alpha, const void *A, onemklDatatype_t Atype,
+                int64_t lda, const void *B, onemklDatatype_t Btype, int64_t ldb, const void *beta, void *C,
+                onemklDatatype_t Ctype, int64_t ldc, onemklDatatype_t computeType) {
+    auto &q = device_queue->val;
+    bool supported = gemm_ex_dispatch(Atype, Btype, Ctype, computeType, [&](auto types) {
+        using Types = decltype(types);
+        using Tab = typename Types::ab_type;
+        using Tc = typename Types::c_type;
+        if (!gemm_ex_onemkl<Types>(device_queue)) {
+            auto status = gemm_ex_kernel<Types>(device_queue, transA, transB, m, n, k, alpha,
+                        batch_view(static_cast<const Tab *>(A), 0), lda, batch_view(static_cast<const Tab *>(B), 0),
+                        ldb, beta, batch_view(static_cast<Tc *>(C), 0), ldc, 1);
+            __FORCE_MKL_FLUSH__(device_queue, status);
+            return;
+        }
+        auto status = oneapi::mkl::blas::column_major::gemm(q, convert(transA), convert(transB), m, n, k,
+                    ex_scalar<Types>(device_queue, alpha), static_cast<const Tab *>(A), lda,
+                    static_cast<const Tab *>(B), ldb, ex_scalar<Types>(device_queue, beta), static_cast<Tc *>(C), ldc);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+// pointer arrays go through the group API, see gemm_batch_group
+extern "C" int onemklGemmBatchedEx(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, int64_t k, const void *alpha, const void **A, onemklDatatype_t Atype,
+                int64_t lda, const void **B, onemklDatatype_t Btype, int64_t ldb, const void *beta, void **C,
+                onemklDatatype_t Ctype, int64_t ldc, int64_t batch_size, onemklDatatype_t computeType) {
+    auto &q = device_queue->val;
+    bool supported = gemm_ex_dispatch(Atype, Btype, Ctype, computeType, [&](auto types) {
+        using Types = decltype(types);
+        using Tab = typename Types::ab_type;
+        using Tc = typename Types::c_type;
+        using Ts = typename Types::scalar_type;
+        using Th = typename Types::hipblas_scalar_type;
+        if (!device_queue->host_scalars) {
+            auto status = gemm_ex_kernel<Types>(device_queue, transA, transB, m, n, k, alpha,
+                        batch_view(reinterpret_cast<const Tab **>(A)), lda,
+                        batch_view(reinterpret_cast<const Tab **>(B)), ldb, beta,
+                        batch_view(reinterpret_cast<Tc **>(C)), ldc, batch_size);
+            __FORCE_MKL_FLUSH__(device_queue, status);
+            return;
+        }
+        auto ta = convert(transA);
+        auto tb = convert(transB);
+        Ts h_alpha = Ts(*static_cast<const Th *>(alpha));
+        Ts h_beta = Ts(*static_cast<const Th *>(beta));
+        auto status = oneapi::mkl::blas::column_major::gemm_batch(q, &ta, &tb, &m, &n, &k, &h_alpha,
+                    reinterpret_cast<const Tab **>(A), &lda, reinterpret_cast<const Tab **>(B), &ldb, &h_beta,
+                    reinterpret_cast<Tc **>(C), &ldc, 1, &batch_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+// one oneMKL group per hipBLAS group, so all the groups are one launch
+extern "C" int onemklGemmGroupedBatchedEx(syclQueue_t device_queue, const onemklTranspose *transA,
+                const onemklTranspose *transB, const int64_t *m, const int64_t *n, const int64_t *k,
+                const void *alpha, const void **A, onemklDatatype_t Atype, const int64_t *lda, const void **B,
+                onemklDatatype_t Btype, const int64_t *ldb, const void *beta, void **C, onemklDatatype_t Ctype,
+                const int64_t *ldc, int64_t group_count, const int64_t *group_size, onemklDatatype_t computeType) {
+    auto &q = device_queue->val;
+    bool supported = gemm_ex_dispatch(Atype, Btype, Ctype, computeType, [&](auto types) {
+        using Types = decltype(types);
+        using Tab = typename Types::ab_type;
+        using Tc = typename Types::c_type;
+        using Ts = typename Types::scalar_type;
+        using Th = typename Types::hipblas_scalar_type;
+        std::vector<oneapi::mkl::transpose> ta(group_count), tb(group_count);
+        std::vector<Ts> h_alpha(group_count), h_beta(group_count);
+        for (int64_t g = 0; g < group_count; g++) {
+            ta[g] = convert(transA[g]);
+            tb[g] = convert(transB[g]);
+            h_alpha[g] = Ts(static_cast<const Th *>(alpha)[g]);
+            h_beta[g] = Ts(static_cast<const Th *>(beta)[g]);
+        }
+        auto status = oneapi::mkl::blas::column_major::gemm_batch(q, ta.data(), tb.data(), m, n, k,
+                    h_alpha.data(), reinterpret_cast<const Tab **>(A), lda, reinterpret_cast<const Tab **>(B),
+                    ldb, h_beta.data(), reinterpret_cast<Tc **>(C), ldc, group_count, group_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+extern "C" int onemklGemmStridedBatchedEx(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k, const void *alpha, const void *A,
+                onemklDatatype_t Atype, int64_t lda, int64_t stridea, const void *B, onemklDatatype_t Btype,
+                int64_t ldb, int64_t strideb, const void *beta, void *C, onemklDatatype_t Ctype, int64_t ldc,
+                int64_t stridec, int64_t batch_size, onemklDatatype_t computeType) {
+    auto &q = device_queue->val;
+    bool supported = gemm_ex_dispatch(Atype, Btype, Ctype, computeType, [&](auto types) {
+        using Types = decltype(types);
+        using Tab = typename Types::ab_type;
+        using Tc = typename Types::c_type;
+        if (!gemm_ex_onemkl<Types>(device_queue)) {
+            auto status = gemm_ex_kernel<Types>(device_queue, transA, transB, m, n, k, alpha,
+                        batch_view(static_cast<const Tab *>(A), stridea), lda,
+                        batch_view(static_cast<const Tab *>(B), strideb), ldb, beta,
+                        batch_view(static_cast<Tc *>(C), stridec), ldc, batch_size);
+            __FORCE_MKL_FLUSH__(device_queue, status);
+            return;
+        }
+        auto status = oneapi::mkl::blas::column_major::gemm_batch(q, convert(transA), convert(transB), m, n, k,
+                    ex_scalar<Types>(device_queue, alpha), static_cast<const Tab *>(A), lda, stridea,
+                    static_cast<const Tab *>(B), ldb, strideb, ex_scalar<Types>(device_queue, beta),
+                    static_cast<Tc *>(C), ldc, stridec, batch_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+// Level-1 Ex: hipblas*Ex type combinations. x and y share a type, the scalar
+// slot is alpha (axpy, scal), c and s (rot) or the result (dot, nrm2). The
+// kernels convert every element on the fly, see onemkl_kernels::axpy_ex.
+template <typename Tx, typename Ts, typename Te>
+struct l1_ex_types {
+    using x_type = Tx;
+    using scalar_type = Ts;
+    using exec_type = Te;
+};
+
+// all of x, the scalar and the execution in one of the standard precisions
+template <typename F>
+bool l1_ex_same_dispatch(onemklDatatype_t xType, onemklDatatype_t sType, onemklDatatype_t executionType, F f) {
+    if (xType != sType || xType != executionType) {
+        return false;
+    }
+    if (xType == ONEMKL_R_32F) {
+        f(l1_ex_types<float, float, float>());
+    } else if (xType == ONEMKL_R_64F) {
+        f(l1_ex_types<double, double, double>());
+    } else if (xType == ONEMKL_C_32F) {
+        f(l1_ex_types<std::complex<float>, std::complex<float>, std::complex<float>>());
+    } else if (xType == ONEMKL_C_64F) {
+        f(l1_ex_types<std::complex<double>, std::complex<double>, std::complex<double>>());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template <typename F>
+bool axpy_ex_dispatch(onemklDatatype_t xType, onemklDatatype_t alphaType, onemklDatatype_t executionType, F f) {
+    using half = sycl::half;
+    using bf16 = oneapi::mkl::bfloat16;
+    if (xType == ONEMKL_R_16F && alphaType == ONEMKL_R_16F && executionType == ONEMKL_R_16F) {
+        f(l1_ex_types<half, half, half>());
+    } else if (xType == ONEMKL_R_16F && alphaType == ONEMKL_R_16F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<half, half, float>());
+    } else if (xType == ONEMKL_R_16F && alphaType == ONEMKL_R_32F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<half, float, float>());
+    } else if (xType == ONEMKL_R_16B && alphaType == ONEMKL_R_32F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<bf16, float, float>());
+    } else {
+        return l1_ex_same_dispatch(xType, alphaType, executionType, f);
+    }
+    return true;
+}
+
+// scal additionally scales complex vectors by a real alpha
+template <typename F>
+bool scal_ex_dispatch(onemklDatatype_t xType, onemklDatatype_t alphaType, onemklDatatype_t executionType, F f) {
+    if (xType == ONEMKL_C_32F && alphaType == ONEMKL_R_32F && executionType == ONEMKL_C_32F) {
+        f(l1_ex_types<std::complex<float>, float, std::complex<float>>());
+    } else if (xType == ONEMKL_C_64F && alphaType == ONEMKL_R_64F && executionType == ONEMKL_C_64F) {
+        f(l1_ex_types<std::complex<double>, double, std::complex<double>>());
+    } else {
+        return axpy_ex_dispatch(xType, alphaType, executionType, f);
+    }
+    return true;
+}
+
+template <typename F>
+bool dot_ex_dispatch(onemklDatatype_t xType, onemklDatatype_t resultType, onemklDatatype_t executionType, F f) {
+    using half = sycl::half;
+    using bf16 = oneapi::mkl::bfloat16;
+    if (xType == ONEMKL_R_16F && resultType == ONEMKL_R_16F && executionType == ONEMKL_R_16F) {
+        f(l1_ex_types<half, half, half>());
+    } else if (xType == ONEMKL_R_16F && resultType == ONEMKL_R_16F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<half, half, float>());
+    } else if (xType == ONEMKL_R_16B && resultType == ONEMKL_R_16B && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<bf16, bf16, float>());
+    } else {
+        return l1_ex_same_dispatch(xType, resultType, executionType, f);
+    }
+    return true;
+}
+
+// for complex x the execution type names the real precision of the sum
+template <typename F>
+bool nrm2_ex_dispatch(onemklDatatype_t xType, onemklDatatype_t resultType, onemklDatatype_t executionType, F f) {
+    using half = sycl::half;
+    using bf16 = oneapi::mkl::bfloat16;
+    if (xType == ONEMKL_R_16F && resultType == ONEMKL_R_16F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<half, half, float>());
+    } else if (xType == ONEMKL_R_16B && resultType == ONEMKL_R_16B && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<bf16, bf16, float>());
+    } else if (xType == ONEMKL_R_32F && resultType == ONEMKL_R_32F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<float, float, float>());
+    } else if (xType == ONEMKL_R_64F && resultType == ONEMKL_R_64F && executionType == ONEMKL_R_64F) {
+        f(l1_ex_types<double, double, double>());
+    } else if (xType == ONEMKL_C_32F && resultType == ONEMKL_R_32F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<std::complex<float>, float, float>());
+    } else if (xType == ONEMKL_C_64F && resultType == ONEMKL_R_64F && executionType == ONEMKL_R_64F) {
+        f(l1_ex_types<std::complex<double>, double, double>());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// csType is the type of both c and s; complex vectors take either a real or a
+// complex s
+template <typename F>
+bool rot_ex_dispatch(onemklDatatype_t xType, onemklDatatype_t csType, onemklDatatype_t executionType, F f) {
+    using half = sycl::half;
+    using bf16 = oneapi::mkl::bfloat16;
+    if (xType == ONEMKL_R_16F && csType == ONEMKL_R_16F && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<half, half, float>());
+    } else if (xType == ONEMKL_R_16B && csType == ONEMKL_R_16B && executionType == ONEMKL_R_32F) {
+        f(l1_ex_types<bf16, bf16, float>());
+    } else if (xType == ONEMKL_C_32F && csType == ONEMKL_R_32F && executionType == ONEMKL_C_32F) {
+        f(l1_ex_types<std::complex<float>, float, std::complex<float>>());
+    } else if (xType == ONEMKL_C_64F && csType == ONEMKL_R_64F && executionType == ONEMKL_C_64F) {
+        f(l1_ex_types<std::complex<double>, double, std::complex<double>>());
+    } else {
+        return l1_ex_same_dispatch(xType, csType, executionType, f);
+    }
+    return true;
+}
+
+// Untyped vector arguments of the Ex routines, typed once the combination is
+// known. A single vector is a strided batch of one.
+struct strided_ex_view {
+    const void *base;
+    int64_t stride;
+    template <typename T>
+    onemkl_kernels::strided_batch<T> as() const {
+        return {static_cast<T *>(const_cast<void *>(base)), stride};
+    }
+};
+
+struct pointer_ex_view {
+    const void *const *ptrs;
+    template <typename T>
+    onemkl_kernels::pointer_batch<T> as() const {
+        return {reinterpret_cast<T *const *>(const_cast<void **>(ptrs))};
+    }
+};
+
+template <typename ViewX, typename ViewY>
+int axpy_ex(syclQueue_t device_queue, int64_t n, const void *alpha, onemklDatatype_t alphaType, onemklDatatype_t xType,
+                ViewX x, int64_t incx, onemklDatatype_t yType, ViewY y, int64_t incy, int64_t batch_size,
+                onemklDatatype_t executionType) {
+    if (xType != yType) {
+        return -1;
+    }
+    bool supported = axpy_ex_dispatch(xType, alphaType, executionType, [&](auto types) {
+        using Types = decltype(types);
+        using Tx = typename Types::x_type;
+        using Ts = typename Types::scalar_type;
+        auto status = onemkl_kernels::axpy_ex<typename Types::exec_type>(device_queue->val, n,
+                    scalar_arg(device_queue, static_cast<const Ts *>(alpha)), x.template as<const Tx>(),
+                    incx, y.template as<Tx>(), incy, batch_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+template <typename ViewX>
+int scal_ex(syclQueue_t device_queue, int64_t n, const void *alpha, onemklDatatype_t alphaType, onemklDatatype_t xType,
+                ViewX x, int64_t incx, int64_t batch_size, onemklDatatype_t executionType) {
+    bool supported = scal_ex_dispatch(xType, alphaType, executionType, [&](auto types) {
+        using Types = decltype(types);
+        using Tx = typename Types::x_type;
+        using Ts = typename Types::scalar_type;
+        auto status = onemkl_kernels::scal_ex<typename Types::exec_type>(device_queue->val, n,
+                    scalar_arg(device_queue, static_cast<const Ts *>(alpha)), x.template as<Tx>(), incx,
+                    batch_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+template <bool Conj, typename ViewX, typename ViewY>
+int dot_ex(syclQueue_t device_queue, int64_t n, onemklDatatype_t xType, ViewX x, int64_t incx, onemklDatatype_t yType,
+                ViewY y, int64_t incy, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType) {
+    auto &q = device_queue->val;
+    if (xType != yType) {
+        return -1;
+    }
+    bool supported = dot_ex_dispatch(xType, resultType, executionType, [&](auto types) {
+        using Types = decltype(types);
+        using Tx = typename Types::x_type;
+        auto status = onemkl_kernels::dot<typename Types::exec_type, Conj>(q, n, x.template as<const Tx>(), incx,
+                    y.template as<const Tx>(), incy, batch_size, static_cast<typename Types::scalar_type *>(result));
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+template <typename ViewX>
+int nrm2_ex(syclQueue_t device_queue, int64_t n, onemklDatatype_t xType, ViewX x, int64_t incx, int64_t batch_size,
+                void *result, onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    auto &q = device_queue->val;
+    bool supported = nrm2_ex_dispatch(xType, resultType, executionType, [&](auto types) {
+        using Types = decltype(types);
+        using Tx = typename Types::x_type;
+        using Te = typename Types::exec_type;
+        // complex elements are read as complex numbers of the execution precision
+        using Tk = std::conditional_t<std::is_same_v<Tx, std::complex<Te>>, Tx, Te>;
+        auto status = onemkl_kernels::nrm2<Tk>(q, n, x.template as<const Tx>(), incx, batch_size,
+                    static_cast<typename Types::scalar_type *>(result));
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+template <typename ViewX, typename ViewY>
+int rot_ex(syclQueue_t device_queue, int64_t n, onemklDatatype_t xType, ViewX x, int64_t incx, onemklDatatype_t yType,
+                ViewY y, int64_t incy, const void *c, const void *s, onemklDatatype_t csType, int64_t batch_size,
+                onemklDatatype_t executionType) {
+    if (xType != yType) {
+        return -1;
+    }
+    bool supported = rot_ex_dispatch(xType, csType, executionType, [&](auto types) {
+        using Types = decltype(types);
+        using Tx = typename Types::x_type;
+        using Ts = typename Types::scalar_type;
+        auto status = onemkl_kernels::rot_ex<typename Types::exec_type>(device_queue->val, n, x.template as<Tx>(), incx,
+                    y.template as<Tx>(), incy, scalar_arg(device_queue, static_cast<const Ts *>(c)),
+                    scalar_arg(device_queue, static_cast<const Ts *>(s)), batch_size);
+        __FORCE_MKL_FLUSH__(device_queue, status);
+    });
+    return supported ? 0 : -1;
+}
+
+extern "C" int onemklAxpyEx(syclQueue_t device_queue, int64_t n, const void *alpha, onemklDatatype_t alphaType,
+                const void *x, onemklDatatype_t xType, int64_t incx, void *y, onemklDatatype_t yType, int64_t incy,
+                onemklDatatype_t executionType) {
+    return axpy_ex(device_queue, n, alpha, alphaType, xType, strided_ex_view{x, 0}, incx, yType,
+                strided_ex_view{y, 0}, incy, 1, executionType);
+}
+
+extern "C" int onemklAxpyBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, const void **x, onemklDatatype_t xType, int64_t incx, void **y,
+                onemklDatatype_t yType, int64_t incy, int64_t batch_size, onemklDatatype_t executionType) {
+    return axpy_ex(device_queue, n, alpha, alphaType, xType, pointer_ex_view{x}, incx, yType,
+                pointer_ex_view{y}, incy, batch_size, executionType);
+}
+
+extern "C" int onemklAxpyStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, const void *x, onemklDatatype_t xType, int64_t incx, int64_t stridex,
+                void *y, onemklDatatype_t yType, int64_t incy, int64_t stridey, int64_t batch_size,
+                onemklDatatype_t executionType) {
+    return axpy_ex(device_queue, n, alpha, alphaType, xType, strided_ex_view{x, stridex}, incx, yType,
+                strided_ex_view{y, stridey}, incy, batch_size, executionType);
+}
+
+extern "C" int onemklScalEx(syclQueue_t device_queue, int64_t n, const void *alpha, onemklDatatype_t alphaType,
+                void *x, onemklDatatype_t xType, int64_t incx, onemklDatatype_t executionType) {
+    return scal_ex(device_queue, n, alpha, alphaType, xType, strided_ex_view{x, 0}, incx, 1,
+                executionType);
+}
+
+extern "C" int onemklScalBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, void **x, onemklDatatype_t xType, int64_t incx, int64_t batch_size,
+                onemklDatatype_t executionType) {
+    return scal_ex(device_queue, n, alpha, alphaType, xType, pointer_ex_view{x}, incx, batch_size,
+                executionType);
+}
+
+extern "C" int onemklScalStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, void *x, onemklDatatype_t xType, int64_t incx, int64_t stridex,
+                int64_t batch_size, onemklDatatype_t executionType) {
+    return scal_ex(device_queue, n, alpha, alphaType, xType, strided_ex_view{x, stridex}, incx,
+                batch_size, executionType);
+}
+
+extern "C" int onemklDotEx(syclQueue_t device_queue, int64_t n, const void *x, onemklDatatype_t xType,
+                int64_t incx, const void *y, onemklDatatype_t yType, int64_t incy, void *result,
+                onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    return dot_ex<false>(device_queue, n, xType, strided_ex_view{x, 0}, incx, yType,
+                strided_ex_view{y, 0}, incy, 1, result, resultType, executionType);
+}
+
+extern "C" int onemklDotBatchedEx(syclQueue_t device_queue, int64_t n, const void **x, onemklDatatype_t xType,
+                int64_t incx, const void **y, onemklDatatype_t yType, int64_t incy, int64_t batch_size,
+                void *result, onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    return dot_ex<false>(device_queue, n, xType, pointer_ex_view{x}, incx, yType, pointer_ex_view{y},
+                incy, batch_size, result, resultType, executionType);
+}
+
+extern "C" int onemklDotStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *x,
+                onemklDatatype_t xType, int64_t incx, int64_t stridex, const void *y, onemklDatatype_t yType,
+                int64_t incy, int64_t stridey, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType) {
+    return dot_ex<false>(device_queue, n, xType, strided_ex_view{x, stridex}, incx, yType,
+                strided_ex_view{y, stridey}, incy, batch_size, result, resultType, executionType);
+}
+
+extern "C" int onemklDotcEx(syclQueue_t device_queue, int64_t n, const void *x, onemklDatatype_t xType,
+                int64_t incx, const void *y, onemklDatatype_t yType, int64_t incy, void *result,
+                onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    return dot_ex<true>(device_queue, n, xType, strided_ex_view{x, 0}, incx, yType,
+                strided_ex_view{y, 0}, incy, 1, result, resultType, executionType);
+}
+
+extern "C" int onemklDotcBatchedEx(syclQueue_t device_queue, int64_t n, const void **x, onemklDatatype_t xType,
+                int64_t incx, const void **y, onemklDatatype_t yType, int64_t incy, int64_t batch_size,
+                void *result, onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    return dot_ex<true>(device_queue, n, xType, pointer_ex_view{x}, incx, yType, pointer_ex_view{y},
+                incy, batch_size, result, resultType, executionType);
+}
+
+extern "C" int onemklDotcStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *x,
+                onemklDatatype_t xType, int64_t incx, int64_t stridex, const void *y, onemklDatatype_t yType,
+                int64_t incy, int64_t stridey, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType) {
+    return dot_ex<true>(device_queue, n, xType, strided_ex_view{x, stridex}, incx, yType,
+                strided_ex_view{y, stridey}, incy, batch_size, result, resultType, executionType);
+}
+
+extern "C" int onemklNrm2Ex(syclQueue_t device_queue, int64_t n, const void *x, onemklDatatype_t xType,
+                int64_t incx, void *result, onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    return nrm2_ex(device_queue, n, xType, strided_ex_view{x, 0}, incx, 1, result, resultType,
+                executionType);
+}
+
+extern "C" int onemklNrm2BatchedEx(syclQueue_t device_queue, int64_t n, const void **x, onemklDatatype_t xType,
+                int64_t incx, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType) {
+    return nrm2_ex(device_queue, n, xType, pointer_ex_view{x}, incx, batch_size, result, resultType,
+                executionType);
+}
+
+extern "C" int onemklNrm2StridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *x,
+                onemklDatatype_t xType, int64_t incx, int64_t stridex, int64_t batch_size, void *result,
+                onemklDatatype_t resultType, onemklDatatype_t executionType) {
+    return nrm2_ex(device_queue, n, xType, strided_ex_view{x, stridex}, incx, batch_size, result,
+                resultType, executionType);
+}
+
+extern "C" int onemklRotEx(syclQueue_t device_queue, int64_t n, void *x, onemklDatatype_t xType, int64_t incx,
+                void *y, onemklDatatype_t yType, int64_t incy, const void *c, const void *s,
+                onemklDatatype_t csType, onemklDatatype_t executionType) {
+    return rot_ex(device_queue, n, xType, strided_ex_view{x, 0}, incx, yType, strided_ex_view{y, 0},
+                incy, c, s, csType, 1, executionType);
+}
+
+extern "C" int onemklRotBatchedEx(syclQueue_t device_queue, int64_t n, void **x, onemklDatatype_t xType,
+                int64_t incx, void **y, onemklDatatype_t yType, int64_t incy, const void *c, const void *s,
+                onemklDatatype_t csType, int64_t batch_size, onemklDatatype_t executionType) {
+    return rot_ex(device_queue, n, xType, pointer_ex_view{x}, incx, yType, pointer_ex_view{y}, incy, c,
+                s, csType, batch_size, executionType);
+}
+
+extern "C" int onemklRotStridedBatchedEx(syclQueue_t device_queue, int64_t n, void *x, onemklDatatype_t xType,
+                int64_t incx, int64_t stridex, void *y, onemklDatatype_t yType, int64_t incy, int64_t stridey,
+                const void *c, const void *s, onemklDatatype_t csType, int64_t batch_size,
+                onemklDatatype_t executionType) {
+    return rot_ex(device_queue, n, xType, strided_ex_view{x, stridex}, incx, yType,
+                strided_ex_view{y, stridey}, incy, c, s, csType, batch_size, executionType);
+}
+
 extern "C" void onemklCherk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float alpha, const float _Complex* a, int64_t lda, float beta, float _Complex* c, int64_t ldc) {
+                const float *alpha, const float _Complex* a, int64_t lda, const float *beta, float _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::herk(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, reinterpret_cast<const std::complex<float> *>(a), lda,
-                beta, reinterpret_cast<std::complex<float> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                scalar(device_queue, beta), reinterpret_cast<std::complex<float> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZherk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double alpha, const double _Complex* a, int64_t lda, double beta, double _Complex* c, int64_t ldc) {
+                const double *alpha, const double _Complex* a, int64_t lda, const double *beta, double _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::herk(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, reinterpret_cast<const std::complex<double> *>(a), lda,
-                beta, reinterpret_cast<std::complex<double> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                scalar(device_queue, beta), reinterpret_cast<std::complex<double> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklCher2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float beta, float _Complex* c, int64_t ldc) {
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float *beta, float _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::her2k(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, reinterpret_cast<const std::complex<float> *>(a), lda,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
                 reinterpret_cast<const std::complex<float> *>(b), ldb,
-                beta, reinterpret_cast<std::complex<float> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, beta), reinterpret_cast<std::complex<float> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklZher2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex* a, int64_t lda,  const double _Complex* b, int64_t ldb,
-                double beta, double _Complex* c, int64_t ldc) {
+                const double _Complex *alpha, const double _Complex* a, int64_t lda,  const double _Complex* b, int64_t ldb,
+                const double *beta, double _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::her2k(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, reinterpret_cast<const std::complex<double> *>(a), lda,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
                 reinterpret_cast<const std::complex<double> *>(b), ldb,
-                beta, reinterpret_cast<std::complex<double> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, beta), reinterpret_cast<std::complex<double> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                float alpha, const float* a, int64_t lda, const float* b, int64_t ldb,
-                float beta, float* c, int64_t ldc) {
+                const float *alpha, const float* a, int64_t lda, const float* b, int64_t ldb,
+                const float *beta, float* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::symm(device_queue->val, convert(side), convert(uplo), m, n,
-                alpha, a, lda, b, ldb, beta, c, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), a, lda, b, ldb, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
-                double beta, double* c, int64_t ldc) {
+                const double *alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
+                const double *beta, double* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::symm(device_queue->val, convert(side), convert(uplo), m, n,
-                alpha, a, lda, b, ldb, beta, c, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), a, lda, b, ldb, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float _Complex beta, float _Complex* c, int64_t ldc) {
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float _Complex *beta, float _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::symm(device_queue->val, convert(side), convert(uplo), m, n,
-                static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
                 reinterpret_cast<const std::complex<float> *>(b), ldb,
-                static_cast<const std::complex<float>>(beta), reinterpret_cast<std::complex<float> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, beta), reinterpret_cast<std::complex<float> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                double _Complex alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
-                double _Complex beta, double _Complex* c, int64_t ldc) {
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
+                const double _Complex *beta, double _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::symm(device_queue->val, convert(side), convert(uplo), m, n,
-                static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
                 reinterpret_cast<const std::complex<double> *>(b), ldb,
-                static_cast<std::complex<double>>(beta), reinterpret_cast<std::complex<double> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, beta), reinterpret_cast<std::complex<double> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float alpha, const float* a, int64_t lda, float beta, float* c, int64_t ldc) {
+                const float *alpha, const float* a, int64_t lda, const float *beta, float* c, int64_t ldc) {
+    if (split_syrk(device_queue, uplo, trans, n, k, alpha, a, lda, beta, c, ldc)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::syrk(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, a, lda, beta, c, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), a, lda, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double alpha, const double* a, int64_t lda, double beta, double* c, int64_t ldc) {
+                const double *alpha, const double* a, int64_t lda, const double *beta, double* c, int64_t ldc) {
+    if (split_syrk(device_queue, uplo, trans, n, k, alpha, a, lda, beta, c, ldc)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::syrk(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, a, lda, beta, c, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), a, lda, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex* a, int64_t lda, float _Complex beta, float _Complex* c, int64_t ldc) {
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex *beta, float _Complex* c, int64_t ldc) {
+    if (split_syrk(device_queue, uplo, trans, n, k, reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> *>(a), lda,
+                reinterpret_cast<const std::complex<float> *>(beta),
+                reinterpret_cast<std::complex<float> *>(c), ldc)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::syrk(device_queue->val, convert(uplo), convert(trans), n, k,
-                static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
-                static_cast<std::complex<float>>(beta), reinterpret_cast<std::complex<float> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                scalar(device_queue, beta), reinterpret_cast<std::complex<float> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex* a, int64_t lda, double _Complex beta, double _Complex* c, int64_t ldc) {
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex *beta, double _Complex* c, int64_t ldc) {
+    if (split_syrk(device_queue, uplo, trans, n, k, reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> *>(a), lda,
+                reinterpret_cast<const std::complex<double> *>(beta),
+                reinterpret_cast<std::complex<double> *>(c), ldc)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::syrk(device_queue->val, convert(uplo), convert(trans), n, k,
-                static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
-                static_cast<std::complex<double>>(beta), reinterpret_cast<std::complex<double> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                scalar(device_queue, beta), reinterpret_cast<std::complex<double> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklSsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float alpha, const float* a, int64_t lda, const float* b, int64_t ldb, float beta, float* c, int64_t ldc) {
+                const float *alpha, const float* a, int64_t lda, const float* b, int64_t ldb, const float *beta, float* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::syr2k(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, a, lda, b, ldb, beta, c, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), a, lda, b, ldb, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double alpha, const double* a, int64_t lda, const double* b, int64_t ldb, double beta, double* c, int64_t ldc) {
+                const double *alpha, const double* a, int64_t lda, const double* b, int64_t ldb, const double *beta, double* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::syr2k(device_queue->val, convert(uplo), convert(trans), n, k,
-                alpha, a, lda, b, ldb, beta, c, ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, alpha), a, lda, b, ldb, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float _Complex beta, float _Complex* c, int64_t ldc) {
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float _Complex *beta, float _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::syr2k(device_queue->val, convert(uplo), convert(trans), n, k,
-                static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
                 reinterpret_cast<const std::complex<float> *>(b), ldb,
-                static_cast<std::complex<float>>(beta), reinterpret_cast<std::complex<float> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, beta), reinterpret_cast<std::complex<float> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
-                double _Complex beta, double _Complex* c, int64_t ldc) {
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
+                const double _Complex *beta, double _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::syr2k(device_queue->val, convert(uplo), convert(trans), n, k,
-                static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
                 reinterpret_cast<const std::complex<double> *>(b), ldb,
-                static_cast<std::complex<double>>(beta), reinterpret_cast<std::complex<double> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+                scalar(device_queue, beta), reinterpret_cast<std::complex<double> *>(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklChemm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float _Complex beta, float _Complex* c, int64_t ldc) {
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float _Complex *beta, float _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::hemm(device_queue->val, convert(side), convert(uplo), m, n,
-                static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
-                reinterpret_cast<const std::complex<float> *>(b), ldb, static_cast<std::complex<float>>(beta),
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                reinterpret_cast<const std::complex<float> *>(b), ldb, scalar(device_queue, beta),
                 reinterpret_cast<std::complex<float> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZhemm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                double _Complex alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
-                double _Complex beta, double _Complex* c, int64_t ldc) {
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
+                const double _Complex *beta, double _Complex* c, int64_t ldc) {
     auto status = oneapi::mkl::blas::column_major::hemm(device_queue->val, convert(side), convert(uplo), m, n,
-                static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
-                reinterpret_cast<const std::complex<double> *>(b), ldb, static_cast<std::complex<double>>(beta),
+                scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                reinterpret_cast<const std::complex<double> *>(b), ldb, scalar(device_queue, beta),
                 reinterpret_cast<std::complex<double> *>(c), ldc);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklStrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, float alpha, const float *a, int64_t lda, float *b, int64_t ldb) {
+                 int64_t m, int64_t n, const float *alpha, const float *a, int64_t lda, float *b, int64_t ldb) {
     auto status = oneapi::mkl::blas::column_major::trmm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, alpha, a, lda, b, ldb);
-    __FORCE_MKL_FLUSH__(status);
+                 m, n, scalar(device_queue, alpha), a, lda, b, ldb);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDtrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, double alpha, const double *a, int64_t lda, double *b, int64_t ldb) {
+                 int64_t m, int64_t n, const double *alpha, const double *a, int64_t lda, double *b, int64_t ldb) {
     auto status = oneapi::mkl::blas::column_major::trmm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, alpha, a, lda, b, ldb);
-    __FORCE_MKL_FLUSH__(status);
+                 m, n, scalar(device_queue, alpha), a, lda, b, ldb);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCtrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, float _Complex alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb) {
+                 int64_t m, int64_t n, const float _Complex *alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb) {
     auto status = oneapi::mkl::blas::column_major::trmm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                 m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
                 reinterpret_cast<std::complex<float> *>(b), ldb);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZtrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb) {
+                 int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb) {
     auto status = oneapi::mkl::blas::column_major::trmm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                 m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
                 reinterpret_cast<std::complex<double> *>(b), ldb);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 extern "C" void onemklStrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, float alpha, const float *a, int64_t lda, float *b, int64_t ldb) {
+                 int64_t m, int64_t n, const float *alpha, const float *a, int64_t lda, float *b, int64_t ldb) {
+    if (split_trsm(device_queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::trsm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, alpha, a, lda, b, ldb);
-    __FORCE_MKL_FLUSH__(status);
+                 m, n, scalar(device_queue, alpha), a, lda, b, ldb);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklDtrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, double alpha, const double *a, int64_t lda, double *b, int64_t ldb) {
+                 int64_t m, int64_t n, const double *alpha, const double *a, int64_t lda, double *b, int64_t ldb) {
+    if (split_trsm(device_queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::trsm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, alpha, a, lda, b, ldb);
-    __FORCE_MKL_FLUSH__(status);
+                 m, n, scalar(device_queue, alpha), a, lda, b, ldb);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklCtrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, float _Complex alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb) {
+                 int64_t m, int64_t n, const float _Complex *alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb) {
+    if (split_trsm(device_queue, side, uplo, trans, diag, m, n,
+                reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> *>(a), lda,
+                reinterpret_cast<std::complex<float> *>(b), ldb)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::trsm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
+                 m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda,
                 reinterpret_cast<std::complex<float> *>(b), ldb);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 extern "C" void onemklZtrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag,
-                 int64_t m, int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb) {
+                 int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb) {
+    if (split_trsm(device_queue, side, uplo, trans, diag, m, n,
+                reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> *>(a), lda,
+                reinterpret_cast<std::complex<double> *>(b), ldb)) {
+        return;
+    }
     auto status = oneapi::mkl::blas::column_major::trsm(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
+                 m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda,
                 reinterpret_cast<std::complex<double> *>(b), ldb);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 
 void onemklStrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float alpha, const float *a, int64_t lda, int64_t stridea, float *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+                int64_t n, const float *alpha, const float *a, int64_t lda, int64_t stridea, float *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::trsm_batch(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, alpha, a, stridea, lda, b, ldb, strideb, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+                 m, n, scalar(device_queue, alpha), a, lda, stridea, b, ldb, strideb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 void onemklDtrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double alpha, const double *a, int64_t lda, int64_t stridea, double *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+                int64_t n, const double *alpha, const double *a, int64_t lda, int64_t stridea, double *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::trsm_batch(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, alpha, a, stridea, lda, b, ldb, strideb, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+                 m, n, scalar(device_queue, alpha), a, lda, stridea, b, ldb, strideb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 void onemklCtrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float _Complex alpha, const float _Complex*a, int64_t lda, int64_t stridea, float _Complex*b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+                int64_t n, const float _Complex *alpha, const float _Complex*a, int64_t lda, int64_t stridea, float _Complex*b, int64_t ldb, int64_t strideb, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::trsm_batch(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, static_cast<std::complex<float>>(alpha), reinterpret_cast<const std::complex<float> *>(a), lda, stridea,
+                 m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda, stridea,
                 reinterpret_cast<std::complex<float> *>(b), ldb, strideb, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
 }
 void onemklZtrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda, int64_t stridea, double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
     auto status = oneapi::mkl::blas::column_major::trsm_batch(device_queue->val, convert(side), convert(uplo), convert(trans), convert(diag),
-                 m, n, static_cast<std::complex<double>>(alpha), reinterpret_cast<const std::complex<double> *>(a), lda, stridea,
+                 m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda, stridea,
                 reinterpret_cast<std::complex<double> *>(b), ldb, strideb, batch_size);
-    __FORCE_MKL_FLUSH__(status);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// Pointer-array trsm and trmm: the device arrays of pointers are passed to a
+// single group of the group API as they are, see gemm_batch_group. Both are
+// linear in B, so a device alpha is applied to B by a kernel beforehand and
+// the group API gets alpha = 1.
+template <typename T>
+sycl::event trsm_batch_group(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const T *alpha, const T **a, int64_t lda, T **b,
+                int64_t ldb, int64_t batch_size) {
+    auto &q = device_queue->val;
+    auto sd = convert(side);
+    auto ul = convert(uplo);
+    auto tr = convert(trans);
+    auto dg = convert(diag);
+    T h_alpha = T(1);
+    if (device_queue->host_scalars) {
+        h_alpha = *alpha;
+    } else {
+        onemkl_kernels::scale_matrix(q, m, n, scalar_arg(device_queue, alpha), batch_view(b), ldb, batch_size);
+    }
+    return oneapi::mkl::blas::column_major::trsm_batch(q, &sd, &ul, &tr, &dg, &m, &n, &h_alpha, a, &lda, b, &ldb,
+                1, &batch_size);
+}
+
+template <typename T>
+sycl::event trmm_batch_group(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const T *alpha, const T **a, int64_t lda, T **b,
+                int64_t ldb, int64_t batch_size) {
+    auto &q = device_queue->val;
+    auto sd = convert(side);
+    auto ul = convert(uplo);
+    auto tr = convert(trans);
+    auto dg = convert(diag);
+    T h_alpha = T(1);
+    if (device_queue->host_scalars) {
+        h_alpha = *alpha;
+    } else {
+        onemkl_kernels::scale_matrix(q, m, n, scalar_arg(device_queue, alpha), batch_view(b), ldb, batch_size);
+    }
+    return oneapi::mkl::blas::column_major::trmm_batch(q, &sd, &ul, &tr, &dg, &m, &n, &h_alpha, a, &lda, b, &ldb,
+                1, &batch_size);
+}
+
+extern "C" void onemklStrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float *alpha, const float **a, int64_t lda,
+                float **b, int64_t ldb, int64_t batch_size) {
+    auto status = trsm_batch_group(device_queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDtrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double *alpha, const double **a, int64_t lda,
+                double **b, int64_t ldb, int64_t batch_size) {
+    auto status = trsm_batch_group(device_queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCtrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda,
+                float _Complex **b, int64_t ldb, int64_t batch_size) {
+    auto status = trsm_batch_group(device_queue, side, uplo, trans, diag, m, n, reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> **>(a), lda, reinterpret_cast<std::complex<float> **>(b), ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZtrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                double _Complex **b, int64_t ldb, int64_t batch_size) {
+    auto status = trsm_batch_group(device_queue, side, uplo, trans, diag, m, n, reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> **>(a), lda, reinterpret_cast<std::complex<double> **>(b), ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklStrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float *alpha, const float **a, int64_t lda,
+                float **b, int64_t ldb, int64_t batch_size) {
+    auto status = trmm_batch_group(device_queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDtrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double *alpha, const double **a, int64_t lda,
+                double **b, int64_t ldb, int64_t batch_size) {
+    auto status = trmm_batch_group(device_queue, side, uplo, trans, diag, m, n, alpha, a, lda, b, ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCtrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda,
+                float _Complex **b, int64_t ldb, int64_t batch_size) {
+    auto status = trmm_batch_group(device_queue, side, uplo, trans, diag, m, n, reinterpret_cast<const std::complex<float> *>(alpha),
+                reinterpret_cast<const std::complex<float> **>(a), lda, reinterpret_cast<std::complex<float> **>(b), ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZtrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                double _Complex **b, int64_t ldb, int64_t batch_size) {
+    auto status = trmm_batch_group(device_queue, side, uplo, trans, diag, m, n, reinterpret_cast<const std::complex<double> *>(alpha),
+                reinterpret_cast<const std::complex<double> **>(a), lda, reinterpret_cast<std::complex<double> **>(b), ldb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklStrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float *alpha, const float *a, int64_t lda,
+                int64_t stridea, float *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::trmm_batch(device_queue->val, convert(side), convert(uplo),
+                convert(trans), convert(diag), m, n, scalar(device_queue, alpha), a, lda, stridea, b, ldb, strideb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDtrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double *alpha, const double *a, int64_t lda,
+                int64_t stridea, double *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::trmm_batch(device_queue->val, convert(side), convert(uplo),
+                convert(trans), convert(diag), m, n, scalar(device_queue, alpha), a, lda, stridea, b, ldb, strideb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCtrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda,
+                int64_t stridea, float _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::trmm_batch(device_queue->val, convert(side), convert(uplo),
+                convert(trans), convert(diag), m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<float> *>(a), lda, stridea,
+                reinterpret_cast<std::complex<float> *>(b), ldb, strideb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZtrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda,
+                int64_t stridea, double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size) {
+    auto status = oneapi::mkl::blas::column_major::trmm_batch(device_queue->val, convert(side), convert(uplo),
+                convert(trans), convert(diag), m, n, scalar(device_queue, alpha), reinterpret_cast<const std::complex<double> *>(a), lda, stridea,
+                reinterpret_cast<std::complex<double> *>(b), ldb, strideb, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// syrkx and herkx: C = alpha * op(A) * op(B)^T (op(B)^H for herkx) + beta * C
+// on the 'uplo' triangle of C, which is gemmt with the second operand
+// transposed. gemmt only computes that triangle, half the work of a gemm.
+// oneMKL has no batched gemmt, so a batch is one gemmt per problem on the
+// in-order queue; only the last one is flushed, which pushes out the others.
+// For herkx the diagonal of op(A) * op(B)^H need not be real, a single kernel
+// after the last gemmt clears its imaginary part for the whole batch.
+template <typename T, bool Herm>
+sycl::event rkx(sycl::queue &q, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                oneapi::mkl::value_or_pointer<T> alpha, const T *a, int64_t lda, const T *b, int64_t ldb,
+                oneapi::mkl::value_or_pointer<T> beta, T *c, int64_t ldc) {
+    auto transb = trans != ONEMKL_TRANSPOSE_NONTRANS ? oneapi::mkl::transpose::nontrans
+                : Herm ? oneapi::mkl::transpose::conjtrans : oneapi::mkl::transpose::trans;
+    return oneapi::mkl::blas::column_major::gemmt(q, convert(uplo), convert(trans), transb, n, k, alpha, a, lda,
+                b, ldb, beta, c, ldc);
+}
+
+template <typename T, bool Herm>
+sycl::event rkx_strided(sycl::queue &q, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                oneapi::mkl::value_or_pointer<T> alpha, const T *a, int64_t lda, int64_t stridea, const T *b,
+                int64_t ldb, int64_t strideb, oneapi::mkl::value_or_pointer<T> beta, T *c, int64_t ldc,
+                int64_t stridec, int64_t batch_size) {
+    sycl::event status;
+    for (int64_t i = 0; i < batch_size; i++) {
+        status = rkx<T, Herm>(q, uplo, trans, n, k, alpha, a + i * stridea, lda, b + i * strideb, ldb, beta,
+                    c + i * stridec, ldc);
+    }
+    if (Herm) {
+        status = onemkl_kernels::real_diagonal(q, n, onemkl_kernels::strided_batch<T>{c, stridec}, ldc,
+                    batch_size);
+    }
+    return status;
+}
+
+// the pointer arrays are in device memory and are read back once
+template <typename T, bool Herm>
+sycl::event rkx_batch(sycl::queue &q, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                oneapi::mkl::value_or_pointer<T> alpha, const T **a, int64_t lda, const T **b, int64_t ldb,
+                oneapi::mkl::value_or_pointer<T> beta, T **c, int64_t ldc, int64_t batch_size) {
+    std::vector<const T *> h_a(batch_size), h_b(batch_size);
+    std::vector<T *> h_c(batch_size);
+    q.memcpy(h_a.data(), a, batch_size * sizeof(T *));
+    q.memcpy(h_b.data(), b, batch_size * sizeof(T *));
+    q.memcpy(h_c.data(), c, batch_size * sizeof(T *)).wait();
+    sycl::event status;
+    for (int64_t i = 0; i < batch_size; i++) {
+        status = rkx<T, Herm>(q, uplo, trans, n, k, alpha, h_a[i], lda, h_b[i], ldb, beta, h_c[i], ldc);
+    }
+    if (Herm) {
+        status = onemkl_kernels::real_diagonal(q, n, onemkl_kernels::pointer_batch<T>{c}, ldc, batch_size);
+    }
+    return status;
+}
+
+extern "C" void onemklSsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                const float *beta, float *c, int64_t ldc) {
+    auto status = rkx<float, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha), a, lda,
+                b, ldb, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float *alpha, const float **a, int64_t lda, const float **b, int64_t ldb,
+                const float *beta, float **c, int64_t ldc, int64_t batch_size) {
+    auto status = rkx_batch<float, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                reinterpret_cast<const float **>(a), lda, reinterpret_cast<const float **>(b), ldb, scalar(device_queue, beta),
+                reinterpret_cast<float **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *b,
+                int64_t ldb, int64_t strideb, const float *beta, float *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rkx_strided<float, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                a, lda, stridea, b, ldb, strideb, scalar(device_queue, beta), c, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double *a, int64_t lda, const double *b, int64_t ldb,
+                const double *beta, double *c, int64_t ldc) {
+    auto status = rkx<double, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha), a, lda,
+                b, ldb, scalar(device_queue, beta), c, ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double *alpha, const double **a, int64_t lda, const double **b, int64_t ldb,
+                const double *beta, double **c, int64_t ldc, int64_t batch_size) {
+    auto status = rkx_batch<double, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                reinterpret_cast<const double **>(a), lda, reinterpret_cast<const double **>(b), ldb, scalar(device_queue, beta),
+                reinterpret_cast<double **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *b,
+                int64_t ldb, int64_t strideb, const double *beta, double *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rkx_strided<double, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                a, lda, stridea, b, ldb, strideb, scalar(device_queue, beta), c, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, const float _Complex *b, int64_t ldb,
+                const float _Complex *beta, float _Complex *c, int64_t ldc) {
+    auto status = rkx<std::complex<float>, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha), as_sycl(a), lda,
+                as_sycl(b), ldb, scalar(device_queue, beta), as_sycl(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = rkx_batch<std::complex<float>, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                reinterpret_cast<const std::complex<float> **>(a), lda, reinterpret_cast<const std::complex<float> **>(b), ldb, scalar(device_queue, beta),
+                reinterpret_cast<std::complex<float> **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rkx_strided<std::complex<float>, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb, scalar(device_queue, beta), as_sycl(c), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, const double _Complex *b, int64_t ldb,
+                const double _Complex *beta, double _Complex *c, int64_t ldc) {
+    auto status = rkx<std::complex<double>, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha), as_sycl(a), lda,
+                as_sycl(b), ldb, scalar(device_queue, beta), as_sycl(c), ldc);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = rkx_batch<std::complex<double>, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                reinterpret_cast<const std::complex<double> **>(a), lda, reinterpret_cast<const std::complex<double> **>(b), ldb, scalar(device_queue, beta),
+                reinterpret_cast<std::complex<double> **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rkx_strided<std::complex<double>, false>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb, scalar(device_queue, beta), as_sycl(c), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// herkx: gemmt takes beta with the complex type, so a real beta on the device
+// (HIPBLAS_POINTER_MODE_DEVICE) has no slot there. Those calls run the rank-k
+// kernel instead, which reads it on the device, for the whole batch at once.
+template <typename T, typename SA, typename SB, typename BA, typename BB, typename BC>
+sycl::event herkx_kernel(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                const SA *alpha, BA a, int64_t lda, BB b, int64_t ldb, const SB *beta, BC c, int64_t ldc,
+                int64_t batch_size) {
+    return onemkl_kernels::rank_k<T, true, false>(device_queue->val, uplo == ONEMKL_UPLO_UPPER, kernel_op(trans), n,
+                k, scalar_arg(device_queue, alpha), a, lda, b, ldb, scalar_arg(device_queue, beta), c, ldc,
+                batch_size);
+}
+
+extern "C" void onemklCherkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, const float _Complex *b, int64_t ldb,
+                const float *beta, float _Complex *c, int64_t ldc) {
+    sycl::event status;
+    if (device_queue->host_scalars) {
+        status = rkx_strided<std::complex<float>, true>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                    as_sycl(a), lda, 0, as_sycl(b), ldb, 0, std::complex<float>(*beta), as_sycl(c), ldc, 0, 1);
+    } else {
+        status = herkx_kernel<std::complex<float>>(device_queue, uplo, trans, n, k, alpha, batch_view(a, 0), lda,
+                    batch_view(b, 0), ldb, beta, batch_view(c, 0), ldc, 1);
+    }
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCherkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float *beta, float _Complex **c, int64_t ldc, int64_t batch_size) {
+    sycl::event status;
+    if (device_queue->host_scalars) {
+        status = rkx_batch<std::complex<float>, true>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                    reinterpret_cast<const std::complex<float> **>(a), lda, reinterpret_cast<const std::complex<float> **>(b), ldb,
+                    std::complex<float>(*beta), reinterpret_cast<std::complex<float> **>(c), ldc, batch_size);
+    } else {
+        status = herkx_kernel<std::complex<float>>(device_queue, uplo, trans, n, k, alpha, batch_view(a), lda, batch_view(b), ldb,
+                    beta, batch_view(c), ldc, batch_size);
+    }
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCherkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    sycl::event status;
+    if (device_queue->host_scalars) {
+        status = rkx_strided<std::complex<float>, true>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                    as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb, std::complex<float>(*beta), as_sycl(c), ldc, stridec,
+                    batch_size);
+    } else {
+        status = herkx_kernel<std::complex<float>>(device_queue, uplo, trans, n, k, alpha, batch_view(a, stridea), lda,
+                    batch_view(b, strideb), ldb, beta, batch_view(c, stridec), ldc, batch_size);
+    }
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZherkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, const double _Complex *b, int64_t ldb,
+                const double *beta, double _Complex *c, int64_t ldc) {
+    sycl::event status;
+    if (device_queue->host_scalars) {
+        status = rkx_strided<std::complex<double>, true>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                    as_sycl(a), lda, 0, as_sycl(b), ldb, 0, std::complex<double>(*beta), as_sycl(c), ldc, 0, 1);
+    } else {
+        status = herkx_kernel<std::complex<double>>(device_queue, uplo, trans, n, k, alpha, batch_view(a, 0), lda,
+                    batch_view(b, 0), ldb, beta, batch_view(c, 0), ldc, 1);
+    }
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZherkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double *beta, double _Complex **c, int64_t ldc, int64_t batch_size) {
+    sycl::event status;
+    if (device_queue->host_scalars) {
+        status = rkx_batch<std::complex<double>, true>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                    reinterpret_cast<const std::complex<double> **>(a), lda, reinterpret_cast<const std::complex<double> **>(b), ldb,
+                    std::complex<double>(*beta), reinterpret_cast<std::complex<double> **>(c), ldc, batch_size);
+    } else {
+        status = herkx_kernel<std::complex<double>>(device_queue, uplo, trans, n, k, alpha, batch_view(a), lda, batch_view(b), ldb,
+                    beta, batch_view(c), ldc, batch_size);
+    }
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZherkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    sycl::event status;
+    if (device_queue->host_scalars) {
+        status = rkx_strided<std::complex<double>, true>(device_queue->val, uplo, trans, n, k, scalar(device_queue, alpha),
+                    as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb, std::complex<double>(*beta), as_sycl(c), ldc, stridec,
+                    batch_size);
+    } else {
+        status = herkx_kernel<std::complex<double>>(device_queue, uplo, trans, n, k, alpha, batch_view(a, stridea), lda,
+                    batch_view(b, strideb), ldb, beta, batch_view(c, stridec), ldc, batch_size);
+    }
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// geam and dgmm. Plain and strided calls go to oneMKL's omatadd(_batch) and
+// dgmm_batch. The cases oneMKL does not cover the way hipBLAS defines them
+// fall back to the kernels in onemkl_kernels.hpp: in-place geam, a zero alpha
+// or beta (the matrix it scales is not read), device scalars for omatadd,
+// which takes its scalars by value, and negative increments for dgmm.
+template <typename T>
+sycl::event geam_strided(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB, int64_t m, int64_t n,
+                const T *alpha, const T *A, int64_t lda, int64_t stridea, const T *beta, const T *B, int64_t ldb,
+                int64_t strideb, T *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto &q = device_queue->val;
+    auto a = scalar_arg(device_queue, alpha);
+    auto b = scalar_arg(device_queue, beta);
+    if (a.ptr == nullptr && b.ptr == nullptr && a.val != T(0) && b.val != T(0) && C != A && C != B) {
+        if (batch_size == 1) {
+            return oneapi::mkl::blas::column_major::omatadd(q, convert(transA), convert(transB), m, n,
+                        a.val, A, lda, b.val, B, ldb, C, ldc);
+        }
+        return oneapi::mkl::blas::column_major::omatadd_batch(q, convert(transA), convert(transB), m, n,
+                    a.val, A, lda, stridea, b.val, B, ldb, strideb, C, ldc, stridec, batch_size);
+    }
+    return onemkl_kernels::geam(q, kernel_op(transA), kernel_op(transB), m, n, a,
+                onemkl_kernels::strided_batch<const T>{A, stridea}, lda, b,
+                onemkl_kernels::strided_batch<const T>{B, strideb}, ldb,
+                onemkl_kernels::strided_batch<T>{C, stridec}, ldc, batch_size);
+}
+
+// oneMKL has no pointer-array omatadd_batch
+template <typename T>
+sycl::event geam_batch(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB, int64_t m, int64_t n,
+                const T *alpha, const T **A, int64_t lda, const T *beta, const T **B, int64_t ldb, T **C,
+                int64_t ldc, int64_t batch_size) {
+    auto &q = device_queue->val;
+    return onemkl_kernels::geam(q, kernel_op(transA), kernel_op(transB), m, n,
+                scalar_arg(device_queue, alpha), onemkl_kernels::pointer_batch<const T>{A}, lda,
+                scalar_arg(device_queue, beta), onemkl_kernels::pointer_batch<const T>{B}, ldb,
+                onemkl_kernels::pointer_batch<T>{C}, ldc, batch_size);
+}
+
+template <typename T>
+sycl::event dgmm_strided(sycl::queue &q, onemklSideMode side, int64_t m, int64_t n, const T *A, int64_t lda,
+                int64_t stridea, const T *x, int64_t incx, int64_t stridex, T *C, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    if (incx > 0) {
+        return oneapi::mkl::blas::column_major::dgmm_batch(q, convert(side), m, n, A, lda, stridea, x, incx,
+                    stridex, C, ldc, stridec, batch_size);
+    }
+    return onemkl_kernels::dgmm(q, side == ONEMKL_SIDE_LEFT, m, n,
+                onemkl_kernels::strided_batch<const T>{A, stridea}, lda,
+                onemkl_kernels::strided_batch<const T>{x, stridex}, incx,
+                onemkl_kernels::strided_batch<T>{C, stridec}, ldc, batch_size);
+}
+
+// a single group of the group API, see gemm_batch_group
+template <typename T>
+sycl::event dgmm_batch(sycl::queue &q, onemklSideMode side, int64_t m, int64_t n, const T **A, int64_t lda,
+                const T **x, int64_t incx, T **C, int64_t ldc, int64_t batch_size) {
+    if (incx > 0) {
+        auto s = convert(side);
+        return oneapi::mkl::blas::column_major::dgmm_batch(q, &s, &m, &n, A, &lda, x, &incx, C, &ldc, 1,
+                    &batch_size);
+    }
+    return onemkl_kernels::dgmm(q, side == ONEMKL_SIDE_LEFT, m, n, onemkl_kernels::pointer_batch<const T>{A},
+                lda, onemkl_kernels::pointer_batch<const T>{x}, incx, onemkl_kernels::pointer_batch<T>{C}, ldc,
+                batch_size);
+}
+
+
+extern "C" void onemklSgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const float *alpha, const float *A, int64_t lda, const float *beta,
+                const float *B, int64_t ldb, float *C, int64_t ldc) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, alpha, A, lda, 0,
+                beta, B, ldb, 0, C, ldc, 0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float *alpha, const float **A, int64_t lda,
+                const float *beta, const float **B, int64_t ldb, float **C, int64_t ldc, int64_t batch_size) {
+    auto status = geam_batch(device_queue, transA, transB, m, n, alpha,
+                A, lda, beta, B, ldb,
+                C, ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float *alpha, const float *A, int64_t lda,
+                int64_t stridea, const float *beta, const float *B, int64_t ldb, int64_t strideb, float *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, alpha, A, lda,
+                stridea, beta, B, ldb, strideb, C, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const double *alpha, const double *A, int64_t lda, const double *beta,
+                const double *B, int64_t ldb, double *C, int64_t ldc) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, alpha, A, lda, 0,
+                beta, B, ldb, 0, C, ldc, 0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double *alpha, const double **A, int64_t lda,
+                const double *beta, const double **B, int64_t ldb, double **C, int64_t ldc, int64_t batch_size) {
+    auto status = geam_batch(device_queue, transA, transB, m, n, alpha,
+                A, lda, beta, B, ldb,
+                C, ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double *alpha, const double *A, int64_t lda,
+                int64_t stridea, const double *beta, const double *B, int64_t ldb, int64_t strideb, double *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, alpha, A, lda,
+                stridea, beta, B, ldb, strideb, C, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const float _Complex *alpha, const float _Complex *A, int64_t lda, const float _Complex *beta,
+                const float _Complex *B, int64_t ldb, float _Complex *C, int64_t ldc) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, as_sycl(alpha), as_sycl(A), lda, 0,
+                as_sycl(beta), as_sycl(B), ldb, 0, as_sycl(C), ldc, 0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex **A, int64_t lda,
+                const float _Complex *beta, const float _Complex **B, int64_t ldb, float _Complex **C, int64_t ldc, int64_t batch_size) {
+    auto status = geam_batch(device_queue, transA, transB, m, n, as_sycl(alpha),
+                reinterpret_cast<const std::complex<float> **>(A), lda, as_sycl(beta), reinterpret_cast<const std::complex<float> **>(B), ldb,
+                reinterpret_cast<std::complex<float> **>(C), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex *A, int64_t lda,
+                int64_t stridea, const float _Complex *beta, const float _Complex *B, int64_t ldb, int64_t strideb, float _Complex *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, as_sycl(alpha), as_sycl(A), lda,
+                stridea, as_sycl(beta), as_sycl(B), ldb, strideb, as_sycl(C), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *A, int64_t lda, const double _Complex *beta,
+                const double _Complex *B, int64_t ldb, double _Complex *C, int64_t ldc) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, as_sycl(alpha), as_sycl(A), lda, 0,
+                as_sycl(beta), as_sycl(B), ldb, 0, as_sycl(C), ldc, 0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex **A, int64_t lda,
+                const double _Complex *beta, const double _Complex **B, int64_t ldb, double _Complex **C, int64_t ldc, int64_t batch_size) {
+    auto status = geam_batch(device_queue, transA, transB, m, n, as_sycl(alpha),
+                reinterpret_cast<const std::complex<double> **>(A), lda, as_sycl(beta), reinterpret_cast<const std::complex<double> **>(B), ldb,
+                reinterpret_cast<std::complex<double> **>(C), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *A, int64_t lda,
+                int64_t stridea, const double _Complex *beta, const double _Complex *B, int64_t ldb, int64_t strideb, double _Complex *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = geam_strided(device_queue, transA, transB, m, n, as_sycl(alpha), as_sycl(A), lda,
+                stridea, as_sycl(beta), as_sycl(B), ldb, strideb, as_sycl(C), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float *A, int64_t lda, const float *x, int64_t incx, float *C, int64_t ldc) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, A, lda, 0, x, incx, 0, C, ldc,
+                0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float **A, int64_t lda, const float **x, int64_t incx, float **C, int64_t ldc,
+                int64_t batch_size) {
+    auto status = dgmm_batch(device_queue->val, side, m, n, A, lda,
+                x, incx, C, ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const float *A, int64_t lda, int64_t stridea, const float *x, int64_t incx,
+                int64_t stridex, float *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, A, lda, stridea, x, incx, stridex,
+                C, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double *A, int64_t lda, const double *x, int64_t incx, double *C, int64_t ldc) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, A, lda, 0, x, incx, 0, C, ldc,
+                0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double **A, int64_t lda, const double **x, int64_t incx, double **C, int64_t ldc,
+                int64_t batch_size) {
+    auto status = dgmm_batch(device_queue->val, side, m, n, A, lda,
+                x, incx, C, ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklDdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const double *A, int64_t lda, int64_t stridea, const double *x, int64_t incx,
+                int64_t stridex, double *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, A, lda, stridea, x, incx, stridex,
+                C, ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float _Complex *A, int64_t lda, const float _Complex *x, int64_t incx, float _Complex *C, int64_t ldc) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, as_sycl(A), lda, 0, as_sycl(x), incx, 0, as_sycl(C), ldc,
+                0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float _Complex **A, int64_t lda, const float _Complex **x, int64_t incx, float _Complex **C, int64_t ldc,
+                int64_t batch_size) {
+    auto status = dgmm_batch(device_queue->val, side, m, n, reinterpret_cast<const std::complex<float> **>(A), lda,
+                reinterpret_cast<const std::complex<float> **>(x), incx, reinterpret_cast<std::complex<float> **>(C), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const float _Complex *A, int64_t lda, int64_t stridea, const float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, as_sycl(A), lda, stridea, as_sycl(x), incx, stridex,
+                as_sycl(C), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double _Complex *A, int64_t lda, const double _Complex *x, int64_t incx, double _Complex *C, int64_t ldc) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, as_sycl(A), lda, 0, as_sycl(x), incx, 0, as_sycl(C), ldc,
+                0, 1);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double _Complex **A, int64_t lda, const double _Complex **x, int64_t incx, double _Complex **C, int64_t ldc,
+                int64_t batch_size) {
+    auto status = dgmm_batch(device_queue->val, side, m, n, reinterpret_cast<const std::complex<double> **>(A), lda,
+                reinterpret_cast<const std::complex<double> **>(x), incx, reinterpret_cast<std::complex<double> **>(C), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklZdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const double _Complex *A, int64_t lda, int64_t stridea, const double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = dgmm_strided(device_queue->val, side, m, n, as_sycl(A), lda, stridea, as_sycl(x), incx, stridex,
+                as_sycl(C), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// Batched symm, hemm, syrk, herk, syr2k and her2k. syrk goes to oneMKL's
+// syrk_batch, strided or as a single group of the group API (see
+// gemm_batch_group). oneMKL has no batched form of the others, they run as one
+// tiled kernel launch for the whole batch (onemkl_kernels::symm and rank_k).
+template <typename T>
+sycl::event syrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                const T *alpha, const T *a, int64_t lda, int64_t stridea, const T *beta, T *c, int64_t ldc,
+                int64_t stridec, int64_t batch_size) {
+    auto &q = device_queue->val;
+    return oneapi::mkl::blas::column_major::syrk_batch(q, convert(uplo), convert(trans), n, k, scalar(device_queue, alpha),
+                a, lda, stridea, scalar(device_queue, beta), c, ldc, stridec, batch_size);
+}
+
+template <typename T>
+sycl::event syrk_group(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                const T *alpha, const T **a, int64_t lda, const T *beta, T **c, int64_t ldc, int64_t batch_size) {
+    auto &q = device_queue->val;
+    if (!device_queue->host_scalars) {
+        // the group API takes host scalars, see gemm_batch_group
+        return onemkl_kernels::rank_k<T, false, false>(q, uplo == ONEMKL_UPLO_UPPER, kernel_op(trans), n, k,
+                    scalar_arg(device_queue, alpha), batch_view(a), lda, batch_view(a), lda,
+                    scalar_arg(device_queue, beta), batch_view(c), ldc, batch_size);
+    }
+    auto ul = convert(uplo);
+    auto tr = convert(trans);
+    T h_alpha = *alpha;
+    T h_beta = *beta;
+    return oneapi::mkl::blas::column_major::syrk_batch(q, &ul, &tr, &n, &k, &h_alpha, a, &lda, &h_beta, c, &ldc,
+                1, &batch_size);
+}
+
+template <typename T, bool Herm, typename BA, typename BB, typename BC>
+sycl::event symm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
+                const T *alpha, BA a, int64_t lda, BB b, int64_t ldb, const T *beta, BC c, int64_t ldc,
+                int64_t batch_size) {
+    auto &q = device_queue->val;
+    return onemkl_kernels::symm<T, Herm>(q, side == ONEMKL_SIDE_LEFT, uplo == ONEMKL_UPLO_UPPER, m, n,
+                scalar_arg(device_queue, alpha), a, lda, b, ldb, scalar_arg(device_queue, beta),
+                c, ldc, batch_size);
+}
+
+template <typename T, bool Herm, bool Two, typename SA, typename SB, typename BA, typename BB, typename BC>
+sycl::event rank_k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
+                const SA *alpha, BA a, int64_t lda, BB b, int64_t ldb, const SB *beta, BC c, int64_t ldc,
+                int64_t batch_size) {
+    auto &q = device_queue->val;
+    return onemkl_kernels::rank_k<T, Herm, Two>(q, uplo == ONEMKL_UPLO_UPPER, kernel_op(trans), n, k,
+                scalar_arg(device_queue, alpha), a, lda, b, ldb, scalar_arg(device_queue, beta),
+                c, ldc, batch_size);
+}
+
+extern "C" void onemklSsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float **a, int64_t lda, const float *beta, float **c,
+                int64_t ldc, int64_t batch_size) {
+    auto status = syrk_group(device_queue, uplo, trans, n, k, as_sycl(alpha), reinterpret_cast<const float **>(a), lda,
+                as_sycl(beta), reinterpret_cast<float **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklSsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *beta,
+                float *c, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = syrk_strided(device_queue, uplo, trans, n, k, as_sycl(alpha), as_sycl(a), lda, stridea, as_sycl(beta),
+                as_sycl(c), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double **a, int64_t lda, const double *beta, double **c,
+                int64_t ldc, int64_t batch_size) {
+    auto status = syrk_group(device_queue, uplo, trans, n, k, as_sycl(alpha), reinterpret_cast<const double **>(a), lda,
+                as_sycl(beta), reinterpret_cast<double **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *beta,
+                double *c, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = syrk_strided(device_queue, uplo, trans, n, k, as_sycl(alpha), as_sycl(a), lda, stridea, as_sycl(beta),
+                as_sycl(c), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex *beta, float _Complex **c,
+                int64_t ldc, int64_t batch_size) {
+    auto status = syrk_group(device_queue, uplo, trans, n, k, as_sycl(alpha), reinterpret_cast<const std::complex<float> **>(a), lda,
+                as_sycl(beta), reinterpret_cast<std::complex<float> **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *beta,
+                float _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = syrk_strided(device_queue, uplo, trans, n, k, as_sycl(alpha), as_sycl(a), lda, stridea, as_sycl(beta),
+                as_sycl(c), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex *beta, double _Complex **c,
+                int64_t ldc, int64_t batch_size) {
+    auto status = syrk_group(device_queue, uplo, trans, n, k, as_sycl(alpha), reinterpret_cast<const std::complex<double> **>(a), lda,
+                as_sycl(beta), reinterpret_cast<std::complex<double> **>(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *beta,
+                double _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = syrk_strided(device_queue, uplo, trans, n, k, as_sycl(alpha), as_sycl(a), lda, stridea, as_sycl(beta),
+                as_sycl(c), ldc, stridec, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCherk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float _Complex **a, int64_t lda, const float *beta, float _Complex **c,
+                int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<float>, true, false>(device_queue, uplo, trans, n, k, alpha, batch_view(a), lda, batch_view(a),
+                lda, beta, batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCherk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float *beta,
+                float _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<float>, true, false>(device_queue, uplo, trans, n, k, alpha, batch_view(a, stridea), lda,
+                batch_view(a, stridea), lda, beta, batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZherk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double _Complex **a, int64_t lda, const double *beta, double _Complex **c,
+                int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<double>, true, false>(device_queue, uplo, trans, n, k, alpha, batch_view(a), lda, batch_view(a),
+                lda, beta, batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZherk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double *beta,
+                double _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<double>, true, false>(device_queue, uplo, trans, n, k, alpha, batch_view(a, stridea), lda,
+                batch_view(a, stridea), lda, beta, batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float **a, int64_t lda, const float **b, int64_t ldb,
+                const float *beta, float **c, int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<float, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a), lda,
+                batch_view(b), ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklSsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *b,
+                int64_t ldb, int64_t strideb, const float *beta, float *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rank_k_batch<float, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a, stridea),
+                lda, batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double **a, int64_t lda, const double **b, int64_t ldb,
+                const double *beta, double **c, int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<double, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a), lda,
+                batch_view(b), ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *b,
+                int64_t ldb, int64_t strideb, const double *beta, double *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rank_k_batch<double, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a, stridea),
+                lda, batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<float>, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a), lda,
+                batch_view(b), ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<float>, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a, stridea),
+                lda, batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<double>, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a), lda,
+                batch_view(b), ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<double>, false, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a, stridea),
+                lda, batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklCher2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float *beta, float _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<float>, true, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a), lda,
+                batch_view(b), ldb, beta, batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCher2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<float>, true, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a, stridea),
+                lda, batch_view(b, strideb), ldb, beta, batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZher2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double *beta, double _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<double>, true, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a), lda,
+                batch_view(b), ldb, beta, batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZher2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = rank_k_batch<std::complex<double>, true, true>(device_queue, uplo, trans, n, k, as_sycl(alpha), batch_view(a, stridea),
+                lda, batch_view(b, strideb), ldb, beta, batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklSsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float *alpha, const float **a, int64_t lda, const float **b, int64_t ldb,
+                const float *beta, float **c, int64_t ldc, int64_t batch_size) {
+    auto status = symm_batch<float, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a), lda, batch_view(b),
+                ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklSsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *b,
+                int64_t ldb, int64_t strideb, const float *beta, float *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = symm_batch<float, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a, stridea), lda,
+                batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double *alpha, const double **a, int64_t lda, const double **b, int64_t ldb,
+                const double *beta, double **c, int64_t ldc, int64_t batch_size) {
+    auto status = symm_batch<double, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a), lda, batch_view(b),
+                ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklDsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *b,
+                int64_t ldb, int64_t strideb, const double *beta, double *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = symm_batch<double, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a, stridea), lda,
+                batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = symm_batch<std::complex<float>, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a), lda, batch_view(b),
+                ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklCsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = symm_batch<std::complex<float>, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a, stridea), lda,
+                batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = symm_batch<std::complex<double>, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a), lda, batch_view(b),
+                ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = symm_batch<std::complex<double>, false>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a, stridea), lda,
+                batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" void onemklChemm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = symm_batch<std::complex<float>, true>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a), lda, batch_view(b),
+                ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklChemm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = symm_batch<std::complex<float>, true>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a, stridea), lda,
+                batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZhemm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size) {
+    auto status = symm_batch<std::complex<double>, true>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a), lda, batch_view(b),
+                ldb, as_sycl(beta), batch_view(c), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+extern "C" void onemklZhemm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size) {
+    auto status = symm_batch<std::complex<double>, true>(device_queue, side, uplo, m, n, as_sycl(alpha), batch_view(a, stridea), lda,
+                batch_view(b, strideb), ldb, as_sycl(beta), batch_view(c, stridec), ldc, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// Solvers (LAPACK)
+
+// oneMKL LAPACK works on 64-bit pivots while hipBLAS uses int. The scratch
+// buffer the caller provides (see onemkl.h) holds, in this order, a pointer to
+// each problem's pivots for the group APIs, the 64-bit pivots and then the
+// scratchpad oneMKL asked for.
+int64_t scratch_align(int64_t bytes) {
+    return (bytes + 255) / 256 * 256;
+}
+
+int64_t pivot_bytes(int64_t npiv, int64_t batch_size, bool group) {
+    return scratch_align(group ? batch_size * sizeof(int64_t *) : 0) +
+           scratch_align(npiv * batch_size * sizeof(int64_t));
+}
+
+template <typename T>
+struct lapack_scratch {
+    int64_t **ipiv_ptrs;
+    int64_t *ipiv;
+    T *scratchpad;
+    int64_t scratchpad_size;
+};
+
+template <typename T>
+lapack_scratch<T> split_scratch(void *scratch, int64_t bytes, int64_t npiv, int64_t batch_size, bool group) {
+    char *base = static_cast<char *>(scratch);
+    int64_t ptr_bytes = scratch_align(group ? batch_size * sizeof(int64_t *) : 0);
+    int64_t offset = pivot_bytes(npiv, batch_size, group);
+    return {reinterpret_cast<int64_t **>(base), reinterpret_cast<int64_t *>(base + ptr_bytes),
+            reinterpret_cast<T *>(base + offset), (bytes - offset) / (int64_t)sizeof(T)};
+}
+
+// oneMKL reports singular factors through exceptions rather than an info
+// array, and waiting for them would block the host on every call and break
+// capture. Routines with an info output instead run f() and then a kernel,
+// ordered after it, that writes the LAPACK info of each problem to the device
+// array 'info': the index of the first zero on the diagonal of its n x n
+// triangular factor in 'factor'. The exceptions reach the asynchronous handler
+// of the queue's context (see sycl_wrapper.cpp) and are not needed here.
+template <typename T, typename BA, typename F>
+sycl::event lapack_info_call(sycl::queue &q, int64_t n, BA factor, int64_t ld, int *info, int64_t batch_size,
+                F f) {
+    sycl::event done = f();
+    return onemkl_kernels::singular_info<T>(q, done, n, factor, ld, info, batch_size);
+}
+
+// getrf, ipiv == nullptr selects the non-pivoting factorization
+
+template <typename T>
+int64_t getrf_strided_scratchpad(sycl::queue &q, int64_t n, int64_t lda, int64_t stridea, bool pivot,
+                int64_t batch_size) {
+    int64_t size = pivot ? oneapi::mkl::lapack::getrf_batch_scratchpad_size<T>(q, n, n, lda, stridea, n, batch_size)
+                         : oneapi::mkl::lapack::getrfnp_batch_scratchpad_size<T>(q, n, n, lda, stridea, batch_size);
+    return pivot_bytes(pivot ? n : 0, batch_size, false) + size * sizeof(T);
+}
+
+template <typename T>
+void getrf_strided(syclQueue_t device_queue, int64_t n, T *a, int64_t lda, int64_t stridea, int *ipiv, int64_t stridep,
+                int *info, int64_t batch_size, void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, ipiv ? n : 0, batch_size, false);
+    if (ipiv == nullptr) {
+        auto status = lapack_info_call<T>(q, n, batch_view(a, stridea), lda, info, batch_size, [&] {
+            return oneapi::mkl::lapack::getrfnp_batch(q, n, n, a, lda, stridea, batch_size,
+                        s.scratchpad, s.scratchpad_size);
+        });
+        __FORCE_MKL_FLUSH__(device_queue, status);
+        return;
+    }
+    lapack_info_call<T>(q, n, batch_view(a, stridea), lda, info, batch_size, [&] {
+        return oneapi::mkl::lapack::getrf_batch(q, n, n, a, lda, stridea, s.ipiv, n, batch_size,
+                    s.scratchpad, s.scratchpad_size);
+    });
+    auto status = onemkl_kernels::copy(q, n, batch_view(s.ipiv, n), 1, batch_view(ipiv, stridep), 1, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+template <typename T>
+int64_t getrf_group_scratchpad(sycl::queue &q, int64_t n, int64_t lda, bool pivot, int64_t batch_size) {
+    int64_t size = pivot ? oneapi::mkl::lapack::getrf_batch_scratchpad_size<T>(q, &n, &n, &lda, 1, &batch_size)
+                         : oneapi::mkl::lapack::getrfnp_batch_scratchpad_size<T>(q, &n, &n, &lda, 1, &batch_size);
+    return pivot_bytes(pivot ? n : 0, batch_size, pivot) + size * sizeof(T);
+}
+
+// the pivots of the pointer-array variants are one array, n apart
+template <typename T>
+void getrf_group(syclQueue_t device_queue, int64_t n, T **a, int64_t lda, int *ipiv, int *info, int64_t batch_size,
+                void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    bool pivot = ipiv != nullptr;
+    auto s = split_scratch<T>(scratch, scratch_bytes, pivot ? n : 0, batch_size, pivot);
+    if (!pivot) {
+        auto status = lapack_info_call<T>(q, n, batch_view(a), lda, info, batch_size, [&] {
+            return oneapi::mkl::lapack::getrfnp_batch(q, &n, &n, a, &lda, 1, &batch_size,
+                        s.scratchpad, s.scratchpad_size);
+        });
+        __FORCE_MKL_FLUSH__(device_queue, status);
+        return;
+    }
+    onemkl_kernels::pointer_array(q, s.ipiv_ptrs, s.ipiv, n, batch_size);
+    lapack_info_call<T>(q, n, batch_view(a), lda, info, batch_size, [&] {
+        return oneapi::mkl::lapack::getrf_batch(q, &n, &n, a, &lda, s.ipiv_ptrs, 1, &batch_size,
+                    s.scratchpad, s.scratchpad_size);
+    });
+    auto status = onemkl_kernels::copy(q, n, batch_view(s.ipiv, n), 1, batch_view(ipiv, n), 1, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// getrs
+
+template <typename T>
+int64_t getrs_strided_scratchpad(sycl::queue &q, onemklTranspose trans, int64_t n, int64_t nrhs, int64_t lda,
+                int64_t stridea, int64_t ldb, int64_t strideb, int64_t batch_size) {
+    return pivot_bytes(n, batch_size, false) +
+           oneapi::mkl::lapack::getrs_batch_scratchpad_size<T>(q, convert(trans), n, nrhs, lda, stridea, n,
+                        ldb, strideb, batch_size) * sizeof(T);
+}
+
+template <typename T>
+void getrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs, T *a, int64_t lda,
+                int64_t stridea, const int *ipiv, int64_t stridep, T *b, int64_t ldb, int64_t strideb,
+                int64_t batch_size, void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, n, batch_size, false);
+    onemkl_kernels::copy(q, n, batch_view(ipiv, stridep), 1, batch_view(s.ipiv, n), 1, batch_size);
+    auto status = oneapi::mkl::lapack::getrs_batch(q, convert(trans), n, nrhs, a, lda, stridea, s.ipiv, n,
+                b, ldb, strideb, batch_size, s.scratchpad, s.scratchpad_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+template <typename T>
+int64_t getrs_group_scratchpad(sycl::queue &q, onemklTranspose trans, int64_t n, int64_t nrhs, int64_t lda,
+                int64_t ldb, int64_t batch_size) {
+    auto t = convert(trans);
+    return pivot_bytes(n, batch_size, true) +
+           oneapi::mkl::lapack::getrs_batch_scratchpad_size<T>(q, &t, &n, &nrhs, &lda, &ldb, 1,
+                        &batch_size) * sizeof(T);
+}
+
+template <typename T>
+void getrs_group(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs, T **a, int64_t lda,
+                const int *ipiv, T **b, int64_t ldb, int64_t batch_size, void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, n, batch_size, true);
+    auto t = convert(trans);
+    onemkl_kernels::copy(q, n, batch_view(ipiv, n), 1, batch_view(s.ipiv, n), 1, batch_size);
+    onemkl_kernels::pointer_array(q, s.ipiv_ptrs, s.ipiv, n, batch_size);
+    auto status = oneapi::mkl::lapack::getrs_batch(q, &t, &n, &nrhs, a, &lda, s.ipiv_ptrs, b, &ldb, 1,
+                &batch_size, s.scratchpad, s.scratchpad_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// getri, out of place: C = inv(A) from the LU factors in A, which are kept.
+// oneMKL inverts in place, so the factors are copied to C first. Without
+// pivots (ipiv == nullptr) the identity permutation is used.
+
+template <typename T>
+int64_t getri_group_scratchpad(sycl::queue &q, int64_t n, int64_t ldc, int64_t batch_size) {
+    return pivot_bytes(n, batch_size, true) +
+           oneapi::mkl::lapack::getri_batch_scratchpad_size<T>(q, &n, &ldc, 1, &batch_size) * sizeof(T);
+}
+
+template <typename T>
+void getri_group(syclQueue_t device_queue, int64_t n, T **a, int64_t lda, const int *ipiv, T **c, int64_t ldc,
+                int *info, int64_t batch_size, void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, n, batch_size, true);
+    onemkl_kernels::copy_matrix(q, n, n, batch_view(a), lda, batch_view(c), ldc, batch_size);
+    if (ipiv != nullptr) {
+        onemkl_kernels::copy(q, n, batch_view(ipiv, n), 1, batch_view(s.ipiv, n), 1, batch_size);
+    } else {
+        onemkl_kernels::identity_pivots(q, n, batch_view(s.ipiv, n), batch_size);
+    }
+    onemkl_kernels::pointer_array(q, s.ipiv_ptrs, s.ipiv, n, batch_size);
+    // the factors in A are kept, a zero pivot there is the singular case
+    auto status = lapack_info_call<T>(q, n, batch_view(a), lda, info, batch_size, [&] {
+        return oneapi::mkl::lapack::getri_batch(q, &n, c, &ldc, s.ipiv_ptrs, 1, &batch_size,
+                    s.scratchpad, s.scratchpad_size);
+    });
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// trtri, out of place: invA = inv(A) for a triangular A, with the other
+// triangle of invA set to zero. A single matrix is copied to invA and
+// inverted in place by LAPACK trtri. oneMKL has no batched trtri, so a batch
+// solves A * invA = I with one trsm_batch instead.
+
+template <typename T>
+int64_t trtri_scratchpad(sycl::queue &q, onemklUplo uplo, onemklDiag diag, int64_t n, int64_t ldinva) {
+    return oneapi::mkl::lapack::trtri_scratchpad_size<T>(q, convert(uplo), convert(diag), n, ldinva) * sizeof(T);
+}
+
+template <typename T>
+void trtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n, const T *a, int64_t lda, T *inva,
+                int64_t ldinva, void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, 0, 1, false);
+    onemkl_kernels::copy_triangle<T>(q, uplo == ONEMKL_UPLO_UPPER, n, batch_view(a, 0), lda,
+                batch_view(inva, 0), ldinva, 1);
+    auto status = oneapi::mkl::lapack::trtri(q, convert(uplo), convert(diag), n, inva, ldinva, s.scratchpad,
+                s.scratchpad_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+template <typename T>
+void trtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n, const T *a, int64_t lda,
+                int64_t stridea, T *inva, int64_t ldinva, int64_t strideinva, int64_t batch_size) {
+    auto &q = device_queue->val;
+    onemkl_kernels::identity_matrix<T>(q, n, batch_view(inva, strideinva), ldinva, batch_size);
+    auto status = oneapi::mkl::blas::column_major::trsm_batch(q, oneapi::mkl::side::left, convert(uplo),
+                oneapi::mkl::transpose::nontrans, convert(diag), n, n, T(1), a, lda, stridea, inva, ldinva,
+                strideinva, batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+template <typename T>
+void trtri_group(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n, const T **a, int64_t lda,
+                T **inva, int64_t ldinva, int64_t batch_size) {
+    auto &q = device_queue->val;
+    auto side = oneapi::mkl::side::left;
+    auto ul = convert(uplo);
+    auto trans = oneapi::mkl::transpose::nontrans;
+    auto dg = convert(diag);
+    T one = T(1);
+    onemkl_kernels::identity_matrix<T>(q, n, batch_view(inva), ldinva, batch_size);
+    auto status = oneapi::mkl::blas::column_major::trsm_batch(q, &side, &ul, &trans, &dg, &n, &n, &one, a, &lda,
+                inva, &ldinva, 1, &batch_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// geqrf
+
+template <typename T>
+int64_t geqrf_strided_scratchpad(sycl::queue &q, int64_t m, int64_t n, int64_t lda, int64_t stridea,
+                int64_t stridet, int64_t batch_size) {
+    return oneapi::mkl::lapack::geqrf_batch_scratchpad_size<T>(q, m, n, lda, stridea, stridet, batch_size) *
+           sizeof(T);
+}
+
+template <typename T>
+void geqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, T *a, int64_t lda, int64_t stridea, T *tau,
+                int64_t stridet, int64_t batch_size, void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, 0, batch_size, false);
+    auto status = oneapi::mkl::lapack::geqrf_batch(q, m, n, a, lda, stridea, tau, stridet, batch_size,
+                s.scratchpad, s.scratchpad_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+template <typename T>
+int64_t geqrf_group_scratchpad(sycl::queue &q, int64_t m, int64_t n, int64_t lda, int64_t batch_size) {
+    return oneapi::mkl::lapack::geqrf_batch_scratchpad_size<T>(q, &m, &n, &lda, 1, &batch_size) * sizeof(T);
+}
+
+template <typename T>
+void geqrf_group(syclQueue_t device_queue, int64_t m, int64_t n, T **a, int64_t lda, T **tau, int64_t batch_size,
+                void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, 0, batch_size, false);
+    auto status = oneapi::mkl::lapack::geqrf_batch(q, &m, &n, a, &lda, tau, 1, &batch_size,
+                s.scratchpad, s.scratchpad_size);
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+// gels, full rank least squares; a zero diagonal element of the triangular
+// factor is reported through info
+
+template <typename T>
+int64_t gels_strided_scratchpad(sycl::queue &q, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb, int64_t batch_size) {
+    return oneapi::mkl::lapack::gels_batch_scratchpad_size<T>(q, convert(trans), m, n, nrhs, lda, stridea,
+                        ldb, strideb, batch_size) * sizeof(T);
+}
+
+template <typename T>
+void gels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs, T *a,
+                int64_t lda, int64_t stridea, T *b, int64_t ldb, int64_t strideb, int *info, int64_t batch_size,
+                void *scratch, int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, 0, batch_size, false);
+    auto status = lapack_info_call<T>(q, std::min(m, n), batch_view(a, stridea), lda, info, batch_size, [&] {
+        return oneapi::mkl::lapack::gels_batch(q, convert(trans), m, n, nrhs, a, lda, stridea, b, ldb, strideb,
+                    batch_size, s.scratchpad, s.scratchpad_size);
+    });
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+template <typename T>
+int64_t gels_group_scratchpad(sycl::queue &q, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                int64_t lda, int64_t ldb, int64_t batch_size) {
+    auto t = convert(trans);
+    return oneapi::mkl::lapack::gels_batch_scratchpad_size<T>(q, &t, &m, &n, &nrhs, &lda, &ldb, 1,
+                        &batch_size) * sizeof(T);
+}
+
+template <typename T>
+void gels_group(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs, T **a,
+                int64_t lda, T **b, int64_t ldb, int *info, int64_t batch_size, void *scratch,
+                int64_t scratch_bytes) {
+    auto &q = device_queue->val;
+    auto s = split_scratch<T>(scratch, scratch_bytes, 0, batch_size, false);
+    auto t = convert(trans);
+    auto status = lapack_info_call<T>(q, std::min(m, n), batch_view(a), lda, info, batch_size, [&] {
+        return oneapi::mkl::lapack::gels_batch(q, &t, &m, &n, &nrhs, a, &lda, b, &ldb, 1, &batch_size,
+                    s.scratchpad, s.scratchpad_size);
+    });
+    __FORCE_MKL_FLUSH__(device_queue, status);
+}
+
+extern "C" int64_t onemklSgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size) {
+    return getrf_strided_scratchpad<float>(device_queue->val, n, lda, stridea, pivot != 0, batch_size);
+}
+extern "C" void onemklSgetrf_strided(syclQueue_t device_queue, int64_t n, float *a, int64_t lda,
+                int64_t stridea, int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getrf_strided(device_queue, n, as_sycl(a), lda, stridea, ipiv, stridep, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size) {
+    return getrf_strided_scratchpad<double>(device_queue->val, n, lda, stridea, pivot != 0, batch_size);
+}
+extern "C" void onemklDgetrf_strided(syclQueue_t device_queue, int64_t n, double *a, int64_t lda,
+                int64_t stridea, int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getrf_strided(device_queue, n, as_sycl(a), lda, stridea, ipiv, stridep, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size) {
+    return getrf_strided_scratchpad<std::complex<float>>(device_queue->val, n, lda, stridea, pivot != 0, batch_size);
+}
+extern "C" void onemklCgetrf_strided(syclQueue_t device_queue, int64_t n, float _Complex *a, int64_t lda,
+                int64_t stridea, int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getrf_strided(device_queue, n, as_sycl(a), lda, stridea, ipiv, stridep, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size) {
+    return getrf_strided_scratchpad<std::complex<double>>(device_queue->val, n, lda, stridea, pivot != 0, batch_size);
+}
+extern "C" void onemklZgetrf_strided(syclQueue_t device_queue, int64_t n, double _Complex *a, int64_t lda,
+                int64_t stridea, int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getrf_strided(device_queue, n, as_sycl(a), lda, stridea, ipiv, stridep, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int pivot, int64_t batch_size) {
+    return getrf_group_scratchpad<float>(device_queue->val, n, lda, pivot != 0, batch_size);
+}
+extern "C" void onemklSgetrf_batch(syclQueue_t device_queue, int64_t n, float **a, int64_t lda, int *ipiv,
+                int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrf_group(device_queue, n, reinterpret_cast<float **>(a), lda, ipiv, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int pivot, int64_t batch_size) {
+    return getrf_group_scratchpad<double>(device_queue->val, n, lda, pivot != 0, batch_size);
+}
+extern "C" void onemklDgetrf_batch(syclQueue_t device_queue, int64_t n, double **a, int64_t lda, int *ipiv,
+                int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrf_group(device_queue, n, reinterpret_cast<double **>(a), lda, ipiv, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int pivot, int64_t batch_size) {
+    return getrf_group_scratchpad<std::complex<float>>(device_queue->val, n, lda, pivot != 0, batch_size);
+}
+extern "C" void onemklCgetrf_batch(syclQueue_t device_queue, int64_t n, float _Complex **a, int64_t lda,
+                int *ipiv, int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrf_group(device_queue, n, reinterpret_cast<std::complex<float> **>(a), lda, ipiv, info,
+                batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int pivot, int64_t batch_size) {
+    return getrf_group_scratchpad<std::complex<double>>(device_queue->val, n, lda, pivot != 0, batch_size);
+}
+extern "C" void onemklZgetrf_batch(syclQueue_t device_queue, int64_t n, double _Complex **a, int64_t lda,
+                int *ipiv, int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrf_group(device_queue, n, reinterpret_cast<std::complex<double> **>(a), lda, ipiv, info,
+                batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size) {
+    return getrs_strided_scratchpad<float>(device_queue->val, trans, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklSgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                float *a, int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep, float *b,
+                int64_t ldb, int64_t strideb, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrs_strided(device_queue, trans, n, nrhs, as_sycl(a), lda, stridea, ipiv, stridep, as_sycl(b), ldb,
+                strideb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size) {
+    return getrs_strided_scratchpad<double>(device_queue->val, trans, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklDgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                double *a, int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep, double *b,
+                int64_t ldb, int64_t strideb, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrs_strided(device_queue, trans, n, nrhs, as_sycl(a), lda, stridea, ipiv, stridep, as_sycl(b), ldb,
+                strideb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size) {
+    return getrs_strided_scratchpad<std::complex<float>>(device_queue->val, trans, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklCgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                float _Complex *a, int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep,
+                float _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getrs_strided(device_queue, trans, n, nrhs, as_sycl(a), lda, stridea, ipiv, stridep, as_sycl(b), ldb,
+                strideb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size) {
+    return getrs_strided_scratchpad<std::complex<double>>(device_queue->val, trans, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklZgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                double _Complex *a, int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep,
+                double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getrs_strided(device_queue, trans, n, nrhs, as_sycl(a), lda, stridea, ipiv, stridep, as_sycl(b), ldb,
+                strideb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return getrs_group_scratchpad<float>(device_queue->val, trans, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklSgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                float **a, int64_t lda, const int *ipiv, float **b, int64_t ldb, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    getrs_group(device_queue, trans, n, nrhs, reinterpret_cast<float **>(a), lda, ipiv,
+                reinterpret_cast<float **>(b), ldb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return getrs_group_scratchpad<double>(device_queue->val, trans, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklDgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                double **a, int64_t lda, const int *ipiv, double **b, int64_t ldb, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    getrs_group(device_queue, trans, n, nrhs, reinterpret_cast<double **>(a), lda, ipiv,
+                reinterpret_cast<double **>(b), ldb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return getrs_group_scratchpad<std::complex<float>>(device_queue->val, trans, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklCgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                float _Complex **a, int64_t lda, const int *ipiv, float _Complex **b, int64_t ldb,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrs_group(device_queue, trans, n, nrhs, reinterpret_cast<std::complex<float> **>(a), lda, ipiv,
+                reinterpret_cast<std::complex<float> **>(b), ldb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return getrs_group_scratchpad<std::complex<double>>(device_queue->val, trans, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklZgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                double _Complex **a, int64_t lda, const int *ipiv, double _Complex **b, int64_t ldb,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    getrs_group(device_queue, trans, n, nrhs, reinterpret_cast<std::complex<double> **>(a), lda, ipiv,
+                reinterpret_cast<std::complex<double> **>(b), ldb, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size) {
+    return getri_group_scratchpad<float>(device_queue->val, n, ldc, batch_size);
+}
+extern "C" void onemklSgetri_batch(syclQueue_t device_queue, int64_t n, float **a, int64_t lda,
+                const int *ipiv, float **c, int64_t ldc, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getri_group(device_queue, n, reinterpret_cast<float **>(a), lda, ipiv, reinterpret_cast<float **>(c),
+                ldc, info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size) {
+    return getri_group_scratchpad<double>(device_queue->val, n, ldc, batch_size);
+}
+extern "C" void onemklDgetri_batch(syclQueue_t device_queue, int64_t n, double **a, int64_t lda,
+                const int *ipiv, double **c, int64_t ldc, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    getri_group(device_queue, n, reinterpret_cast<double **>(a), lda, ipiv,
+                reinterpret_cast<double **>(c), ldc, info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size) {
+    return getri_group_scratchpad<std::complex<float>>(device_queue->val, n, ldc, batch_size);
+}
+extern "C" void onemklCgetri_batch(syclQueue_t device_queue, int64_t n, float _Complex **a, int64_t lda,
+                const int *ipiv, float _Complex **c, int64_t ldc, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    getri_group(device_queue, n, reinterpret_cast<std::complex<float> **>(a), lda, ipiv,
+                reinterpret_cast<std::complex<float> **>(c), ldc, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size) {
+    return getri_group_scratchpad<std::complex<double>>(device_queue->val, n, ldc, batch_size);
+}
+extern "C" void onemklZgetri_batch(syclQueue_t device_queue, int64_t n, double _Complex **a, int64_t lda,
+                const int *ipiv, double _Complex **c, int64_t ldc, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    getri_group(device_queue, n, reinterpret_cast<std::complex<double> **>(a), lda, ipiv,
+                reinterpret_cast<std::complex<double> **>(c), ldc, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t stridea, int64_t stridet, int64_t batch_size) {
+    return geqrf_strided_scratchpad<float>(device_queue->val, m, n, lda, stridea, stridet, batch_size);
+}
+extern "C" void onemklSgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, float *a, int64_t lda,
+                int64_t stridea, float *tau, int64_t stridet, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    geqrf_strided(device_queue, m, n, as_sycl(a), lda, stridea, as_sycl(tau), stridet, batch_size,
+                scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t stridea, int64_t stridet, int64_t batch_size) {
+    return geqrf_strided_scratchpad<double>(device_queue->val, m, n, lda, stridea, stridet, batch_size);
+}
+extern "C" void onemklDgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, double *a, int64_t lda,
+                int64_t stridea, double *tau, int64_t stridet, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    geqrf_strided(device_queue, m, n, as_sycl(a), lda, stridea, as_sycl(tau), stridet, batch_size,
+                scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t stridea, int64_t stridet, int64_t batch_size) {
+    return geqrf_strided_scratchpad<std::complex<float>>(device_queue->val, m, n, lda, stridea, stridet, batch_size);
+}
+extern "C" void onemklCgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex *a,
+                int64_t lda, int64_t stridea, float _Complex *tau, int64_t stridet, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    geqrf_strided(device_queue, m, n, as_sycl(a), lda, stridea, as_sycl(tau), stridet, batch_size,
+                scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t stridea, int64_t stridet, int64_t batch_size) {
+    return geqrf_strided_scratchpad<std::complex<double>>(device_queue->val, m, n, lda, stridea, stridet, batch_size);
+}
+extern "C" void onemklZgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex *a,
+                int64_t lda, int64_t stridea, double _Complex *tau, int64_t stridet, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    geqrf_strided(device_queue, m, n, as_sycl(a), lda, stridea, as_sycl(tau), stridet, batch_size,
+                scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t batch_size) {
+    return geqrf_group_scratchpad<float>(device_queue->val, m, n, lda, batch_size);
+}
+extern "C" void onemklSgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, float **a, int64_t lda,
+                float **tau, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    geqrf_group(device_queue, m, n, reinterpret_cast<float **>(a), lda, reinterpret_cast<float **>(tau),
+                batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t batch_size) {
+    return geqrf_group_scratchpad<double>(device_queue->val, m, n, lda, batch_size);
+}
+extern "C" void onemklDgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, double **a, int64_t lda,
+                double **tau, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    geqrf_group(device_queue, m, n, reinterpret_cast<double **>(a), lda,
+                reinterpret_cast<double **>(tau), batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t batch_size) {
+    return geqrf_group_scratchpad<std::complex<float>>(device_queue->val, m, n, lda, batch_size);
+}
+extern "C" void onemklCgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex **a,
+                int64_t lda, float _Complex **tau, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    geqrf_group(device_queue, m, n, reinterpret_cast<std::complex<float> **>(a), lda,
+                reinterpret_cast<std::complex<float> **>(tau), batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n,
+                int64_t lda, int64_t batch_size) {
+    return geqrf_group_scratchpad<std::complex<double>>(device_queue->val, m, n, lda, batch_size);
+}
+extern "C" void onemklZgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex **a,
+                int64_t lda, double _Complex **tau, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    geqrf_group(device_queue, m, n, reinterpret_cast<std::complex<double> **>(a), lda,
+                reinterpret_cast<std::complex<double> **>(tau), batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb,
+                int64_t strideb, int64_t batch_size) {
+    return gels_strided_scratchpad<float>(device_queue->val, trans, m, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklSgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, float *a, int64_t lda, int64_t stridea, float *b, int64_t ldb, int64_t strideb,
+                int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    gels_strided(device_queue, trans, m, n, nrhs, as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb,
+                info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb,
+                int64_t strideb, int64_t batch_size) {
+    return gels_strided_scratchpad<double>(device_queue->val, trans, m, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklDgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, double *a, int64_t lda, int64_t stridea, double *b, int64_t ldb,
+                int64_t strideb, int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    gels_strided(device_queue, trans, m, n, nrhs, as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb,
+                info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb,
+                int64_t strideb, int64_t batch_size) {
+    return gels_strided_scratchpad<std::complex<float>>(device_queue->val, trans, m, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklCgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, float _Complex *a, int64_t lda, int64_t stridea, float _Complex *b, int64_t ldb,
+                int64_t strideb, int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    gels_strided(device_queue, trans, m, n, nrhs, as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb,
+                info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb,
+                int64_t strideb, int64_t batch_size) {
+    return gels_strided_scratchpad<std::complex<double>>(device_queue->val, trans, m, n, nrhs, lda, stridea, ldb, strideb, batch_size);
+}
+extern "C" void onemklZgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, double _Complex *a, int64_t lda, int64_t stridea, double _Complex *b,
+                int64_t ldb, int64_t strideb, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes) {
+    gels_strided(device_queue, trans, m, n, nrhs, as_sycl(a), lda, stridea, as_sycl(b), ldb, strideb,
+                info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklSgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return gels_group_scratchpad<float>(device_queue->val, trans, m, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklSgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, float **a, int64_t lda, float **b, int64_t ldb, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    gels_group(device_queue, trans, m, n, nrhs, reinterpret_cast<float **>(a), lda,
+                reinterpret_cast<float **>(b), ldb, info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklDgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return gels_group_scratchpad<double>(device_queue->val, trans, m, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklDgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, double **a, int64_t lda, double **b, int64_t ldb, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes) {
+    gels_group(device_queue, trans, m, n, nrhs, reinterpret_cast<double **>(a), lda,
+                reinterpret_cast<double **>(b), ldb, info, batch_size, scratchpad, scratchpad_bytes);
+}
+
+extern "C" int64_t onemklCgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return gels_group_scratchpad<std::complex<float>>(device_queue->val, trans, m, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklCgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, float _Complex **a, int64_t lda, float _Complex **b, int64_t ldb, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    gels_group(device_queue, trans, m, n, nrhs, reinterpret_cast<std::complex<float> **>(a), lda,
+                reinterpret_cast<std::complex<float> **>(b), ldb, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklZgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans,
+                int64_t m, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size) {
+    return gels_group_scratchpad<std::complex<double>>(device_queue->val, trans, m, n, nrhs, lda, ldb, batch_size);
+}
+extern "C" void onemklZgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                int64_t nrhs, double _Complex **a, int64_t lda, double _Complex **b, int64_t ldb, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes) {
+    gels_group(device_queue, trans, m, n, nrhs, reinterpret_cast<std::complex<double> **>(a), lda,
+                reinterpret_cast<std::complex<double> **>(b), ldb, info, batch_size, scratchpad,
+                scratchpad_bytes);
+}
+
+extern "C" int64_t onemklStrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva) {
+    return trtri_scratchpad<float>(device_queue->val, uplo, diag, n, ldinva);
+}
+extern "C" void onemklStrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float *a, int64_t lda, float *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes) {
+    trtri(device_queue, uplo, diag, n, a, lda, inva, ldinva, scratchpad, scratchpad_bytes);
+}
+
+extern "C" void onemklStrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float *a, int64_t lda, int64_t stridea, float *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size) {
+    trtri_strided(device_queue, uplo, diag, n, a, lda, stridea, inva, ldinva, strideinva,
+                batch_size);
+}
+
+extern "C" void onemklStrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float **a, int64_t lda, float **inva, int64_t ldinva, int64_t batch_size) {
+    trtri_group(device_queue, uplo, diag, n, reinterpret_cast<const float **>(a), lda,
+                reinterpret_cast<float **>(inva), ldinva, batch_size);
+}
+
+extern "C" int64_t onemklDtrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva) {
+    return trtri_scratchpad<double>(device_queue->val, uplo, diag, n, ldinva);
+}
+extern "C" void onemklDtrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double *a, int64_t lda, double *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes) {
+    trtri(device_queue, uplo, diag, n, a, lda, inva, ldinva, scratchpad, scratchpad_bytes);
+}
+
+extern "C" void onemklDtrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double *a, int64_t lda, int64_t stridea, double *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size) {
+    trtri_strided(device_queue, uplo, diag, n, a, lda, stridea, inva, ldinva, strideinva,
+                batch_size);
+}
+
+extern "C" void onemklDtrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double **a, int64_t lda, double **inva, int64_t ldinva, int64_t batch_size) {
+    trtri_group(device_queue, uplo, diag, n, reinterpret_cast<const double **>(a), lda,
+                reinterpret_cast<double **>(inva), ldinva, batch_size);
+}
+
+extern "C" int64_t onemklCtrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva) {
+    return trtri_scratchpad<std::complex<float>>(device_queue->val, uplo, diag, n, ldinva);
+}
+extern "C" void onemklCtrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float _Complex *a, int64_t lda, float _Complex *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes) {
+    trtri(device_queue, uplo, diag, n, as_sycl(a), lda, as_sycl(inva), ldinva, scratchpad, scratchpad_bytes);
+}
+
+extern "C" void onemklCtrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float _Complex *a, int64_t lda, int64_t stridea, float _Complex *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size) {
+    trtri_strided(device_queue, uplo, diag, n, as_sycl(a), lda, stridea, as_sycl(inva), ldinva, strideinva,
+                batch_size);
+}
+
+extern "C" void onemklCtrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float _Complex **a, int64_t lda, float _Complex **inva, int64_t ldinva, int64_t batch_size) {
+    trtri_group(device_queue, uplo, diag, n, reinterpret_cast<const std::complex<float> **>(a), lda,
+                reinterpret_cast<std::complex<float> **>(inva), ldinva, batch_size);
+}
+
+extern "C" int64_t onemklZtrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva) {
+    return trtri_scratchpad<std::complex<double>>(device_queue->val, uplo, diag, n, ldinva);
+}
+extern "C" void onemklZtrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double _Complex *a, int64_t lda, double _Complex *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes) {
+    trtri(device_queue, uplo, diag, n, as_sycl(a), lda, as_sycl(inva), ldinva, scratchpad, scratchpad_bytes);
+}
+
+extern "C" void onemklZtrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double _Complex *a, int64_t lda, int64_t stridea, double _Complex *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size) {
+    trtri_strided(device_queue, uplo, diag, n, as_sycl(a), lda, stridea, as_sycl(inva), ldinva, strideinva,
+                batch_size);
+}
+
+extern "C" void onemklZtrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double _Complex **a, int64_t lda, double _Complex **inva, int64_t ldinva, int64_t batch_size) {
+    trtri_group(device_queue, uplo, diag, n, reinterpret_cast<const std::complex<double> **>(a), lda,
+                reinterpret_cast<std::complex<double> **>(inva), ldinva, batch_size);
+}
+
+// Warm-up: runs routines once on a 1x1 problem so that the oneMKL kernels
+// they need are JIT compiled before the first real call. Names are the BLAS
+// ones with their precision prefix (sgemm, zaxpy, ...), "all" expands to
+// every routine below in s, d, c and z. Double precision routines are skipped
+// on devices without fp64 (half on those without fp16). A list is run once
+// per context.
+static const char *warmup_routines[] = {"axpy", "scal", "copy", "swap", "dot", "asum", "nrm2", "iamax",
+                "gemv", "ger", "trsv", "gemm", "syrk", "trsm", "trmm"};
+
+template <typename T>
+bool warmup_routine(sycl::queue &q, const std::string &routine, T *a, T *b, T *c, void *result) {
+    namespace blas = oneapi::mkl::blas::column_major;
+    using R = typename onemkl_kernels::real_of<T>::type;
+    constexpr bool is_complex = !std::is_same_v<T, R>;
+    const auto nontrans = oneapi::mkl::transpose::nontrans;
+    const auto lower = oneapi::mkl::uplo::lower;
+    const auto unit = oneapi::mkl::diag::unit;
+    const T one = T(1);
+    sycl::event status;
+    if (routine == "axpy") {
+        status = blas::axpy(q, 1, one, a, 1, b, 1);
+    } else if (routine == "scal") {
+        status = blas::scal(q, 1, one, a, 1);
+    } else if (routine == "copy") {
+        status = blas::copy(q, 1, a, 1, b, 1);
+    } else if (routine == "swap") {
+        status = blas::swap(q, 1, a, 1, b, 1);
+    } else if (routine == "dot") {
+        if constexpr (is_complex) {
+            status = blas::dotc(q, 1, a, 1, b, 1, static_cast<T *>(result));
+        } else {
+            status = blas::dot(q, 1, a, 1, b, 1, static_cast<T *>(result));
+        }
+    } else if (routine == "asum") {
+        status = blas::asum(q, 1, a, 1, static_cast<R *>(result));
+    } else if (routine == "nrm2") {
+        status = blas::nrm2(q, 1, a, 1, static_cast<R *>(result));
+    } else if (routine == "iamax") {
+        status = blas::iamax(q, 1, a, 1, static_cast<int64_t *>(result));
+    } else if (routine == "gemv") {
+        status = blas::gemv(q, nontrans, 1, 1, one, a, 1, b, 1, one, c, 1);
+    } else if (routine == "ger") {
+        if constexpr (is_complex) {
+            status = blas::geru(q, 1, 1, one, a, 1, b, 1, c, 1);
+        } else {
+            status = blas::ger(q, 1, 1, one, a, 1, b, 1, c, 1);
+        }
+    } else if (routine == "trsv") {
+        status = blas::trsv(q, lower, nontrans, unit, 1, a, 1, b, 1);
+    } else if (routine == "gemm") {
+        status = blas::gemm(q, nontrans, nontrans, 1, 1, 1, one, a, 1, b, 1, one, c, 1);
+    } else if (routine == "syrk") {
+        status = blas::syrk(q, lower, nontrans, 1, 1, one, a, 1, one, c, 1);
+    } else if (routine == "trsm") {
+        status = blas::trsm(q, oneapi::mkl::side::left, lower, nontrans, unit, 1, 1, one, a, 1, c, 1);
+    } else if (routine == "trmm") {
+        status = blas::trmm(q, oneapi::mkl::side::left, lower, nontrans, unit, 1, 1, one, a, 1, c, 1);
+    } else {
+        return false;
+    }
+    status.wait();
+    return true;
+}
+
+static bool warmup_one(sycl::queue &q, const std::string &name, char *buffer) {
+    if (name.size() < 2) {
+        return false;
+    }
+    // precisions the device has no support for are skipped
+    auto device = q.get_device();
+    if (((name[0] == 'd' || name[0] == 'z') && !device.has(sycl::aspect::fp64))
+        || (name[0] == 'h' && !device.has(sycl::aspect::fp16))) {
+        return false;
+    }
+    // three operands and a result, each big enough for a double complex
+    auto operand = [&](int i) { return buffer + 16 * i; };
+    std::string routine = name.substr(1);
+    switch (name[0]) {
+    case 's':
+        return warmup_routine(q, routine, (float *)operand(0), (float *)operand(1), (float *)operand(2),
+                    operand(3));
+    case 'd':
+        return warmup_routine(q, routine, (double *)operand(0), (double *)operand(1), (double *)operand(2),
+                    operand(3));
+    case 'c':
+        return warmup_routine(q, routine, (std::complex<float> *)operand(0),
+                    (std::complex<float> *)operand(1), (std::complex<float> *)operand(2), operand(3));
+    case 'z':
+        return warmup_routine(q, routine, (std::complex<double> *)operand(0),
+                    (std::complex<double> *)operand(1), (std::complex<double> *)operand(2), operand(3));
+    case 'h':
+        return routine == "gemm" && warmup_routine(q, routine, (sycl::half *)operand(0),
+                    (sycl::half *)operand(1), (sycl::half *)operand(2), operand(3));
+    }
+    return false;
+}
+
+extern "C" int onemklWarmup(syclQueue_t device_queue, const char *routines, double *milliseconds) {
+    static std::mutex warmup_mutex;
+    static std::unordered_map<sycl::context, std::set<std::string>> warmed_up;
+
+    auto &q = device_queue->val;
+    *milliseconds = 0;
+    {
+        std::lock_guard<std::mutex> lock(warmup_mutex);
+        if (!warmed_up[q.get_context()].insert(routines).second) {
+            return 0;
+        }
+    }
+
+    std::vector<std::string> names;
+    std::string list(routines);
+    for (size_t begin = 0, end; begin < list.size(); begin = end + 1) {
+        end = list.find_first_of(", ", begin);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        std::string name = list.substr(begin, end - begin);
+        if (name == "all") {
+            for (char precision : {'s', 'd', 'c', 'z'}) {
+                for (auto routine : warmup_routines) {
+                    names.push_back(precision + std::string(routine));
+                }
+            }
+        } else if (!name.empty()) {
+            names.push_back(name);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    char *buffer = sycl::malloc_device<char>(64, q);
+    q.memset(buffer, 0, 64).wait();
+    int count = 0;
+    try {
+        for (auto &name : names) {
+            count += warmup_one(q, name, buffer);
+        }
+    } catch (...) {
+        sycl::free(buffer, q);
+        throw;
+    }
+    sycl::free(buffer, q);
+    *milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return count;
 }
 
 extern "C" void onemklDestroy() {
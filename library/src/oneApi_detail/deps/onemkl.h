@@ -13,12 +13,21 @@ typedef struct syclContext_st *syclContext_t;
 typedef struct syclQueue_st *syclQueue_t;
 typedef struct syclEvent_st *syclEvent_t;
 
-// Indicate backend used for HIP and SYCL
+// Indicate backend used for HIP and SYCL, selected per handle from the
+// backend of its stream
 typedef enum hipBlasBackend{
     level0, // default
     opencl
 };
-extern hipBlasBackend hipblas_backend;
+
+// Submissions are flushed into the native queue in batches of up to
+// syclQueue_st::flush_batch per queue (1, the default, flushes every call).
+// onemklFlush pushes out whatever is still pending on a queue, it is called at
+// the synchronization points of the library.
+void onemklFlush(syclQueue_t device_queue);
+// Flushes, or counts towards the next flush, work submitted to device_queue
+// outside of the onemkl* wrappers
+void onemklSubmitted(syclQueue_t device_queue, syclEvent_t event);
 
 typedef enum
 {
@@ -72,38 +81,266 @@ void onemklCasum(syclQueue_t device_queue, int64_t n,
 void onemklZasum(syclQueue_t device_queue, int64_t n,
                 const double _Complex *x, int64_t incx, double *result);
 
-void onemklHaxpy(syclQueue_t device_queue, int64_t n, uint16_t alpha, const short *x,
+void onemklHaxpy(syclQueue_t device_queue, int64_t n, const uint16_t *alpha, const short *x,
                 int64_t incx, short *y, int64_t incy);
-void onemklSaxpy(syclQueue_t device_queue, int64_t n, float alpha, const float *x,
+void onemklSaxpy(syclQueue_t device_queue, int64_t n, const float *alpha, const float *x,
                 int64_t incx, float *y, int64_t incy);
-void onemklDaxpy(syclQueue_t device_queue, int64_t n, double alpha, const double *x,
+void onemklDaxpy(syclQueue_t device_queue, int64_t n, const double *alpha, const double *x,
                 int64_t incx, double *y, int64_t incy);
-void onemklCaxpy(syclQueue_t device_queue, int64_t n, float _Complex alpha,
+void onemklCaxpy(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
                 const float _Complex *x, int64_t incx, float _Complex *y, int64_t incy);
-void onemklZaxpy(syclQueue_t device_queue, int64_t n, double _Complex alpha,
+void onemklZaxpy(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
                 const double _Complex *x, int64_t incx, double _Complex *y, int64_t incy);
 
-void onemklSaxpy_strided(syclQueue_t device_queue, int64_t n, float alpha, const float *x,
+void onemklSaxpy_strided(syclQueue_t device_queue, int64_t n, const float *alpha, const float *x,
                 int64_t incx, int64_t stridex, float *y, int64_t incy, int64_t stridey, int64_t batch_size);
-void onemklDaxpy_strided(syclQueue_t device_queue, int64_t n, double alpha, const double *x,
+void onemklDaxpy_strided(syclQueue_t device_queue, int64_t n, const double *alpha, const double *x,
                 int64_t incx, int64_t stridex, double *y, int64_t incy, int64_t stridey, int64_t batch_size);
-void onemklCaxpy_strided(syclQueue_t device_queue, int64_t n, float _Complex alpha,const float _Complex *x,
+void onemklCaxpy_strided(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,const float _Complex *x,
                 int64_t incx, int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
-void onemklZaxpy_strided(syclQueue_t device_queue, int64_t n, double _Complex alpha, const double _Complex *x,
+void onemklZaxpy_strided(syclQueue_t device_queue, int64_t n, const double _Complex *alpha, const double _Complex *x,
                 int64_t incx, int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
 
+// Batched Level-1: "_batch" takes device arrays of vector pointers, "_strided"
+// a base pointer and a stride. Reductions write batch_size results to a device
+// array.
+void onemklSscal_batch(syclQueue_t device_queue, int64_t n, const float *alpha, float **x, int64_t incx,
+                int64_t batch_size);
+void onemklDscal_batch(syclQueue_t device_queue, int64_t n, const double *alpha, double **x, int64_t incx,
+                int64_t batch_size);
+void onemklCscal_batch(syclQueue_t device_queue, int64_t n, const float _Complex *alpha, float _Complex **x,
+                int64_t incx, int64_t batch_size);
+void onemklZscal_batch(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
+                double _Complex **x, int64_t incx, int64_t batch_size);
+void onemklCsscal_batch(syclQueue_t device_queue, int64_t n, const float *alpha, float _Complex **x,
+                int64_t incx, int64_t batch_size);
+void onemklZdscal_batch(syclQueue_t device_queue, int64_t n, const double *alpha, double _Complex **x,
+                int64_t incx, int64_t batch_size);
+void onemklHaxpy_batch(syclQueue_t device_queue, int64_t n, const uint16_t *alpha, const short **x,
+                int64_t incx, short **y, int64_t incy, int64_t batch_size);
+void onemklSaxpy_batch(syclQueue_t device_queue, int64_t n, const float *alpha, const float **x,
+                int64_t incx, float **y, int64_t incy, int64_t batch_size);
+void onemklDaxpy_batch(syclQueue_t device_queue, int64_t n, const double *alpha, const double **x,
+                int64_t incx, double **y, int64_t incy, int64_t batch_size);
+void onemklCaxpy_batch(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
+                const float _Complex **x, int64_t incx, float _Complex **y, int64_t incy, int64_t batch_size);
+void onemklZaxpy_batch(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
+                const double _Complex **x, int64_t incx, double _Complex **y, int64_t incy,
+                int64_t batch_size);
+void onemklScopy_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx, float **y,
+                int64_t incy, int64_t batch_size);
+void onemklDcopy_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx, double **y,
+                int64_t incy, int64_t batch_size);
+void onemklCcopy_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, int64_t batch_size);
+void onemklZcopy_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, int64_t batch_size);
+void onemklSswap_batch(syclQueue_t device_queue, int64_t n, float **x, int64_t incx, float **y, int64_t incy,
+                int64_t batch_size);
+void onemklDswap_batch(syclQueue_t device_queue, int64_t n, double **x, int64_t incx, double **y,
+                int64_t incy, int64_t batch_size);
+void onemklCswap_batch(syclQueue_t device_queue, int64_t n, float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, int64_t batch_size);
+void onemklZswap_batch(syclQueue_t device_queue, int64_t n, double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, int64_t batch_size);
+void onemklSdot_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx, const float **y,
+                int64_t incy, int64_t batch_size, float *result);
+void onemklDdot_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx, const double **y,
+                int64_t incy, int64_t batch_size, double *result);
+void onemklCdotu_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                const float _Complex **y, int64_t incy, int64_t batch_size, float _Complex *result);
+void onemklCdotc_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                const float _Complex **y, int64_t incy, int64_t batch_size, float _Complex *result);
+void onemklZdotu_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                const double _Complex **y, int64_t incy, int64_t batch_size, double _Complex *result);
+void onemklZdotc_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                const double _Complex **y, int64_t incy, int64_t batch_size, double _Complex *result);
+void onemklSasum_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, float *result);
+void onemklDasum_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, double *result);
+void onemklCasum_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                int64_t batch_size, float *result);
+void onemklZasum_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                int64_t batch_size, double *result);
+void onemklSnrm2_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, float *result);
+void onemklDnrm2_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, double *result);
+void onemklCnrm2_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                int64_t batch_size, float *result);
+void onemklZnrm2_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                int64_t batch_size, double *result);
+void onemklSamax_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklSamax_batch_64(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklDamax_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklDamax_batch_64(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklCamax_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklCamax_batch_64(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklZamax_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklZamax_batch_64(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklSamin_batch(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklSamin_batch_64(syclQueue_t device_queue, int64_t n, const float **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklDamin_batch(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklDamin_batch_64(syclQueue_t device_queue, int64_t n, const double **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklCamin_batch(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklCamin_batch_64(syclQueue_t device_queue, int64_t n, const float _Complex **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklZamin_batch(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                int64_t batch_size, int *result);
+void onemklZamin_batch_64(syclQueue_t device_queue, int64_t n, const double _Complex **x, int64_t incx,
+                int64_t batch_size, int64_t *result);
+void onemklSrot_batch(syclQueue_t device_queue, int64_t n, float **x, int64_t incx, float **y, int64_t incy,
+                const float *c, const float *s, int64_t batch_size);
+void onemklDrot_batch(syclQueue_t device_queue, int64_t n, double **x, int64_t incx, double **y,
+                int64_t incy, const double *c, const double *s, int64_t batch_size);
+void onemklCrot_batch(syclQueue_t device_queue, int64_t n, float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, const float *c, const float _Complex *s,
+                int64_t batch_size);
+void onemklCsrot_batch(syclQueue_t device_queue, int64_t n, float _Complex **x, int64_t incx,
+                float _Complex **y, int64_t incy, const float *c, const float *s, int64_t batch_size);
+void onemklZrot_batch(syclQueue_t device_queue, int64_t n, double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, const double *c, const double _Complex *s,
+                int64_t batch_size);
+void onemklZdrot_batch(syclQueue_t device_queue, int64_t n, double _Complex **x, int64_t incx,
+                double _Complex **y, int64_t incy, const double *c, const double *s, int64_t batch_size);
+void onemklSscal_strided(syclQueue_t device_queue, int64_t n, const float *alpha, float *x, int64_t incx,
+                int64_t stridex, int64_t batch_size);
+void onemklDscal_strided(syclQueue_t device_queue, int64_t n, const double *alpha, double *x, int64_t incx,
+                int64_t stridex, int64_t batch_size);
+void onemklCscal_strided(syclQueue_t device_queue, int64_t n, const float _Complex *alpha, float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size);
+void onemklZscal_strided(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
+                double _Complex *x, int64_t incx, int64_t stridex, int64_t batch_size);
+void onemklCsscal_strided(syclQueue_t device_queue, int64_t n, const float *alpha, float _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size);
+void onemklZdscal_strided(syclQueue_t device_queue, int64_t n, const double *alpha, double _Complex *x,
+                int64_t incx, int64_t stridex, int64_t batch_size);
+void onemklHaxpy_strided(syclQueue_t device_queue, int64_t n, const uint16_t *alpha, const short *x,
+                int64_t incx, int64_t stridex, short *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklScopy_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                float *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklDcopy_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                double *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklCcopy_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklZcopy_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklSswap_strided(syclQueue_t device_queue, int64_t n, float *x, int64_t incx, int64_t stridex,
+                float *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklDswap_strided(syclQueue_t device_queue, int64_t n, double *x, int64_t incx, int64_t stridex,
+                double *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklCswap_strided(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklZswap_strided(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklSdot_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                const float *y, int64_t incy, int64_t stridey, int64_t batch_size, float *result);
+void onemklDdot_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                const double *y, int64_t incy, int64_t stridey, int64_t batch_size, double *result);
+void onemklCdotu_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, const float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size,
+                float _Complex *result);
+void onemklCdotc_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, const float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size,
+                float _Complex *result);
+void onemklZdotu_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, const double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size,
+                double _Complex *result);
+void onemklZdotc_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, const double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size,
+                double _Complex *result);
+void onemklSasum_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, float *result);
+void onemklDasum_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, double *result);
+void onemklCasum_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, float *result);
+void onemklZasum_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, double *result);
+void onemklSnrm2_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, float *result);
+void onemklDnrm2_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, double *result);
+void onemklCnrm2_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, float *result);
+void onemklZnrm2_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, double *result);
+void onemklSamax_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int *result);
+void onemklSamax_strided_64(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int64_t *result);
+void onemklDamax_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int *result);
+void onemklDamax_strided_64(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int64_t *result);
+void onemklCamax_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result);
+void onemklCamax_strided_64(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result);
+void onemklZamax_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result);
+void onemklZamax_strided_64(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result);
+void onemklSamin_strided(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int *result);
+void onemklSamin_strided_64(syclQueue_t device_queue, int64_t n, const float *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int64_t *result);
+void onemklDamin_strided(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int *result);
+void onemklDamin_strided_64(syclQueue_t device_queue, int64_t n, const double *x, int64_t incx, int64_t stridex,
+                int64_t batch_size, int64_t *result);
+void onemklCamin_strided(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result);
+void onemklCamin_strided_64(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result);
+void onemklZamin_strided(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int *result);
+void onemklZamin_strided_64(syclQueue_t device_queue, int64_t n, const double _Complex *x, int64_t incx,
+                int64_t stridex, int64_t batch_size, int64_t *result);
+void onemklSrot_strided(syclQueue_t device_queue, int64_t n, float *x, int64_t incx, int64_t stridex,
+                float *y, int64_t incy, int64_t stridey, const float *c, const float *s, int64_t batch_size);
+void onemklDrot_strided(syclQueue_t device_queue, int64_t n, double *x, int64_t incx, int64_t stridex,
+                double *y, int64_t incy, int64_t stridey, const double *c, const double *s,
+                int64_t batch_size);
+void onemklCrot_strided(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, const float *c,
+                const float _Complex *s, int64_t batch_size);
+void onemklCsrot_strided(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *y, int64_t incy, int64_t stridey, const float *c,
+                const float *s, int64_t batch_size);
+void onemklZrot_strided(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, const double *c,
+                const double _Complex *s, int64_t batch_size);
+void onemklZdrot_strided(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *y, int64_t incy, int64_t stridey, const double *c,
+                const double *s, int64_t batch_size);
+
 // Level-1: scal oneMKL
-void onemklDscal(syclQueue_t device_queue, int64_t n, double alpha,
+void onemklDscal(syclQueue_t device_queue, int64_t n, const double *alpha,
                 double *x, int64_t incx);
-void onemklSscal(syclQueue_t device_queue, int64_t n, float alpha,
+void onemklSscal(syclQueue_t device_queue, int64_t n, const float *alpha,
                 float *x, int64_t incx);
-void onemklCscal(syclQueue_t device_queue, int64_t n, float _Complex alpha,
+void onemklCscal(syclQueue_t device_queue, int64_t n, const float _Complex *alpha,
                 float _Complex *x, int64_t incx);
-void onemklCsscal(syclQueue_t device_queue, int64_t n, float alpha,
+void onemklCsscal(syclQueue_t device_queue, int64_t n, const float *alpha,
                 float _Complex *x, int64_t incx);
-void onemklZscal(syclQueue_t device_queue, int64_t n, double _Complex alpha,
+void onemklZscal(syclQueue_t device_queue, int64_t n, const double _Complex *alpha,
                 double _Complex *x, int64_t incx);
-void onemklZdscal(syclQueue_t device_queue, int64_t n, double alpha,
+void onemklZdscal(syclQueue_t device_queue, int64_t n, const double *alpha,
                 double _Complex *x, int64_t incx);
 
 // Supported Level-1: Nrm2
@@ -161,6 +398,8 @@ void onemklZamin(syclQueue_t device_queue, int64_t n, const double _Complex *x,
                  int64_t *result);
 void onemklCamin(syclQueue_t device_queue, int64_t n, const float _Complex *x, int64_t incx,
                  int64_t *result);
+void onemklIndexResultToInt(syclQueue_t device_queue, const int64_t *src, int *dst);
+void onemklIndexResultToInt64(syclQueue_t device_queue, const int64_t *src, int64_t *dst);
 
 void onemklSswap(syclQueue_t device_queue, int64_t n, float *x, int64_t incx,
                 float *y, int64_t incy);
@@ -171,185 +410,341 @@ void onemklCswap(syclQueue_t device_queue, int64_t n, float _Complex *x, int64_t
 void onemklZswap(syclQueue_t device_queue, int64_t n, double _Complex *x, int64_t incx,
                 double _Complex *y, int64_t incy);
 
-void onemklSrot(syclQueue_t device_queue, int n, float* x, int incx, float* y, int incy,
-                const float c, const float s);
-void onemklDrot(syclQueue_t device_queue, int n, double* x, int incx, double* y, int incy,
-                const double c, const double s);
-void onemklCrot(syclQueue_t device_queue, int n, float _Complex* x, int incx, float _Complex* y, int incy,
-                const float c, const float _Complex s);
-void onemklCsrot(syclQueue_t device_queue, int n, float _Complex* x, int incx, float _Complex* y, int incy,
-                const float c, const float s);
-void onemklZrot(syclQueue_t device_queue, int n, double _Complex* x, int incx, double _Complex* y, int incy,
-                const double c, const double _Complex s);
-void onemklZdrot(syclQueue_t device_queue, int n, double _Complex* x, int incx, double _Complex* y, int incy,
-                const double c, const double s);
+void onemklSrot(syclQueue_t device_queue, int64_t n, float* x, int64_t incx, float* y, int64_t incy,
+                const float *c, const float *s);
+void onemklDrot(syclQueue_t device_queue, int64_t n, double* x, int64_t incx, double* y, int64_t incy,
+                const double *c, const double *s);
+void onemklCrot(syclQueue_t device_queue, int64_t n, float _Complex* x, int64_t incx, float _Complex* y, int64_t incy,
+                const float *c, const float _Complex *s);
+void onemklCsrot(syclQueue_t device_queue, int64_t n, float _Complex* x, int64_t incx, float _Complex* y, int64_t incy,
+                const float *c, const float *s);
+void onemklZrot(syclQueue_t device_queue, int64_t n, double _Complex* x, int64_t incx, double _Complex* y, int64_t incy,
+                const double *c, const double _Complex *s);
+void onemklZdrot(syclQueue_t device_queue, int64_t n, double _Complex* x, int64_t incx, double _Complex* y, int64_t incy,
+                const double *c, const double *s);
 
 void onemklSrotg(syclQueue_t device_queue, float* a, float* b, float* c, float* s);
 void onemklDrotg(syclQueue_t device_queue, double* a, double* b, double* c, double* s);
 void onemklCrotg(syclQueue_t device_queue, float _Complex* a, float _Complex* b, float* c, float _Complex* s);
 void onemklZrotg(syclQueue_t device_queue, double _Complex* a, double _Complex* b, double* c, double _Complex* s);
 
+// rotm with HIPBLAS_POINTER_MODE_HOST stages param in 'workspace', a device
+// buffer of 5 elements per problem; it is not used in device pointer mode.
 void onemklSrotm(syclQueue_t device_queue, int64_t n, float *x, int64_t incx,
-                float *y, int64_t incy, float* param);
+                float *y, int64_t incy, const float *param, float *workspace);
 void onemklDrotm(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
-                double *y, int64_t incy, double* param);
+                double *y, int64_t incy, const double *param, double *workspace);
+
+void onemklSrotg_batch(syclQueue_t device_queue, float **a, float **b, float **c, float **s,
+                int64_t batch_size);
+void onemklDrotg_batch(syclQueue_t device_queue, double **a, double **b, double **c, double **s,
+                int64_t batch_size);
+void onemklCrotg_batch(syclQueue_t device_queue, float _Complex **a, float _Complex **b, float **c,
+                float _Complex **s, int64_t batch_size);
+void onemklZrotg_batch(syclQueue_t device_queue, double _Complex **a, double _Complex **b, double **c,
+                double _Complex **s, int64_t batch_size);
+void onemklSrotg_strided(syclQueue_t device_queue, float *a, int64_t stridea, float *b,
+                int64_t strideb, float *c, int64_t stridec, float *s, int64_t strides, int64_t batch_size);
+void onemklDrotg_strided(syclQueue_t device_queue, double *a, int64_t stridea, double *b,
+                int64_t strideb, double *c, int64_t stridec, double *s, int64_t strides, int64_t batch_size);
+void onemklCrotg_strided(syclQueue_t device_queue, float _Complex *a, int64_t stridea,
+                float _Complex *b, int64_t strideb, float *c, int64_t stridec, float _Complex *s,
+                int64_t strides, int64_t batch_size);
+void onemklZrotg_strided(syclQueue_t device_queue, double _Complex *a, int64_t stridea,
+                double _Complex *b, int64_t strideb, double *c, int64_t stridec, double _Complex *s,
+                int64_t strides, int64_t batch_size);
+void onemklSrotm_batch(syclQueue_t device_queue, int64_t n, float **x, int64_t incx, float **y,
+                int64_t incy, const float **param, int64_t batch_size, float *workspace);
+void onemklDrotm_batch(syclQueue_t device_queue, int64_t n, double **x, int64_t incx, double **y,
+                int64_t incy, const double **param, int64_t batch_size, double *workspace);
+void onemklSrotm_strided(syclQueue_t device_queue, int64_t n, float *x, int64_t incx, int64_t stridex,
+                float *y, int64_t incy, int64_t stridey, const float *param, int64_t strideparam,
+                int64_t batch_size, float *workspace);
+void onemklDrotm_strided(syclQueue_t device_queue, int64_t n, double *x, int64_t incx,
+                int64_t stridex, double *y, int64_t incy, int64_t stridey, const double *param,
+                int64_t strideparam, int64_t batch_size, double *workspace);
+void onemklSrotmg(syclQueue_t device_queue, float *d1, float *d2, float *x1, const float *y1,
+                float *param);
+void onemklDrotmg(syclQueue_t device_queue, double *d1, double *d2, double *x1, const double *y1,
+                double *param);
+void onemklSrotmg_batch(syclQueue_t device_queue, float **d1, float **d2, float **x1,
+                const float **y1, float **param, int64_t batch_size);
+void onemklDrotmg_batch(syclQueue_t device_queue, double **d1, double **d2, double **x1,
+                const double **y1, double **param, int64_t batch_size);
+void onemklSrotmg_strided(syclQueue_t device_queue, float *d1, int64_t strided1, float *d2,
+                int64_t strided2, float *x1, int64_t stridex1, const float *y1, int64_t stridey1, float *param,
+                int64_t strideparam, int64_t batch_size);
+void onemklDrotmg_strided(syclQueue_t device_queue, double *d1, int64_t strided1, double *d2,
+                int64_t strided2, double *x1, int64_t stridex1, const double *y1, int64_t stridey1,
+                double *param, int64_t strideparam, int64_t batch_size);
 
 // Level-2
 void onemklSgbmv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                int64_t n, int64_t kl, int64_t ku, float alpha, const float *a,
-                int64_t lda, const float *x, int64_t incx, float beta, float *y,
+                int64_t n, int64_t kl, int64_t ku, const float *alpha, const float *a,
+                int64_t lda, const float *x, int64_t incx, const float *beta, float *y,
                 int64_t incy);
 void onemklDgbmv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                int64_t n, int64_t kl, int64_t ku, double alpha, const double *a,
-                int64_t lda, const double *x, int64_t incx, double beta, double *y,
+                int64_t n, int64_t kl, int64_t ku, const double *alpha, const double *a,
+                int64_t lda, const double *x, int64_t incx, const double *beta, double *y,
                 int64_t incy);
 void onemklCgbmv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                int64_t n, int64_t kl, int64_t ku, float _Complex alpha, const float
+                int64_t n, int64_t kl, int64_t ku, const float _Complex *alpha, const float
                 _Complex *a, int64_t lda, const float _Complex *x, int64_t incx,
-                float _Complex beta, float _Complex *y, int64_t incy);
+                const float _Complex *beta, float _Complex *y, int64_t incy);
 void onemklZgbmv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                int64_t n, int64_t kl, int64_t ku, double _Complex alpha,
+                int64_t n, int64_t kl, int64_t ku, const double _Complex *alpha,
                 const double _Complex *a, int64_t lda, const double _Complex *x,
-                int64_t incx, double _Complex beta, double _Complex *y, int64_t incy);
+                int64_t incx, const double _Complex *beta, double _Complex *y, int64_t incy);
 
 void onemklSgemv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                 int64_t n, float alpha, const float *a, int64_t lda,
-                 const float *x, int64_t incx, float beta, float *y, int64_t incy);
+                 int64_t n, const float *alpha, const float *a, int64_t lda,
+                 const float *x, int64_t incx, const float *beta, float *y, int64_t incy);
 void onemklDgemv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                 int64_t n, double alpha, const double *a, int64_t lda,
-                 const double *x, int64_t incx, double beta, double *y, int64_t incy);
+                 int64_t n, const double *alpha, const double *a, int64_t lda,
+                 const double *x, int64_t incx, const double *beta, double *y, int64_t incy);
 void onemklCgemv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                 int64_t n, float _Complex alpha, const float _Complex *a, int64_t lda,
-                 const float _Complex *x, int64_t incx, float _Complex beta,
+                 int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda,
+                 const float _Complex *x, int64_t incx, const float _Complex *beta,
                  float _Complex *y, int64_t incy);
 void onemklZgemv(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
-                 int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda,
-                 const double _Complex *x, int64_t incx, double _Complex beta,
+                 int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda,
+                 const double _Complex *x, int64_t incx, const double _Complex *beta,
                  double _Complex *y, int64_t incy);
 
-void onemklSger(syclQueue_t device_queue, int64_t m, int64_t n, float alpha,
+void onemklSger(syclQueue_t device_queue, int64_t m, int64_t n, const float *alpha,
                 const float *x, int64_t incx, const float *y, int64_t incy,
                 float *a, int64_t lda);
-void onemklDger(syclQueue_t device_queue, int64_t m, int64_t n, double alpha,
+void onemklDger(syclQueue_t device_queue, int64_t m, int64_t n, const double *alpha,
                 const double *x, int64_t incx, const double *y, int64_t incy,
                 double *a, int64_t lda);
-void onemklCgerc(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex alpha,
+void onemklCgerc(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
                 const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                 float _Complex *a, int64_t lda);
-void onemklCgeru(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex alpha,
+void onemklCgeru(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
                 const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                 float _Complex *a, int64_t lda);
-void onemklZgerc(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex alpha,
+void onemklZgerc(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
                 const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                 double _Complex *a, int64_t lda);
-void onemklZgeru(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex alpha,
+void onemklZgeru(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
                 const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                 double _Complex *a, int64_t lda);
 
 void onemklChbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                int64_t k, float _Complex alpha, const float _Complex *a,
-                int64_t lda, const float _Complex *x, int64_t incx, float _Complex beta,
+                int64_t k, const float _Complex *alpha, const float _Complex *a,
+                int64_t lda, const float _Complex *x, int64_t incx, const float _Complex *beta,
                 float _Complex *y, int64_t incy);
 void onemklZhbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                int64_t k, double _Complex alpha, const double _Complex *a,
-                int64_t lda, const double _Complex *x, int64_t incx, double _Complex beta,
+                int64_t k, const double _Complex *alpha, const double _Complex *a,
+                int64_t lda, const double _Complex *x, int64_t incx, const double _Complex *beta,
                 double _Complex *y, int64_t incy);
 
 void onemklChemv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                float _Complex alpha, const float _Complex *a, int64_t lda,
-                const float _Complex *x, int64_t incx, float _Complex beta,
+                const float _Complex *alpha, const float _Complex *a, int64_t lda,
+                const float _Complex *x, int64_t incx, const float _Complex *beta,
                 float _Complex *y, int64_t incy);
 void onemklZhemv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                double _Complex alpha, const double _Complex *a, int64_t lda,
-                const double _Complex *x, int64_t incx, double _Complex beta,
+                const double _Complex *alpha, const double _Complex *a, int64_t lda,
+                const double _Complex *x, int64_t incx, const double _Complex *beta,
                 double _Complex *y, int64_t incy);
 
-void onemklCher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+void onemklCher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                 const float _Complex *x, int64_t incx, float _Complex *a,
                 int64_t lda);
-void onemklZher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+void onemklZher(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                 const double _Complex *x, int64_t incx, double _Complex *a,
                 int64_t lda);
 
-void onemklCher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+void onemklCher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                 const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy,
                 float _Complex *a, int64_t lda);
-void onemklZher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+void onemklZher2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                 const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy,
                 double _Complex *a, int64_t lda);
 
-void onemklChpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+void onemklChpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                 const float _Complex *a, const float _Complex *x, int64_t incx,
-                float _Complex beta, float _Complex *y, int64_t incy);
-void onemklZhpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+                const float _Complex *beta, float _Complex *y, int64_t incy);
+void onemklZhpmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                 const double _Complex *a, const double _Complex *x, int64_t incx,
-                double _Complex beta, double _Complex *y, int64_t incy);
+                const double _Complex *beta, double _Complex *y, int64_t incy);
 
-void onemklChpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+void onemklChpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                 const float _Complex *x, int64_t incx, float _Complex *a);
-void onemklZhpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+void onemklZhpr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                 const double _Complex *x, int64_t incx, double _Complex *a);
 
-void onemklChpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+void onemklChpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                 const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy, float _Complex *a);
-void onemklZhpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+void onemklZhpr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                 const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy, double _Complex *a);
 
 void onemklSsbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, int64_t k,
-                 float alpha, const float *a, int64_t lda, const float *x,
-                 int64_t incx, float beta, float *y, int64_t incy);
+                 const float *alpha, const float *a, int64_t lda, const float *x,
+                 int64_t incx, const float *beta, float *y, int64_t incy);
 void onemklDsbmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, int64_t k,
-                 double alpha, const double *a, int64_t lda, const double *x,
-                 int64_t incx, double beta, double *y, int64_t incy);
+                 const double *alpha, const double *a, int64_t lda, const double *x,
+                 int64_t incx, const double *beta, double *y, int64_t incy);
 
 void onemklSspmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 float alpha, const float *a, const float *x,
-                 int64_t incx, float beta, float *y, int64_t incy);
+                 const float *alpha, const float *a, const float *x,
+                 int64_t incx, const float *beta, float *y, int64_t incy);
 void onemklDspmv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double alpha, const double *a, const double *x,
-                 int64_t incx, double beta, double *y, int64_t incy);
+                 const double *alpha, const double *a, const double *x,
+                 int64_t incx, const double *beta, double *y, int64_t incy);
 
 void onemklSspr(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 float alpha, const float *x, int64_t incx, float *a);
+                 const float *alpha, const float *x, int64_t incx, float *a);
 void onemklDspr(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double alpha, const double *x, int64_t incx, double *a);
+                 const double *alpha, const double *x, int64_t incx, double *a);
 
 void onemklSspr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 float alpha, const float *x, int64_t incx,
+                 const float *alpha, const float *x, int64_t incx,
                  const float *y, int64_t incy, float *a);
 void onemklDspr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double alpha, const double *x, int64_t incx,
+                 const double *alpha, const double *x, int64_t incx,
                  const double *y, int64_t incy, double *a);
 
-void onemklSsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
-                 const float *a, int64_t lda, const float *x, int64_t incx, float beta,
+void onemklSsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
+                 const float *a, int64_t lda, const float *x, int64_t incx, const float *beta,
                  float *y, int64_t incy);
 void onemklDsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double alpha, const double *a, int64_t lda, const double *x,
-                 int64_t incx, double beta, double *y, int64_t incy);
-void onemklCsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+                 const double *alpha, const double *a, int64_t lda, const double *x,
+                 int64_t incx, const double *beta, double *y, int64_t incy);
+void onemklCsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                  const float _Complex *a, int64_t lda, const float _Complex *x, int64_t incx,
-                 float _Complex beta, float _Complex *y, int64_t incy);
+                 const float _Complex *beta, float _Complex *y, int64_t incy);
 void onemklZsymv(syclQueue_t device_queue, onemklUplo uplo, int64_t n,
-                 double _Complex alpha, const double _Complex *a, int64_t lda, const double _Complex *x,
-                 int64_t incx, double _Complex beta, double _Complex *y, int64_t incy);
-
-void onemklSsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+                 const double _Complex *alpha, const double _Complex *a, int64_t lda, const double _Complex *x,
+                 int64_t incx, const double _Complex *beta, double _Complex *y, int64_t incy);
+
+// Batched Level-2, "_batch" and "_strided" as for Level-1 above
+void onemklSgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float *alpha, const float **a, int64_t lda, const float **x, int64_t incx,
+                const float *beta, float **y, int64_t incy, int64_t batch_size);
+void onemklDgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double *alpha, const double **a, int64_t lda, const double **x, int64_t incx,
+                const double *beta, double **y, int64_t incy, int64_t batch_size);
+void onemklCgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **x,
+                int64_t incx, const float _Complex *beta, float _Complex **y, int64_t incy,
+                int64_t batch_size);
+void onemklZgemv_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                const double _Complex **x, int64_t incx, const double _Complex *beta, double _Complex **y,
+                int64_t incy, int64_t batch_size);
+void onemklSgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *x,
+                int64_t incx, int64_t stridex, const float *beta, float *y, int64_t incy, int64_t stridey,
+                int64_t batch_size);
+void onemklDgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *x,
+                int64_t incx, int64_t stridex, const double *beta, double *y, int64_t incy, int64_t stridey,
+                int64_t batch_size);
+void onemklCgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea,
+                const float _Complex *x, int64_t incx, int64_t stridex, const float _Complex *beta,
+                float _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklZgemv_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n,
+                const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea,
+                const double _Complex *x, int64_t incx, int64_t stridex, const double _Complex *beta,
+                double _Complex *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklSger_batch(syclQueue_t device_queue, int64_t m, int64_t n, const float *alpha, const float **x,
+                int64_t incx, const float **y, int64_t incy, float **a, int64_t lda, int64_t batch_size);
+void onemklDger_batch(syclQueue_t device_queue, int64_t m, int64_t n, const double *alpha, const double **x,
+                int64_t incx, const double **y, int64_t incy, double **a, int64_t lda, int64_t batch_size);
+void onemklCgeru_batch(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
+                const float _Complex **x, int64_t incx, const float _Complex **y, int64_t incy,
+                float _Complex **a, int64_t lda, int64_t batch_size);
+void onemklCgerc_batch(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
+                const float _Complex **x, int64_t incx, const float _Complex **y, int64_t incy,
+                float _Complex **a, int64_t lda, int64_t batch_size);
+void onemklZgeru_batch(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
+                const double _Complex **x, int64_t incx, const double _Complex **y, int64_t incy,
+                double _Complex **a, int64_t lda, int64_t batch_size);
+void onemklZgerc_batch(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
+                const double _Complex **x, int64_t incx, const double _Complex **y, int64_t incy,
+                double _Complex **a, int64_t lda, int64_t batch_size);
+void onemklSger_strided(syclQueue_t device_queue, int64_t m, int64_t n, const float *alpha, const float *x,
+                int64_t incx, int64_t stridex, const float *y, int64_t incy, int64_t stridey, float *a,
+                int64_t lda, int64_t stridea, int64_t batch_size);
+void onemklDger_strided(syclQueue_t device_queue, int64_t m, int64_t n, const double *alpha, const double *x,
+                int64_t incx, int64_t stridex, const double *y, int64_t incy, int64_t stridey, double *a,
+                int64_t lda, int64_t stridea, int64_t batch_size);
+void onemklCgeru_strided(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
+                const float _Complex *x, int64_t incx, int64_t stridex, const float _Complex *y,
+                int64_t incy, int64_t stridey, float _Complex *a, int64_t lda, int64_t stridea,
+                int64_t batch_size);
+void onemklCgerc_strided(syclQueue_t device_queue, int64_t m, int64_t n, const float _Complex *alpha,
+                const float _Complex *x, int64_t incx, int64_t stridex, const float _Complex *y,
+                int64_t incy, int64_t stridey, float _Complex *a, int64_t lda, int64_t stridea,
+                int64_t batch_size);
+void onemklZgeru_strided(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
+                const double _Complex *x, int64_t incx, int64_t stridex, const double _Complex *y,
+                int64_t incy, int64_t stridey, double _Complex *a, int64_t lda, int64_t stridea,
+                int64_t batch_size);
+void onemklZgerc_strided(syclQueue_t device_queue, int64_t m, int64_t n, const double _Complex *alpha,
+                const double _Complex *x, int64_t incx, int64_t stridex, const double _Complex *y,
+                int64_t incy, int64_t stridey, double _Complex *a, int64_t lda, int64_t stridea,
+                int64_t batch_size);
+void onemklSsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
+                const float **a, int64_t lda, const float **x, int64_t incx, const float *beta, float **y,
+                int64_t incy, int64_t batch_size);
+void onemklDsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
+                const double **a, int64_t lda, const double **x, int64_t incx, const double *beta,
+                double **y, int64_t incy, int64_t batch_size);
+void onemklCsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
+                const float _Complex **a, int64_t lda, const float _Complex **x, int64_t incx,
+                const float _Complex *beta, float _Complex **y, int64_t incy, int64_t batch_size);
+void onemklZsymv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
+                const double _Complex **a, int64_t lda, const double _Complex **x, int64_t incx,
+                const double _Complex *beta, double _Complex **y, int64_t incy, int64_t batch_size);
+void onemklChemv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
+                const float _Complex **a, int64_t lda, const float _Complex **x, int64_t incx,
+                const float _Complex *beta, float _Complex **y, int64_t incy, int64_t batch_size);
+void onemklZhemv_batch(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
+                const double _Complex **a, int64_t lda, const double _Complex **x, int64_t incx,
+                const double _Complex *beta, double _Complex **y, int64_t incy, int64_t batch_size);
+void onemklSsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
+                const float *a, int64_t lda, int64_t stridea, const float *x, int64_t incx, int64_t stridex,
+                const float *beta, float *y, int64_t incy, int64_t stridey, int64_t batch_size);
+void onemklDsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
+                const double *a, int64_t lda, int64_t stridea, const double *x, int64_t incx,
+                int64_t stridex, const double *beta, double *y, int64_t incy, int64_t stridey,
+                int64_t batch_size);
+void onemklCsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
+                const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *x, int64_t incx,
+                int64_t stridex, const float _Complex *beta, float _Complex *y, int64_t incy,
+                int64_t stridey, int64_t batch_size);
+void onemklZsymv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
+                const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *x,
+                int64_t incx, int64_t stridex, const double _Complex *beta, double _Complex *y, int64_t incy,
+                int64_t stridey, int64_t batch_size);
+void onemklChemv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
+                const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *x, int64_t incx,
+                int64_t stridex, const float _Complex *beta, float _Complex *y, int64_t incy,
+                int64_t stridey, int64_t batch_size);
+void onemklZhemv_strided(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
+                const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *x,
+                int64_t incx, int64_t stridex, const double _Complex *beta, double _Complex *y, int64_t incy,
+                int64_t stridey, int64_t batch_size);
+
+void onemklSsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                            const float *x, int64_t incx, float *a, int64_t lda);
-void onemklDsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+void onemklDsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                            const double *x, int64_t incx, double *a, int64_t lda);
-void onemklCsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+void onemklCsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                            const float _Complex *x, int64_t incx, float _Complex *a, int64_t lda);
-void onemklZsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+void onemklZsyr(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                            const double _Complex *x, int64_t incx, double _Complex *a, int64_t lda);
 
-void onemklSsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float alpha,
+void onemklSsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float *alpha,
                            const float *x, int64_t incx, const float *y, int64_t incy, float *a, int64_t lda);
-void onemklDsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double alpha,
+void onemklDsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double *alpha,
                            const double *x, int64_t incx, const double *y, int64_t incy, double *a, int64_t lda);
-void onemklCsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, float _Complex alpha,
+void onemklCsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const float _Complex *alpha,
                            const float _Complex *x, int64_t incx, const float _Complex *y, int64_t incy, float _Complex *a, int64_t lda);
-void onemklZsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, double _Complex alpha,
+void onemklZsyr2(syclQueue_t device_queue, onemklUplo uplo, int64_t n, const double _Complex *alpha,
                            const double _Complex *x, int64_t incx, const double _Complex *y, int64_t incy, double _Complex *a, int64_t lda);
 
 void onemklStbmv(syclQueue_t device_queue, onemklUplo uplo,
@@ -454,131 +849,773 @@ void onemklZtrsv(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose tran
                 int64_t incx);
 
 void onemklCherk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float alpha, const float _Complex* a, int64_t lda, float beta, float _Complex* c, int64_t ldc);
+                const float *alpha, const float _Complex* a, int64_t lda, const float *beta, float _Complex* c, int64_t ldc);
 void onemklZherk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double alpha, const double _Complex* a, int64_t lda, double beta, double _Complex* c, int64_t ldc);
+                const double *alpha, const double _Complex* a, int64_t lda, const double *beta, double _Complex* c, int64_t ldc);
 
 void onemklCher2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float beta, float _Complex* c, int64_t ldc);
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float *beta, float _Complex* c, int64_t ldc);
 void onemklZher2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex* a, int64_t lda,  const double _Complex* b, int64_t ldb,
-                double beta, double _Complex* c, int64_t ldc);
+                const double _Complex *alpha, const double _Complex* a, int64_t lda,  const double _Complex* b, int64_t ldb,
+                const double *beta, double _Complex* c, int64_t ldc);
 
 void onemklSsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                float alpha, const float* a, int64_t lda, const float* b, int64_t ldb,
-                float beta, float* c, int64_t ldc);
+                const float *alpha, const float* a, int64_t lda, const float* b, int64_t ldb,
+                const float *beta, float* c, int64_t ldc);
 void onemklDsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
-                double beta, double* c, int64_t ldc);
+                const double *alpha, const double* a, int64_t lda, const double* b, int64_t ldb,
+                const double *beta, double* c, int64_t ldc);
 void onemklCsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float _Complex beta, float _Complex* c, int64_t ldc);
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float _Complex *beta, float _Complex* c, int64_t ldc);
 void onemklZsymm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                double _Complex alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
-                double _Complex beta, double _Complex* c, int64_t ldc);
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
+                const double _Complex *beta, double _Complex* c, int64_t ldc);
 
 void onemklSsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float alpha, const float* a, int64_t lda, float beta, float* c, int64_t ldc);
+                const float *alpha, const float* a, int64_t lda, const float *beta, float* c, int64_t ldc);
 void onemklDsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double alpha, const double* a, int64_t lda, double beta, double* c, int64_t ldc);
+                const double *alpha, const double* a, int64_t lda, const double *beta, double* c, int64_t ldc);
 void onemklCsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex* a, int64_t lda, float _Complex beta, float _Complex* c, int64_t ldc);
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex *beta, float _Complex* c, int64_t ldc);
 void onemklZsyrk(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex* a, int64_t lda, double _Complex beta, double _Complex* c, int64_t ldc);
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex *beta, double _Complex* c, int64_t ldc);
 
 void onemklSsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float alpha, const float* a, int64_t lda, const float* b, int64_t ldb, float beta, float* c, int64_t ldc);
+                const float *alpha, const float* a, int64_t lda, const float* b, int64_t ldb, const float *beta, float* c, int64_t ldc);
 void onemklDsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double alpha, const double* a, int64_t lda, const double* b, int64_t ldb,double beta, double* c, int64_t ldc);
+                const double *alpha, const double* a, int64_t lda, const double* b, int64_t ldb,const double *beta, double* c, int64_t ldc);
 void onemklCsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float _Complex beta, float _Complex* c, int64_t ldc);
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float _Complex *beta, float _Complex* c, int64_t ldc);
 void onemklZsyr2k(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
-                double _Complex beta, double _Complex* c, int64_t ldc);
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
+                const double _Complex *beta, double _Complex* c, int64_t ldc);
 
 void onemklChemm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                float _Complex alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
-                float _Complex beta, float _Complex* c, int64_t ldc);
+                const float _Complex *alpha, const float _Complex* a, int64_t lda, const float _Complex* b, int64_t ldb,
+                const float _Complex *beta, float _Complex* c, int64_t ldc);
 void onemklZhemm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m, int64_t n,
-                double _Complex alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
-                double _Complex beta, double _Complex* c, int64_t ldc);
+                const double _Complex *alpha, const double _Complex* a, int64_t lda, const double _Complex* b, int64_t ldb,
+                const double _Complex *beta, double _Complex* c, int64_t ldc);
 
 void onemklStrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float alpha, const float *a, int64_t lda, float *b, int64_t ldb);
+                int64_t n, const float *alpha, const float *a, int64_t lda, float *b, int64_t ldb);
 void onemklDtrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double alpha, const double *a, int64_t lda, double *b, int64_t ldb);
+                int64_t n, const double *alpha, const double *a, int64_t lda, double *b, int64_t ldb);
 void onemklCtrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float _Complex alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb);
+                int64_t n, const float _Complex *alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb);
 void onemklZtrmm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb);
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb);
 
 void onemklStrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float alpha, const float *a, int64_t lda, float *b, int64_t ldb);
+                int64_t n, const float *alpha, const float *a, int64_t lda, float *b, int64_t ldb);
 void onemklDtrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double alpha, const double *a, int64_t lda, double *b, int64_t ldb);
+                int64_t n, const double *alpha, const double *a, int64_t lda, double *b, int64_t ldb);
 void onemklCtrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float _Complex alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb);
+                int64_t n, const float _Complex *alpha, const float _Complex*a, int64_t lda, float _Complex*b, int64_t ldb);
 void onemklZtrsm(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb);
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, double _Complex *b, int64_t ldb);
 
 void onemklStrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float alpha, const float *a, int64_t lda, int64_t stridea, float *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+                int64_t n, const float *alpha, const float *a, int64_t lda, int64_t stridea, float *b, int64_t ldb, int64_t strideb, int64_t batch_size);
 void onemklDtrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double alpha, const double *a, int64_t lda, int64_t stridea, double *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+                int64_t n, const double *alpha, const double *a, int64_t lda, int64_t stridea, double *b, int64_t ldb, int64_t strideb, int64_t batch_size);
 void onemklCtrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, float _Complex alpha, const float _Complex*a, int64_t lda, int64_t stridea, float _Complex*b, int64_t ldb, int64_t strideb, int64_t batch_size);
+                int64_t n, const float _Complex *alpha, const float _Complex*a, int64_t lda, int64_t stridea, float _Complex*b, int64_t ldb, int64_t strideb, int64_t batch_size);
 void onemklZtrsm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans, onemklDiag diag, int64_t m,
-                int64_t n, double _Complex alpha, const double _Complex *a, int64_t lda, int64_t stridea, double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+
+void onemklStrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float *alpha, const float **a, int64_t lda,
+                float **b, int64_t ldb, int64_t batch_size);
+void onemklDtrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double *alpha, const double **a, int64_t lda,
+                double **b, int64_t ldb, int64_t batch_size);
+void onemklCtrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda,
+                float _Complex **b, int64_t ldb, int64_t batch_size);
+void onemklZtrsm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                double _Complex **b, int64_t ldb, int64_t batch_size);
+void onemklStrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float *alpha, const float **a, int64_t lda,
+                float **b, int64_t ldb, int64_t batch_size);
+void onemklDtrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double *alpha, const double **a, int64_t lda,
+                double **b, int64_t ldb, int64_t batch_size);
+void onemklCtrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda,
+                float _Complex **b, int64_t ldb, int64_t batch_size);
+void onemklZtrmm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda,
+                double _Complex **b, int64_t ldb, int64_t batch_size);
+
+void onemklStrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float *alpha, const float *a, int64_t lda,
+                int64_t stridea, float *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklDtrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double *alpha, const double *a, int64_t lda,
+                int64_t stridea, double *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklCtrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda,
+                int64_t stridea, float _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklZtrmm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, onemklTranspose trans,
+                onemklDiag diag, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda,
+                int64_t stridea, double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size);
+
+void onemklSsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float *a, int64_t lda, const float *b, int64_t ldb,
+                const float *beta, float *c, int64_t ldc);
+void onemklSsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float *alpha, const float **a, int64_t lda, const float **b, int64_t ldb,
+                const float *beta, float **c, int64_t ldc, int64_t batch_size);
+void onemklSsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *b,
+                int64_t ldb, int64_t strideb, const float *beta, float *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklDsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double *a, int64_t lda, const double *b, int64_t ldb,
+                const double *beta, double *c, int64_t ldc);
+void onemklDsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double *alpha, const double **a, int64_t lda, const double **b, int64_t ldb,
+                const double *beta, double **c, int64_t ldc, int64_t batch_size);
+void onemklDsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *b,
+                int64_t ldb, int64_t strideb, const double *beta, double *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklCsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, const float _Complex *b, int64_t ldb,
+                const float _Complex *beta, float _Complex *c, int64_t ldc);
+void onemklCsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklCsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklZsyrkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, const double _Complex *b, int64_t ldb,
+                const double _Complex *beta, double _Complex *c, int64_t ldc);
+void onemklZsyrkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklZsyrkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklCherkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, const float _Complex *b, int64_t ldb,
+                const float *beta, float _Complex *c, int64_t ldc);
+void onemklCherkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float *beta, float _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklCherkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklZherkx(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, const double _Complex *b, int64_t ldb,
+                const double *beta, double _Complex *c, int64_t ldc);
+void onemklZherkx_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double *beta, double _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklZherkx_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans,
+                int64_t n, int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+
+void onemklSgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const float *alpha, const float *A, int64_t lda, const float *beta,
+                const float *B, int64_t ldb, float *C, int64_t ldc);
+void onemklSgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float *alpha, const float **A, int64_t lda,
+                const float *beta, const float **B, int64_t ldb, float **C, int64_t ldc, int64_t batch_size);
+void onemklSgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float *alpha, const float *A, int64_t lda,
+                int64_t stridea, const float *beta, const float *B, int64_t ldb, int64_t strideb, float *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklDgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const double *alpha, const double *A, int64_t lda, const double *beta,
+                const double *B, int64_t ldb, double *C, int64_t ldc);
+void onemklDgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double *alpha, const double **A, int64_t lda,
+                const double *beta, const double **B, int64_t ldb, double **C, int64_t ldc, int64_t batch_size);
+void onemklDgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double *alpha, const double *A, int64_t lda,
+                int64_t stridea, const double *beta, const double *B, int64_t ldb, int64_t strideb, double *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklCgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const float _Complex *alpha, const float _Complex *A, int64_t lda, const float _Complex *beta,
+                const float _Complex *B, int64_t ldb, float _Complex *C, int64_t ldc);
+void onemklCgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex **A, int64_t lda,
+                const float _Complex *beta, const float _Complex **B, int64_t ldb, float _Complex **C, int64_t ldc, int64_t batch_size);
+void onemklCgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const float _Complex *alpha, const float _Complex *A, int64_t lda,
+                int64_t stridea, const float _Complex *beta, const float _Complex *B, int64_t ldb, int64_t strideb, float _Complex *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklZgeam(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *A, int64_t lda, const double _Complex *beta,
+                const double _Complex *B, int64_t ldb, double _Complex *C, int64_t ldc);
+void onemklZgeam_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex **A, int64_t lda,
+                const double _Complex *beta, const double _Complex **B, int64_t ldb, double _Complex **C, int64_t ldc, int64_t batch_size);
+void onemklZgeam_strided(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, const double _Complex *alpha, const double _Complex *A, int64_t lda,
+                int64_t stridea, const double _Complex *beta, const double _Complex *B, int64_t ldb, int64_t strideb, double _Complex *C,
+                int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklSdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float *A, int64_t lda, const float *x, int64_t incx, float *C, int64_t ldc);
+void onemklSdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float **A, int64_t lda, const float **x, int64_t incx, float **C, int64_t ldc,
+                int64_t batch_size);
+void onemklSdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const float *A, int64_t lda, int64_t stridea, const float *x, int64_t incx,
+                int64_t stridex, float *C, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklDdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double *A, int64_t lda, const double *x, int64_t incx, double *C, int64_t ldc);
+void onemklDdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double **A, int64_t lda, const double **x, int64_t incx, double **C, int64_t ldc,
+                int64_t batch_size);
+void onemklDdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const double *A, int64_t lda, int64_t stridea, const double *x, int64_t incx,
+                int64_t stridex, double *C, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklCdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float _Complex *A, int64_t lda, const float _Complex *x, int64_t incx, float _Complex *C, int64_t ldc);
+void onemklCdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const float _Complex **A, int64_t lda, const float _Complex **x, int64_t incx, float _Complex **C, int64_t ldc,
+                int64_t batch_size);
+void onemklCdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const float _Complex *A, int64_t lda, int64_t stridea, const float _Complex *x, int64_t incx,
+                int64_t stridex, float _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklZdgmm(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double _Complex *A, int64_t lda, const double _Complex *x, int64_t incx, double _Complex *C, int64_t ldc);
+void onemklZdgmm_batch(syclQueue_t device_queue, onemklSideMode side, int64_t m, int64_t n,
+                const double _Complex **A, int64_t lda, const double _Complex **x, int64_t incx, double _Complex **C, int64_t ldc,
+                int64_t batch_size);
+void onemklZdgmm_strided(syclQueue_t device_queue, onemklSideMode side, int64_t m,
+                int64_t n, const double _Complex *A, int64_t lda, int64_t stridea, const double _Complex *x, int64_t incx,
+                int64_t stridex, double _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size);
+
+void onemklSsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float **a, int64_t lda, const float *beta, float **c,
+                int64_t ldc, int64_t batch_size);
+void onemklSsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *beta,
+                float *c, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklDsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double **a, int64_t lda, const double *beta, double **c,
+                int64_t ldc, int64_t batch_size);
+void onemklDsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *beta,
+                double *c, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklCsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex *beta, float _Complex **c,
+                int64_t ldc, int64_t batch_size);
+void onemklCsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *beta,
+                float _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklZsyrk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex *beta, double _Complex **c,
+                int64_t ldc, int64_t batch_size);
+void onemklZsyrk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *beta,
+                double _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size);
+
+void onemklCherk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float _Complex **a, int64_t lda, const float *beta, float _Complex **c,
+                int64_t ldc, int64_t batch_size);
+void onemklCherk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float *beta,
+                float _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size);
+void onemklZherk_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double _Complex **a, int64_t lda, const double *beta, double _Complex **c,
+                int64_t ldc, int64_t batch_size);
+void onemklZherk_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double *beta,
+                double _Complex *c, int64_t ldc, int64_t stridec, int64_t batch_size);
+
+void onemklSsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float **a, int64_t lda, const float **b, int64_t ldb,
+                const float *beta, float **c, int64_t ldc, int64_t batch_size);
+void onemklSsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *b,
+                int64_t ldb, int64_t strideb, const float *beta, float *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklDsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double **a, int64_t lda, const double **b, int64_t ldb,
+                const double *beta, double **c, int64_t ldc, int64_t batch_size);
+void onemklDsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *b,
+                int64_t ldb, int64_t strideb, const double *beta, double *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklCsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklCsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklZsyr2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklZsyr2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+
+void onemklCher2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float *beta, float _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklCher2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklZher2k_batch(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double *beta, double _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklZher2k_strided(syclQueue_t device_queue, onemklUplo uplo, onemklTranspose trans, int64_t n,
+                int64_t k, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+
+void onemklSsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float *alpha, const float **a, int64_t lda, const float **b, int64_t ldb,
+                const float *beta, float **c, int64_t ldc, int64_t batch_size);
+void onemklSsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float *alpha, const float *a, int64_t lda, int64_t stridea, const float *b,
+                int64_t ldb, int64_t strideb, const float *beta, float *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklDsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double *alpha, const double **a, int64_t lda, const double **b, int64_t ldb,
+                const double *beta, double **c, int64_t ldc, int64_t batch_size);
+void onemklDsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double *alpha, const double *a, int64_t lda, int64_t stridea, const double *b,
+                int64_t ldb, int64_t strideb, const double *beta, double *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklCsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklCsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklZsymm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklZsymm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+
+void onemklChemm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex **a, int64_t lda, const float _Complex **b, int64_t ldb,
+                const float _Complex *beta, float _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklChemm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const float _Complex *alpha, const float _Complex *a, int64_t lda, int64_t stridea, const float _Complex *b,
+                int64_t ldb, int64_t strideb, const float _Complex *beta, float _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
+void onemklZhemm_batch(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex **a, int64_t lda, const double _Complex **b, int64_t ldb,
+                const double _Complex *beta, double _Complex **c, int64_t ldc, int64_t batch_size);
+void onemklZhemm_strided(syclQueue_t device_queue, onemklSideMode side, onemklUplo uplo, int64_t m,
+                int64_t n, const double _Complex *alpha, const double _Complex *a, int64_t lda, int64_t stridea, const double _Complex *b,
+                int64_t ldb, int64_t strideb, const double _Complex *beta, double _Complex *c, int64_t ldc, int64_t stridec,
+                int64_t batch_size);
 
 int onemklHgemm(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                uint16_t alpha, const short *A, int64_t lda, const short *B,
-                int64_t ldb, uint16_t beta, short *C, int64_t ldc);
+                const uint16_t *alpha, const short *A, int64_t lda, const short *B,
+                int64_t ldb, const uint16_t *beta, short *C, int64_t ldc);
 int onemklSgemm(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float alpha, const float *A, int64_t lda, const float *B,
-                int64_t ldb, float beta, float *C, int64_t ldc);
+                const float *alpha, const float *A, int64_t lda, const float *B,
+                int64_t ldb, const float *beta, float *C, int64_t ldc);
 int onemklDgemm(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                double alpha, const double *A, int64_t lda, const double *B,
-                int64_t ldb, double beta, double *C, int64_t ldc);
+                const double *alpha, const double *A, int64_t lda, const double *B,
+                int64_t ldb, const double *beta, double *C, int64_t ldc);
 int onemklCgemm(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex *A, int64_t lda,
-                const float _Complex *B, int64_t ldb, float _Complex beta,
+                const float _Complex *alpha, const float _Complex *A, int64_t lda,
+                const float _Complex *B, int64_t ldb, const float _Complex *beta,
                 float _Complex *C, int64_t ldc);
 int onemklZgemm(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex *A, int64_t lda,
-                const double _Complex *B, int64_t ldb, double _Complex beta,
+                const double _Complex *alpha, const double _Complex *A, int64_t lda,
+                const double _Complex *B, int64_t ldb, const double _Complex *beta,
                 double _Complex *C, int64_t ldc);
 
 int onemklSgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float alpha, const float *A, int64_t lda, int64_t stridea,
-                const float *B, int64_t ldb, int64_t strideb, float beta,
+                const float *alpha, const float *A, int64_t lda, int64_t stridea,
+                const float *B, int64_t ldb, int64_t strideb, const float *beta,
                 float *C, int64_t ldc, int64_t stridec, int64_t batch_size);
 int onemklDgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                double alpha, const double *A, int64_t lda, int64_t stridea,
-                const double *B, int64_t ldb, int64_t strideb, double beta,
+                const double *alpha, const double *A, int64_t lda, int64_t stridea,
+                const double *B, int64_t ldb, int64_t strideb, const double *beta,
                 double *C, int64_t ldc, int64_t stridec, int64_t batch_size);
 int onemklCgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float _Complex alpha, const float _Complex *A, int64_t lda, int64_t stridea,
-                const float _Complex *B, int64_t ldb, int64_t strideb, float _Complex beta,
+                const float _Complex *alpha, const float _Complex *A, int64_t lda, int64_t stridea,
+                const float _Complex *B, int64_t ldb, int64_t strideb, const float _Complex *beta,
                 float _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size);
 int onemklZgemm_strided(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                double _Complex alpha, const double _Complex *A, int64_t lda, int64_t stridea,
-                const double _Complex *B, int64_t ldb, int64_t strideb, double _Complex beta,
+                const double _Complex *alpha, const double _Complex *A, int64_t lda, int64_t stridea,
+                const double _Complex *B, int64_t ldb, int64_t strideb, const double _Complex *beta,
                 double _Complex *C, int64_t ldc, int64_t stridec, int64_t batch_size);
+// pointer-array batched gemm, A/B/C are device arrays of batch_size matrices.
+// With device alpha and beta 'workspace' is a device buffer of
+// onemklGemmBatchWorkspaceSize() bytes, or nullptr for the slower fallback
+// kernel; it is not used with host scalars.
+size_t onemklGemmBatchWorkspaceSize(int64_t m, int64_t n, int64_t batch_size, size_t element_size);
+int onemklHgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const uint16_t *alpha, const short **A, int64_t lda,
+                const short **B, int64_t ldb, const uint16_t *beta,
+                short **C, int64_t ldc, int64_t batch_size,
+                void *workspace);
+int onemklSgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const float *alpha, const float **A, int64_t lda,
+                const float **B, int64_t ldb, const float *beta,
+                float **C, int64_t ldc, int64_t batch_size,
+                void *workspace);
+int onemklDgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const double *alpha, const double **A, int64_t lda,
+                const double **B, int64_t ldb, const double *beta,
+                double **C, int64_t ldc, int64_t batch_size,
+                void *workspace);
+int onemklCgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const float _Complex *alpha, const float _Complex **A, int64_t lda,
+                const float _Complex **B, int64_t ldb, const float _Complex *beta,
+                float _Complex **C, int64_t ldc, int64_t batch_size,
+                void *workspace);
+int onemklZgemm_batch(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k,
+                const double _Complex *alpha, const double _Complex **A, int64_t lda,
+                const double _Complex **B, int64_t ldb, const double _Complex *beta,
+                double _Complex **C, int64_t ldc, int64_t batch_size,
+                void *workspace);
 int onemklSgemmEx(syclQueue_t device_queue, onemklTranspose transA,
                 onemklTranspose transB, int64_t m, int64_t n, int64_t k,
-                float alpha, const void *A, onemklDatatype_t Atype, int64_t lda, const void *B,
-                onemklDatatype_t Btype, int64_t ldb, float beta, void *C, onemklDatatype_t Ctype, int64_t ldc);
+                const float *alpha, const void *A, onemklDatatype_t Atype, int64_t lda, const void *B,
+                onemklDatatype_t Btype, int64_t ldb, const float *beta, void *C, onemklDatatype_t Ctype, int64_t ldc);
+// hipblasGemm*Ex: A and B of type Atype (== Btype), C of type Ctype, alpha and
+// beta of computeType. The gemm routines return nonzero for a combination
+// onemklGemmExSupported() rejects.
+int onemklGemmExSupported(onemklDatatype_t Atype, onemklDatatype_t Btype, onemklDatatype_t Ctype,
+                onemklDatatype_t computeType);
+int onemklGemmEx(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, int64_t k, const void *alpha, const void *A, onemklDatatype_t Atype,
+                int64_t lda, const void *B, onemklDatatype_t Btype, int64_t ldb, const void *beta, void *C,
+                onemklDatatype_t Ctype, int64_t ldc, onemklDatatype_t computeType);
+int onemklGemmBatchedEx(syclQueue_t device_queue, onemklTranspose transA, onemklTranspose transB,
+                int64_t m, int64_t n, int64_t k, const void *alpha, const void **A, onemklDatatype_t Atype,
+                int64_t lda, const void **B, onemklDatatype_t Btype, int64_t ldb, const void *beta, void **C,
+                onemklDatatype_t Ctype, int64_t ldc, int64_t batch_size, onemklDatatype_t computeType);
+// group gemm_batch, group_count groups of group_size[g] problems. The per
+// group parameters and the alpha and beta arrays are host arrays.
+int onemklGemmGroupedBatchedEx(syclQueue_t device_queue, const onemklTranspose *transA,
+                const onemklTranspose *transB, const int64_t *m, const int64_t *n, const int64_t *k,
+                const void *alpha, const void **A, onemklDatatype_t Atype, const int64_t *lda, const void **B,
+                onemklDatatype_t Btype, const int64_t *ldb, const void *beta, void **C, onemklDatatype_t Ctype,
+                const int64_t *ldc, int64_t group_count, const int64_t *group_size, onemklDatatype_t computeType);
+int onemklGemmStridedBatchedEx(syclQueue_t device_queue, onemklTranspose transA,
+                onemklTranspose transB, int64_t m, int64_t n, int64_t k, const void *alpha, const void *A,
+                onemklDatatype_t Atype, int64_t lda, int64_t stridea, const void *B, onemklDatatype_t Btype,
+                int64_t ldb, int64_t strideb, const void *beta, void *C, onemklDatatype_t Ctype, int64_t ldc,
+                int64_t stridec, int64_t batch_size, onemklDatatype_t computeType);
+// hipblas{Axpy,Scal,Dot,Dotc,Nrm2,Rot}*Ex: x and y of type xType (== yType).
+// Return nonzero for an unsupported type combination.
+int onemklAxpyEx(syclQueue_t device_queue, int64_t n, const void *alpha, onemklDatatype_t alphaType,
+                const void *x, onemklDatatype_t xType, int64_t incx, void *y, onemklDatatype_t yType, int64_t incy,
+                onemklDatatype_t executionType);
+int onemklAxpyBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, const void **x, onemklDatatype_t xType, int64_t incx, void **y,
+                onemklDatatype_t yType, int64_t incy, int64_t batch_size, onemklDatatype_t executionType);
+int onemklAxpyStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, const void *x, onemklDatatype_t xType, int64_t incx, int64_t stridex,
+                void *y, onemklDatatype_t yType, int64_t incy, int64_t stridey, int64_t batch_size,
+                onemklDatatype_t executionType);
+int onemklScalEx(syclQueue_t device_queue, int64_t n, const void *alpha, onemklDatatype_t alphaType,
+                void *x, onemklDatatype_t xType, int64_t incx, onemklDatatype_t executionType);
+int onemklScalBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, void **x, onemklDatatype_t xType, int64_t incx, int64_t batch_size,
+                onemklDatatype_t executionType);
+int onemklScalStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *alpha,
+                onemklDatatype_t alphaType, void *x, onemklDatatype_t xType, int64_t incx, int64_t stridex,
+                int64_t batch_size, onemklDatatype_t executionType);
+int onemklDotEx(syclQueue_t device_queue, int64_t n, const void *x, onemklDatatype_t xType,
+                int64_t incx, const void *y, onemklDatatype_t yType, int64_t incy, void *result,
+                onemklDatatype_t resultType, onemklDatatype_t executionType);
+int onemklDotBatchedEx(syclQueue_t device_queue, int64_t n, const void **x, onemklDatatype_t xType,
+                int64_t incx, const void **y, onemklDatatype_t yType, int64_t incy, int64_t batch_size,
+                void *result, onemklDatatype_t resultType, onemklDatatype_t executionType);
+int onemklDotStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *x,
+                onemklDatatype_t xType, int64_t incx, int64_t stridex, const void *y, onemklDatatype_t yType,
+                int64_t incy, int64_t stridey, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType);
+int onemklDotcEx(syclQueue_t device_queue, int64_t n, const void *x, onemklDatatype_t xType,
+                int64_t incx, const void *y, onemklDatatype_t yType, int64_t incy, void *result,
+                onemklDatatype_t resultType, onemklDatatype_t executionType);
+int onemklDotcBatchedEx(syclQueue_t device_queue, int64_t n, const void **x, onemklDatatype_t xType,
+                int64_t incx, const void **y, onemklDatatype_t yType, int64_t incy, int64_t batch_size,
+                void *result, onemklDatatype_t resultType, onemklDatatype_t executionType);
+int onemklDotcStridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *x,
+                onemklDatatype_t xType, int64_t incx, int64_t stridex, const void *y, onemklDatatype_t yType,
+                int64_t incy, int64_t stridey, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType);
+int onemklNrm2Ex(syclQueue_t device_queue, int64_t n, const void *x, onemklDatatype_t xType,
+                int64_t incx, void *result, onemklDatatype_t resultType, onemklDatatype_t executionType);
+int onemklNrm2BatchedEx(syclQueue_t device_queue, int64_t n, const void **x, onemklDatatype_t xType,
+                int64_t incx, int64_t batch_size, void *result, onemklDatatype_t resultType,
+                onemklDatatype_t executionType);
+int onemklNrm2StridedBatchedEx(syclQueue_t device_queue, int64_t n, const void *x,
+                onemklDatatype_t xType, int64_t incx, int64_t stridex, int64_t batch_size, void *result,
+                onemklDatatype_t resultType, onemklDatatype_t executionType);
+int onemklRotEx(syclQueue_t device_queue, int64_t n, void *x, onemklDatatype_t xType, int64_t incx,
+                void *y, onemklDatatype_t yType, int64_t incy, const void *c, const void *s,
+                onemklDatatype_t csType, onemklDatatype_t executionType);
+int onemklRotBatchedEx(syclQueue_t device_queue, int64_t n, void **x, onemklDatatype_t xType,
+                int64_t incx, void **y, onemklDatatype_t yType, int64_t incy, const void *c, const void *s,
+                onemklDatatype_t csType, int64_t batch_size, onemklDatatype_t executionType);
+int onemklRotStridedBatchedEx(syclQueue_t device_queue, int64_t n, void *x, onemklDatatype_t xType,
+                int64_t incx, int64_t stridex, void *y, onemklDatatype_t yType, int64_t incy, int64_t stridey,
+                const void *c, const void *s, onemklDatatype_t csType, int64_t batch_size,
+                onemklDatatype_t executionType);
+
+// Solvers (LAPACK) on top of oneMKL's batched LAPACK. The _batch routines
+// take device arrays of pointers, the _strided ones a base pointer and stride;
+// a single problem is a strided batch of one. Each routine needs a device
+// scratch buffer of at least the bytes its _scratchpad_size companion returns
+// for the same arguments. info arrays are device arrays of batch_size ints.
+int64_t onemklSgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size);
+void onemklSgetrf_strided(syclQueue_t device_queue, int64_t n, float *a, int64_t lda, int64_t stridea,
+                int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklDgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size);
+void onemklDgetrf_strided(syclQueue_t device_queue, int64_t n, double *a, int64_t lda, int64_t stridea,
+                int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklCgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size);
+void onemklCgetrf_strided(syclQueue_t device_queue, int64_t n, float _Complex *a, int64_t lda,
+                int64_t stridea, int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklZgetrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda,
+                int64_t stridea, int pivot, int64_t batch_size);
+void onemklZgetrf_strided(syclQueue_t device_queue, int64_t n, double _Complex *a, int64_t lda,
+                int64_t stridea, int *ipiv, int64_t stridep, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklSgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda, int pivot,
+                int64_t batch_size);
+void onemklSgetrf_batch(syclQueue_t device_queue, int64_t n, float **a, int64_t lda, int *ipiv, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklDgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda, int pivot,
+                int64_t batch_size);
+void onemklDgetrf_batch(syclQueue_t device_queue, int64_t n, double **a, int64_t lda, int *ipiv, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklCgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda, int pivot,
+                int64_t batch_size);
+void onemklCgetrf_batch(syclQueue_t device_queue, int64_t n, float _Complex **a, int64_t lda, int *ipiv,
+                int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklZgetrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t lda, int pivot,
+                int64_t batch_size);
+void onemklZgetrf_batch(syclQueue_t device_queue, int64_t n, double _Complex **a, int64_t lda, int *ipiv,
+                int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklSgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklSgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs, float *a,
+                int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep, float *b, int64_t ldb,
+                int64_t strideb, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklDgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklDgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs, double *a,
+                int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep, double *b, int64_t ldb,
+                int64_t strideb, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklCgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklCgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                float _Complex *a, int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep,
+                float _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklZgetrs_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb, int64_t batch_size);
+void onemklZgetrs_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                double _Complex *a, int64_t lda, int64_t stridea, const int *ipiv, int64_t stridep,
+                double _Complex *b, int64_t ldb, int64_t strideb, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklSgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklSgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs, float **a,
+                int64_t lda, const int *ipiv, float **b, int64_t ldb, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklDgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklDgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs, double **a,
+                int64_t lda, const int *ipiv, double **b, int64_t ldb, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklCgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklCgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                float _Complex **a, int64_t lda, const int *ipiv, float _Complex **b, int64_t ldb,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklZgetrs_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t n,
+                int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklZgetrs_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t n, int64_t nrhs,
+                double _Complex **a, int64_t lda, const int *ipiv, double _Complex **b, int64_t ldb,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklSgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size);
+void onemklSgetri_batch(syclQueue_t device_queue, int64_t n, float **a, int64_t lda, const int *ipiv,
+                float **c, int64_t ldc, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklDgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size);
+void onemklDgetri_batch(syclQueue_t device_queue, int64_t n, double **a, int64_t lda, const int *ipiv,
+                double **c, int64_t ldc, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklCgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size);
+void onemklCgetri_batch(syclQueue_t device_queue, int64_t n, float _Complex **a, int64_t lda, const int *ipiv,
+                float _Complex **c, int64_t ldc, int *info, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklZgetri_batch_scratchpad_size(syclQueue_t device_queue, int64_t n, int64_t ldc,
+                int64_t batch_size);
+void onemklZgetri_batch(syclQueue_t device_queue, int64_t n, double _Complex **a, int64_t lda,
+                const int *ipiv, double _Complex **c, int64_t ldc, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklSgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t stridea, int64_t stridet, int64_t batch_size);
+void onemklSgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, float *a, int64_t lda,
+                int64_t stridea, float *tau, int64_t stridet, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklDgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t stridea, int64_t stridet, int64_t batch_size);
+void onemklDgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, double *a, int64_t lda,
+                int64_t stridea, double *tau, int64_t stridet, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklCgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t stridea, int64_t stridet, int64_t batch_size);
+void onemklCgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex *a, int64_t lda,
+                int64_t stridea, float _Complex *tau, int64_t stridet, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklZgeqrf_strided_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t stridea, int64_t stridet, int64_t batch_size);
+void onemklZgeqrf_strided(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex *a, int64_t lda,
+                int64_t stridea, double _Complex *tau, int64_t stridet, int64_t batch_size, void *scratchpad,
+                int64_t scratchpad_bytes);
+int64_t onemklSgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t batch_size);
+void onemklSgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, float **a, int64_t lda, float **tau,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklDgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t batch_size);
+void onemklDgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, double **a, int64_t lda, double **tau,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklCgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t batch_size);
+void onemklCgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, float _Complex **a, int64_t lda,
+                float _Complex **tau, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklZgeqrf_batch_scratchpad_size(syclQueue_t device_queue, int64_t m, int64_t n, int64_t lda,
+                int64_t batch_size);
+void onemklZgeqrf_batch(syclQueue_t device_queue, int64_t m, int64_t n, double _Complex **a, int64_t lda,
+                double _Complex **tau, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklSgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size);
+void onemklSgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                float *a, int64_t lda, int64_t stridea, float *b, int64_t ldb, int64_t strideb, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklDgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size);
+void onemklDgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                double *a, int64_t lda, int64_t stridea, double *b, int64_t ldb, int64_t strideb, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklCgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size);
+void onemklCgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                float _Complex *a, int64_t lda, int64_t stridea, float _Complex *b, int64_t ldb,
+                int64_t strideb, int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklZgels_strided_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t stridea, int64_t ldb, int64_t strideb,
+                int64_t batch_size);
+void onemklZgels_strided(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                double _Complex *a, int64_t lda, int64_t stridea, double _Complex *b, int64_t ldb,
+                int64_t strideb, int *info, int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklSgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklSgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                float **a, int64_t lda, float **b, int64_t ldb, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklDgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklDgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                double **a, int64_t lda, double **b, int64_t ldb, int *info, int64_t batch_size,
+                void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklCgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklCgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                float _Complex **a, int64_t lda, float _Complex **b, int64_t ldb, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklZgels_batch_scratchpad_size(syclQueue_t device_queue, onemklTranspose trans, int64_t m,
+                int64_t n, int64_t nrhs, int64_t lda, int64_t ldb, int64_t batch_size);
+void onemklZgels_batch(syclQueue_t device_queue, onemklTranspose trans, int64_t m, int64_t n, int64_t nrhs,
+                double _Complex **a, int64_t lda, double _Complex **b, int64_t ldb, int *info,
+                int64_t batch_size, void *scratchpad, int64_t scratchpad_bytes);
+int64_t onemklStrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva);
+void onemklStrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float *a, int64_t lda, float *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes);
+void onemklStrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float *a, int64_t lda, int64_t stridea, float *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size);
+void onemklStrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float **a, int64_t lda, float **inva, int64_t ldinva, int64_t batch_size);
+int64_t onemklDtrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva);
+void onemklDtrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double *a, int64_t lda, double *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes);
+void onemklDtrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double *a, int64_t lda, int64_t stridea, double *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size);
+void onemklDtrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double **a, int64_t lda, double **inva, int64_t ldinva, int64_t batch_size);
+int64_t onemklCtrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva);
+void onemklCtrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float _Complex *a, int64_t lda, float _Complex *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes);
+void onemklCtrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float _Complex *a, int64_t lda, int64_t stridea, float _Complex *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size);
+void onemklCtrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const float _Complex **a, int64_t lda, float _Complex **inva, int64_t ldinva, int64_t batch_size);
+int64_t onemklZtrtri_scratchpad_size(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag,
+                int64_t n, int64_t ldinva);
+void onemklZtrtri(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double _Complex *a, int64_t lda, double _Complex *inva, int64_t ldinva, void *scratchpad, int64_t scratchpad_bytes);
+void onemklZtrtri_strided(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double _Complex *a, int64_t lda, int64_t stridea, double _Complex *inva, int64_t ldinva, int64_t strideinva,
+                int64_t batch_size);
+void onemklZtrtri_batch(syclQueue_t device_queue, onemklUplo uplo, onemklDiag diag, int64_t n,
+                const double _Complex **a, int64_t lda, double _Complex **inva, int64_t ldinva, int64_t batch_size);
+
+// Runs the routines named in the comma separated list (sgemm, zaxpy, ...,
+// "all") once on a tiny problem so their kernels are compiled ahead of the
+// first real call. A list is run once per context. Returns the number of
+// routines run and the time it took in 'milliseconds'.
+int onemklWarmup(syclQueue_t device_queue, const char *routines, double *milliseconds);
 
 void onemklDestroy();
 #ifdef __cplusplus
@@ -0,0 +1,842 @@
+#pragma once
+
+// Hand written SYCL kernels backing the batched routines oneMKL has no batched
+// entry point for. Each routine processes the whole batch in one submission,
+// so a batch of small vectors costs a single launch instead of one per vector.
+
+#include "sycl.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace onemkl_kernels {
+
+// The b-th vector of a batch, either at a fixed stride from a base pointer
+// (StridedBatched) or through a device array of pointers (Batched).
+template <typename T>
+struct strided_batch {
+    T*      base;
+    int64_t stride;
+    T* operator[](int64_t b) const { return base + b * stride; }
+};
+
+template <typename T>
+struct pointer_batch {
+    T* const* ptrs;
+    T* operator[](int64_t b) const { return ptrs[b]; }
+};
+
+// Scalar argument (alpha, c, s, ...). In host pointer mode the value is
+// captured when the kernel is submitted, in device pointer mode the pointer
+// is dereferenced by the kernel itself.
+template <typename T>
+struct kernel_scalar {
+    T        val;
+    const T* ptr;
+    T get() const { return ptr != nullptr ? *ptr : val; }
+};
+
+template <typename T>
+kernel_scalar<T> make_scalar(bool host, const T* p) {
+    if (host) {
+        return {*p, nullptr};
+    }
+    return {T(), p};
+}
+
+template <typename T> struct real_of { using type = T; };
+template <typename T> struct real_of<std::complex<T>> { using type = T; };
+
+// Offset of element i of an n element vector, a negative increment walks the
+// vector backwards as in reference BLAS.
+inline int64_t offset(int64_t i, int64_t n, int64_t inc) {
+    return inc >= 0 ? i * inc : (n - 1 - i) * -inc;
+}
+
+// Complex arithmetic is spelled out so that no device library call is needed.
+template <typename T> inline T conjugate(const T& v) { return v; }
+template <typename T> inline std::complex<T> conjugate(const std::complex<T>& v) {
+    return std::complex<T>(v.real(), -v.imag());
+}
+
+template <typename T> inline T mul(const T& a, const T& b) { return a * b; }
+template <typename T> inline std::complex<T> mul(const std::complex<T>& a, const std::complex<T>& b) {
+    return std::complex<T>(a.real() * b.real() - a.imag() * b.imag(),
+                           a.real() * b.imag() + a.imag() * b.real());
+}
+template <typename T> inline std::complex<T> mul(const T& a, const std::complex<T>& b) {
+    return std::complex<T>(a * b.real(), a * b.imag());
+}
+
+// |re| + |im|, the magnitude used by asum and iamax/iamin
+template <typename T> inline T abs1(const T& v) { return sycl::fabs(v); }
+template <typename T> inline T abs1(const std::complex<T>& v) {
+    return sycl::fabs(v.real()) + sycl::fabs(v.imag());
+}
+
+template <typename T> inline T real_part(const T& v) { return v; }
+template <typename T> inline std::complex<T> real_part(const std::complex<T>& v) {
+    return std::complex<T>(v.real(), T(0));
+}
+
+template <typename T> inline T real_value(const T& v) { return v; }
+template <typename T> inline T real_value(const std::complex<T>& v) { return v.real(); }
+
+template <typename T> inline T abs2(const T& v) { return v * v; }
+template <typename T> inline T abs2(const std::complex<T>& v) {
+    return v.real() * v.real() + v.imag() * v.imag();
+}
+
+template <typename G, typename T> inline T group_sum(const G& g, const T& v) {
+    return sycl::reduce_over_group(g, v, sycl::plus<T>());
+}
+template <typename G, typename T> inline std::complex<T> group_sum(const G& g, const std::complex<T>& v) {
+    return std::complex<T>(group_sum(g, v.real()), group_sum(g, v.imag()));
+}
+
+// Elementwise routines: one work-item per (batch, element) pair.
+template <typename F>
+sycl::event for_each_element(sycl::queue& q, int64_t n, int64_t batch, F f) {
+    return q.parallel_for(sycl::range<2>(batch, n), [=](sycl::item<2> it) {
+        f((int64_t)it[0], (int64_t)it[1]);
+    });
+}
+
+// Reductions: one work-group per batch entry, store(b, sum of term(b, i)).
+constexpr size_t reduce_group_size = 256;
+
+template <typename Acc, typename Term, typename Store>
+sycl::event reduce(sycl::queue& q, int64_t n, int64_t batch, Term term, Store store) {
+    return q.parallel_for(sycl::nd_range<1>(batch * reduce_group_size, reduce_group_size),
+                          [=](sycl::nd_item<1> it) {
+        int64_t b   = it.get_group(0);
+        Acc     acc = Acc(0);
+        for (int64_t i = it.get_local_id(0); i < n; i += reduce_group_size) {
+            acc += term(b, i);
+        }
+        acc = group_sum(it.get_group(), acc);
+        if (it.get_local_id(0) == 0) {
+            store(b, acc);
+        }
+    });
+}
+
+// Row reductions: one work-group per (batch, row i), store(b, i, sum over
+// j < n of term(b, i, j)). Short rows get a smaller work-group.
+template <typename Acc, typename Term, typename Store>
+sycl::event reduce_rows(sycl::queue& q, int64_t rows, int64_t n, int64_t batch, Term term, Store store) {
+    size_t group = std::min<size_t>(reduce_group_size, (std::max<int64_t>(n, 1) + 31) / 32 * 32);
+    return q.parallel_for(sycl::nd_range<2>({size_t(batch), size_t(rows) * group}, {1, group}),
+                          [=](sycl::nd_item<2> it) {
+        int64_t b   = it.get_group(0);
+        int64_t i   = it.get_group(1);
+        Acc     acc = Acc(0);
+        for (int64_t j = it.get_local_id(1); j < n; j += group) {
+            acc += term(b, i, j);
+        }
+        acc = group_sum(it.get_group(), acc);
+        if (it.get_local_id(1) == 0) {
+            store(b, i, acc);
+        }
+    });
+}
+
+template <typename S, typename BX>
+sycl::event scal(sycl::queue& q, int64_t n, kernel_scalar<S> alpha, BX x, int64_t incx, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& v = x[b][i * incx];
+        v       = mul(alpha.get(), v);
+    });
+}
+
+template <typename S, typename BX, typename BY>
+sycl::event axpy(sycl::queue& q, int64_t n, kernel_scalar<S> alpha, BX x, int64_t incx,
+                 BY y, int64_t incy, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        y[b][offset(i, n, incy)] += mul(alpha.get(), x[b][offset(i, n, incx)]);
+    });
+}
+
+template <typename BX, typename BY>
+sycl::event copy(sycl::queue& q, int64_t n, BX x, int64_t incx, BY y, int64_t incy, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        y[b][offset(i, n, incy)] = x[b][offset(i, n, incx)];
+    });
+}
+
+template <typename BX, typename BY>
+sycl::event swap(sycl::queue& q, int64_t n, BX x, int64_t incx, BY y, int64_t incy, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& u = x[b][offset(i, n, incx)];
+        auto& v = y[b][offset(i, n, incy)];
+        auto  t = u;
+        u       = v;
+        v       = t;
+    });
+}
+
+// x = c*x + s*y, y = c*y - conj(s)*x with a real c
+template <typename C, typename S, typename BX, typename BY>
+sycl::event rot(sycl::queue& q, int64_t n, BX x, int64_t incx, BY y, int64_t incy,
+                kernel_scalar<C> c, kernel_scalar<S> s, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& u  = x[b][offset(i, n, incx)];
+        auto& v  = y[b][offset(i, n, incy)];
+        auto  cv = c.get();
+        auto  sv = s.get();
+        auto  t  = mul(cv, u) + mul(sv, v);
+        v        = mul(cv, v) - mul(conjugate(sv), u);
+        u        = t;
+    });
+}
+
+// Mixed precision (Ex) forms: every element and scalar is converted to the
+// execution type E when it is read and back to its storage type when it is
+// written, so fp16/bf16 vectors are computed in fp32 without a converted copy.
+template <typename E, typename S, typename BX>
+sycl::event scal_ex(sycl::queue& q, int64_t n, kernel_scalar<S> alpha, BX x, int64_t incx, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& v = x[b][offset(i, n, incx)];
+        v       = std::remove_reference_t<decltype(v)>(mul(E(alpha.get()), E(v)));
+    });
+}
+
+template <typename E, typename S, typename BX, typename BY>
+sycl::event axpy_ex(sycl::queue& q, int64_t n, kernel_scalar<S> alpha, BX x, int64_t incx, BY y, int64_t incy,
+                    int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& v = y[b][offset(i, n, incy)];
+        v       = std::remove_reference_t<decltype(v)>(E(v) + mul(E(alpha.get()), E(x[b][offset(i, n, incx)])));
+    });
+}
+
+// c is real; for a complex c type its real part is used.
+template <typename E, typename S, typename BX, typename BY>
+sycl::event rot_ex(sycl::queue& q, int64_t n, BX x, int64_t incx, BY y, int64_t incy, kernel_scalar<S> c,
+                   kernel_scalar<S> s, int64_t batch) {
+    using R = typename real_of<E>::type;
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& u  = x[b][offset(i, n, incx)];
+        auto& v  = y[b][offset(i, n, incy)];
+        R     cv = R(real_value(c.get()));
+        E     sv = E(s.get());
+        E     xu = E(u);
+        E     yv = E(v);
+        u        = std::remove_reference_t<decltype(u)>(mul(cv, xu) + mul(sv, yv));
+        v        = std::remove_reference_t<decltype(v)>(mul(cv, yv) - mul(conjugate(sv), xu));
+    });
+}
+
+// Rotation generation as in reference BLAS. These are plain functions so that
+// the wrappers can run them on the host for host pointers as well.
+
+// Givens rotation zeroing b: a is replaced by r and b by the value z from which
+// c and s can be reconstructed.
+template <typename T>
+inline void rotg_values(T& a, T& b, T& c, T& s) {
+    T abs_a = sycl::fabs(a);
+    T abs_b = sycl::fabs(b);
+    T scale = abs_a + abs_b;
+    if (scale == T(0)) {
+        c = T(1);
+        s = T(0);
+        a = T(0);
+        b = T(0);
+        return;
+    }
+    T sa = a / scale;
+    T sb = b / scale;
+    T r  = sycl::copysign(scale * sycl::sqrt(sa * sa + sb * sb), abs_a > abs_b ? a : b);
+    c    = a / r;
+    s    = b / r;
+    T z  = T(1);
+    if (abs_a > abs_b) {
+        z = s;
+    } else if (c != T(0)) {
+        z = T(1) / c;
+    }
+    a = r;
+    b = z;
+}
+
+// Complex Givens rotation with a real c, a is replaced by r and b is kept.
+template <typename T>
+inline void rotg_values(std::complex<T>& a, std::complex<T>& b, T& c, std::complex<T>& s) {
+    T abs_a = sycl::hypot(a.real(), a.imag());
+    if (abs_a == T(0)) {
+        c = T(0);
+        s = std::complex<T>(T(1), T(0));
+        a = b;
+        return;
+    }
+    T abs_b = sycl::hypot(b.real(), b.imag());
+    T scale = abs_a + abs_b;
+    T sa    = abs_a / scale;
+    T sb    = abs_b / scale;
+    T norm  = scale * sycl::sqrt(sa * sa + sb * sb);
+    auto alpha = mul(T(1) / abs_a, a);
+    c = abs_a / norm;
+    s = mul(T(1) / norm, mul(alpha, conjugate(b)));
+    a = mul(norm, alpha);
+}
+
+// Modified Givens rotation; param receives the flag and the H matrix.
+template <typename T>
+inline void rotmg_values(T& d1, T& d2, T& x1, T y1, T* param) {
+    const T gam    = T(4096);
+    const T gamsq  = gam * gam;
+    const T rgamsq = T(1) / gamsq;
+
+    T flag = T(-1);
+    T h11 = T(0), h12 = T(0), h21 = T(0), h22 = T(0);
+    if (d1 < T(0)) {
+        d1 = d2 = x1 = T(0);
+    } else {
+        T p2 = d2 * y1;
+        if (p2 == T(0)) {
+            param[0] = T(-2);
+            return;
+        }
+        T p1 = d1 * x1;
+        T q2 = p2 * y1;
+        T q1 = p1 * x1;
+        if (sycl::fabs(q1) > sycl::fabs(q2)) {
+            h21 = -y1 / x1;
+            h12 = p2 / p1;
+            T u = T(1) - h12 * h21;
+            if (u > T(0)) {
+                flag = T(0);
+                d1 /= u;
+                d2 /= u;
+                x1 *= u;
+            } else {
+                h11 = h12 = h21 = h22 = T(0);
+                d1 = d2 = x1 = T(0);
+            }
+        } else if (q2 < T(0)) {
+            d1 = d2 = x1 = T(0);
+        } else {
+            flag = T(1);
+            h11  = p1 / p2;
+            h22  = x1 / y1;
+            T u  = T(1) + h11 * h22;
+            T t  = d2 / u;
+            d2   = d1 / u;
+            d1   = t;
+            x1   = y1 * u;
+        }
+        // rescale d1 and d2 into [1/gam^2, gam^2], which needs the full H
+        auto full_h = [&] {
+            if (flag == T(0)) {
+                h11 = h22 = T(1);
+            } else if (flag == T(1)) {
+                h21 = T(-1);
+                h12 = T(1);
+            }
+            flag = T(-1);
+        };
+        if (d1 != T(0)) {
+            while (d1 <= rgamsq || d1 >= gamsq) {
+                full_h();
+                if (d1 <= rgamsq) {
+                    d1 *= gamsq;
+                    x1 /= gam;
+                    h11 /= gam;
+                    h12 /= gam;
+                } else {
+                    d1 /= gamsq;
+                    x1 *= gam;
+                    h11 *= gam;
+                    h12 *= gam;
+                }
+            }
+        }
+        if (d2 != T(0)) {
+            while (sycl::fabs(d2) <= rgamsq || sycl::fabs(d2) >= gamsq) {
+                full_h();
+                if (sycl::fabs(d2) <= rgamsq) {
+                    d2 *= gamsq;
+                    h21 /= gam;
+                    h22 /= gam;
+                } else {
+                    d2 /= gamsq;
+                    h21 *= gam;
+                    h22 *= gam;
+                }
+            }
+        }
+    }
+    if (flag < T(0)) {
+        param[1] = h11;
+        param[2] = h21;
+        param[3] = h12;
+        param[4] = h22;
+    } else if (flag == T(0)) {
+        param[2] = h21;
+        param[3] = h12;
+    } else {
+        param[1] = h11;
+        param[4] = h22;
+    }
+    param[0] = flag;
+}
+
+// One work-item per problem.
+template <typename BA, typename BB, typename BC, typename BS>
+sycl::event rotg(sycl::queue& q, BA a, BB b, BC c, BS s, int64_t batch) {
+    return q.parallel_for(sycl::range<1>(batch), [=](sycl::id<1> it) {
+        int64_t i = it[0];
+        rotg_values(a[i][0], b[i][0], c[i][0], s[i][0]);
+    });
+}
+
+template <typename BD1, typename BD2, typename BX, typename BY, typename BP>
+sycl::event rotmg(sycl::queue& q, BD1 d1, BD2 d2, BX x1, BY y1, BP param, int64_t batch) {
+    return q.parallel_for(sycl::range<1>(batch), [=](sycl::id<1> it) {
+        int64_t i = it[0];
+        rotmg_values(d1[i][0], d2[i][0], x1[i][0], y1[i][0], param[i]);
+    });
+}
+
+// Applies the modified rotation param[b] to the b-th pair of vectors.
+template <typename T, typename BX, typename BY, typename BP>
+sycl::event rotm(sycl::queue& q, int64_t n, BX x, int64_t incx, BY y, int64_t incy, BP param,
+                 int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        const T* p    = param[b];
+        T        flag = p[0];
+        if (flag == T(-2)) {
+            return;
+        }
+        T h11 = flag == T(0) ? T(1) : p[1];
+        T h21 = flag == T(1) ? T(-1) : p[2];
+        T h12 = flag == T(1) ? T(1) : p[3];
+        T h22 = flag == T(0) ? T(1) : p[4];
+        auto& u = x[b][offset(i, n, incx)];
+        auto& v = y[b][offset(i, n, incy)];
+        T     w = u;
+        T     z = v;
+        u       = w * h11 + z * h12;
+        v       = w * h21 + z * h22;
+    });
+}
+
+// A += alpha * x * y^T (y^H for Conj); one work-item per (batch, column, row)
+// so every element of A is read and written exactly once.
+template <typename T, bool Conj, typename BX, typename BY, typename BA>
+sycl::event ger(sycl::queue& q, int64_t m, int64_t n, kernel_scalar<T> alpha, BX x, int64_t incx,
+                BY y, int64_t incy, BA a, int64_t lda, int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, m), [=](sycl::item<3> it) {
+        int64_t b  = it[0];
+        int64_t j  = it[1];
+        int64_t i  = it[2];
+        T       yj = y[b][offset(j, n, incy)];
+        a[b][i + j * lda] += mul(mul(alpha.get(), T(x[b][offset(i, m, incx)])), Conj ? conjugate(yj) : yj);
+    });
+}
+
+// A += alpha * x * x^H (her, hpr) or A += alpha * x * y^H + conj(alpha) * y * x^H
+// (her2, hpr2, Two) on the 'upper' or lower triangle of a hermitian A, stored
+// with leading dimension lda or packed (Packed); the diagonal is kept real.
+// One work-item per (batch, column, row). A zero alpha leaves A untouched, the
+// quick return of reference BLAS, also when alpha is only known on the device.
+template <typename T, bool Two, bool Packed, typename S, typename BX, typename BY, typename BA>
+sycl::event her(sycl::queue& q, bool upper, int64_t n, kernel_scalar<S> alpha, BX x, int64_t incx,
+                BY y, int64_t incy, BA a, int64_t lda, int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, n), [=](sycl::item<3> it) {
+        int64_t b  = it[0];
+        int64_t j  = it[1];
+        int64_t i  = it[2];
+        T       av = T(alpha.get());
+        if ((upper ? i > j : i < j) || av == T(0)) {
+            return;
+        }
+        T xi = x[b][offset(i, n, incx)];
+        T xj = x[b][offset(j, n, incx)];
+        T v  = mul(mul(av, xi), conjugate(Two ? T(y[b][offset(j, n, incy)]) : xj));
+        if (Two) {
+            v += mul(mul(conjugate(av), T(y[b][offset(i, n, incy)])), conjugate(xj));
+        }
+        int64_t idx = !Packed ? i + j * lda : upper ? i + j * (j + 1) / 2 : i - j + j * (2 * n - j + 1) / 2;
+        T&      e   = a[b][idx];
+        e           = i == j ? real_part(e + v) : e + v;
+    });
+}
+
+// Element (i, j) of a symmetric (hermitian for Herm) matrix of which only the
+// 'upper' or lower triangle is stored.
+template <typename T, bool Herm, typename P>
+inline T sym_element(P m, int64_t ld, bool upper, int64_t i, int64_t j) {
+    bool stored = upper ? i <= j : i >= j;
+    T    v      = stored ? m[i + j * ld] : m[j + i * ld];
+    if (Herm) {
+        v = i == j ? real_part(v) : stored ? v : conjugate(v);
+    }
+    return v;
+}
+
+// y = alpha * A * x + beta * y with A symmetric (hermitian for Herm) and only
+// the 'upper' or lower triangle referenced; one work-group per (batch, row).
+template <typename T, bool Herm, typename BA, typename BX, typename BY>
+sycl::event symv(sycl::queue& q, bool upper, int64_t n, kernel_scalar<T> alpha, BA a, int64_t lda,
+                 BX x, int64_t incx, kernel_scalar<T> beta, BY y, int64_t incy, int64_t batch) {
+    return reduce_rows<T>(q, n, n, batch,
+        [=](int64_t b, int64_t i, int64_t j) {
+            return mul(sym_element<T, Herm>(a[b], lda, upper, i, j), T(x[b][offset(j, n, incx)]));
+        },
+        [=](int64_t b, int64_t i, T acc) {
+            auto& yi = y[b][offset(i, n, incy)];
+            T     bv = beta.get();
+            // beta == 0 must not propagate NaN/Inf from an uninitialized y
+            yi = mul(alpha.get(), acc) + (bv == T(0) ? T(0) : mul(bv, T(yi)));
+        });
+}
+
+// The elements are converted to T, which also accumulates, and the sum is
+// stored as the result type; the Ex routines read fp16/bf16 data this way.
+template <typename T, bool Conj, typename BX, typename BY, typename R>
+sycl::event dot(sycl::queue& q, int64_t n, BX x, int64_t incx, BY y, int64_t incy,
+                int64_t batch, R* result) {
+    return reduce<T>(q, n, batch,
+        [=](int64_t b, int64_t i) {
+            T u = T(x[b][offset(i, n, incx)]);
+            return mul(Conj ? conjugate(u) : u, T(y[b][offset(i, n, incy)]));
+        },
+        [=](int64_t b, T acc) { result[b] = R(acc); });
+}
+
+template <typename T, typename BX>
+sycl::event asum(sycl::queue& q, int64_t n, BX x, int64_t incx, int64_t batch,
+                 typename real_of<T>::type* result) {
+    using R = typename real_of<T>::type;
+    return reduce<R>(q, n, batch,
+        [=](int64_t b, int64_t i) { return abs1(T(x[b][i * incx])); },
+        [=](int64_t b, R acc) { result[b] = acc; });
+}
+
+// Plain sum of squares; the batched use case is many short vectors, so the
+// scaling reference BLAS does against overflow is not worth a second pass.
+template <typename T, typename BX, typename Res>
+sycl::event nrm2(sycl::queue& q, int64_t n, BX x, int64_t incx, int64_t batch, Res* result) {
+    using R = typename real_of<T>::type;
+    return reduce<R>(q, n, batch,
+        [=](int64_t b, int64_t i) { return abs2(T(x[b][i * incx])); },
+        [=](int64_t b, R acc) { result[b] = Res(sycl::sqrt(acc)); });
+}
+
+// 1-based index of the first element with the largest (Max) or smallest
+// magnitude, 0 for an empty vector; Idx is int, or int64_t for the _64 API.
+template <typename T, bool Max, typename BX, typename Idx>
+sycl::event iamax(sycl::queue& q, int64_t n, BX x, int64_t incx, int64_t batch, Idx* result) {
+    using R = typename real_of<T>::type;
+    return q.parallel_for(sycl::nd_range<1>(batch * reduce_group_size, reduce_group_size),
+                          [=](sycl::nd_item<1> it) {
+        const R       none_val = Max ? R(-1) : std::numeric_limits<R>::infinity();
+        const int64_t none_idx = std::numeric_limits<int64_t>::max();
+
+        int64_t b        = it.get_group(0);
+        R       best_val = none_val;
+        int64_t best_idx = none_idx;
+        for (int64_t i = it.get_local_id(0); i < n; i += reduce_group_size) {
+            R v = abs1(T(x[b][i * incx]));
+            if (Max ? v > best_val : v < best_val) {
+                best_val = v;
+                best_idx = i;
+            }
+        }
+        auto g = it.get_group();
+        R    group_val = Max ? sycl::reduce_over_group(g, best_val, sycl::maximum<R>())
+                             : sycl::reduce_over_group(g, best_val, sycl::minimum<R>());
+        int64_t group_idx = sycl::reduce_over_group(
+            g, best_val == group_val ? best_idx : none_idx, sycl::minimum<int64_t>());
+        if (it.get_local_id(0) == 0) {
+            result[b] = group_idx == none_idx ? 0 : (Idx)(group_idx + 1);
+        }
+    });
+}
+
+// Element (i, j) of op(M) for an op applied to a column major matrix M.
+enum class op { none, trans, conj_trans };
+
+template <typename T, typename P>
+inline T op_element(P m, int64_t ld, op o, int64_t i, int64_t j) {
+    if (o == op::none) {
+        return m[i + j * ld];
+    }
+    T v = m[j + i * ld];
+    return o == op::conj_trans ? conjugate(v) : v;
+}
+
+// C = alpha * op(A) + beta * op(B); one work-item per (batch, column, row), so
+// every input element is read once. A zero alpha (beta) leaves A (B) unread,
+// and C may be A or B when the corresponding op is none.
+template <typename T, typename BA, typename BB, typename BC>
+sycl::event geam(sycl::queue& q, op transa, op transb, int64_t m, int64_t n, kernel_scalar<T> alpha,
+                 BA a, int64_t lda, kernel_scalar<T> beta, BB b, int64_t ldb, BC c, int64_t ldc,
+                 int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, m), [=](sycl::item<3> it) {
+        int64_t bi = it[0];
+        int64_t j  = it[1];
+        int64_t i  = it[2];
+        T       av = alpha.get();
+        T       bv = beta.get();
+        T       r  = T(0);
+        if (av != T(0)) {
+            r += mul(av, op_element<T>(a[bi], lda, transa, i, j));
+        }
+        if (bv != T(0)) {
+            r += mul(bv, op_element<T>(b[bi], ldb, transb, i, j));
+        }
+        c[bi][i + j * ldc] = r;
+    });
+}
+
+// y = alpha * op(A) * x + beta * y for an m x n matrix A; one work-group per
+// (batch, element of y).
+template <typename T, typename BA, typename BX, typename BY>
+sycl::event gemv(sycl::queue& q, op trans, int64_t m, int64_t n, kernel_scalar<T> alpha, BA a, int64_t lda,
+                 BX x, int64_t incx, kernel_scalar<T> beta, BY y, int64_t incy, int64_t batch) {
+    int64_t rows = trans == op::none ? m : n;
+    int64_t cols = trans == op::none ? n : m;
+    return reduce_rows<T>(q, rows, cols, batch,
+        [=](int64_t b, int64_t i, int64_t j) {
+            return mul(op_element<T>(a[b], lda, trans, i, j), T(x[b][offset(j, cols, incx)]));
+        },
+        [=](int64_t b, int64_t i, T acc) {
+            auto& yi = y[b][offset(i, rows, incy)];
+            T     bv = beta.get();
+            yi = mul(alpha.get(), acc) + (bv == T(0) ? T(0) : mul(bv, T(yi)));
+        });
+}
+
+// B = alpha * B for m x n matrices; a zero alpha clears B without reading it.
+template <typename T, typename BB>
+sycl::event scale_matrix(sycl::queue& q, int64_t m, int64_t n, kernel_scalar<T> alpha, BB b, int64_t ldb,
+                         int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, m), [=](sycl::item<3> it) {
+        int64_t bi  = it[0];
+        int64_t j   = it[1];
+        int64_t i   = it[2];
+        auto&   bij = b[bi][i + j * ldb];
+        T       av  = alpha.get();
+        bij         = av == T(0) ? T(0) : mul(av, T(bij));
+    });
+}
+
+// C = diag(x) * A (left) or A * diag(x) (right).
+template <typename BA, typename BX, typename BC>
+sycl::event dgmm(sycl::queue& q, bool left, int64_t m, int64_t n, BA a, int64_t lda, BX x, int64_t incx,
+                 BC c, int64_t ldc, int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, m), [=](sycl::item<3> it) {
+        int64_t b = it[0];
+        int64_t j = it[1];
+        int64_t i = it[2];
+        auto    d = x[b][left ? offset(i, m, incx) : offset(j, n, incx)];
+        c[b][i + j * ldc] = mul(a[b][i + j * lda], d);
+    });
+}
+
+// Batched matrix products C(i, j) = sum over l < k of left(b, i, l) * right(b, l, j),
+// passed to store(b, i, j, sum) for the elements of C in 'part'. A work-group
+// computes one tile_size x tile_size block of one matrix and stages the
+// operand blocks in local memory, so each operand element is read from global
+// memory once per block instead of once per element of C. Blocks entirely
+// outside 'part' exit right away.
+enum class part { full, upper, lower };
+
+constexpr int64_t tile_size = 16;
+
+template <typename T, typename Left, typename Right, typename Store>
+sycl::event tiled_product(sycl::queue& q, part p, int64_t m, int64_t n, int64_t k, int64_t batch, Left left,
+                          Right right, Store store) {
+    auto round_up = [](int64_t v) { return size_t((v + tile_size - 1) / tile_size * tile_size); };
+    sycl::nd_range<3> range({size_t(batch), round_up(n), round_up(m)}, {1, tile_size, tile_size});
+    return q.submit([&](sycl::handler& h) {
+        sycl::local_accessor<T, 2> lt({tile_size, tile_size}, h);
+        sycl::local_accessor<T, 2> rt({tile_size, tile_size}, h);
+        h.parallel_for(range, [=](sycl::nd_item<3> it) {
+            int64_t b  = it.get_global_id(0);
+            int64_t j  = it.get_global_id(1);
+            int64_t i  = it.get_global_id(2);
+            int64_t lj = it.get_local_id(1);
+            int64_t li = it.get_local_id(2);
+            int64_t i0 = i - li;
+            int64_t j0 = j - lj;
+            // the same for the whole work-group, so no barrier is left waiting
+            if ((p == part::upper && i0 >= j0 + tile_size) || (p == part::lower && j0 >= i0 + tile_size)) {
+                return;
+            }
+            T acc = T(0);
+            for (int64_t l0 = 0; l0 < k; l0 += tile_size) {
+                lt[li][lj] = i < m && l0 + lj < k ? T(left(b, i, l0 + lj)) : T(0);
+                rt[li][lj] = j < n && l0 + li < k ? T(right(b, l0 + li, j)) : T(0);
+                sycl::group_barrier(it.get_group());
+                for (int64_t l = 0; l < tile_size; l++) {
+                    acc += mul(lt[li][l], rt[l][lj]);
+                }
+                sycl::group_barrier(it.get_group());
+            }
+            bool in_part = p == part::full || (p == part::upper ? i <= j : i >= j);
+            if (i < m && j < n && in_part) {
+                store(b, i, j, acc);
+            }
+        });
+    });
+}
+
+// C = alpha * op(A) * op(B) + beta * C. The elements and the scalars (of type
+// S) are converted to T, which also accumulates, so the mixed precision Ex
+// forms share this kernel.
+template <typename T, typename S, typename BA, typename BB, typename BC>
+sycl::event gemm(sycl::queue& q, op transa, op transb, int64_t m, int64_t n, int64_t k, kernel_scalar<S> alpha,
+                 BA a, int64_t lda, BB b, int64_t ldb, kernel_scalar<S> beta, BC c, int64_t ldc, int64_t batch) {
+    return tiled_product<T>(q, part::full, m, n, k, batch,
+        [=](int64_t bi, int64_t i, int64_t l) { return op_element<T>(a[bi], lda, transa, i, l); },
+        [=](int64_t bi, int64_t l, int64_t j) { return op_element<T>(b[bi], ldb, transb, l, j); },
+        [=](int64_t bi, int64_t i, int64_t j, T acc) {
+            auto& cij = c[bi][i + j * ldc];
+            T     bv  = T(beta.get());
+            T     r   = mul(T(alpha.get()), acc) + (bv == T(0) ? T(0) : mul(bv, T(cij)));
+            cij       = std::decay_t<decltype(cij)>(r);
+        });
+}
+
+// C = alpha * A * B + beta * C (left) or alpha * B * A + beta * C (right) with
+// A symmetric (hermitian for Herm) and only its 'upper' or lower triangle read.
+template <typename T, bool Herm, typename BA, typename BB, typename BC>
+sycl::event symm(sycl::queue& q, bool left, bool upper, int64_t m, int64_t n, kernel_scalar<T> alpha, BA a,
+                 int64_t lda, BB b, int64_t ldb, kernel_scalar<T> beta, BC c, int64_t ldc, int64_t batch) {
+    return tiled_product<T>(q, part::full, m, n, left ? m : n, batch,
+        [=](int64_t bi, int64_t i, int64_t l) {
+            return left ? sym_element<T, Herm>(a[bi], lda, upper, i, l) : T(b[bi][i + l * ldb]);
+        },
+        [=](int64_t bi, int64_t l, int64_t j) {
+            return left ? T(b[bi][l + j * ldb]) : sym_element<T, Herm>(a[bi], lda, upper, l, j);
+        },
+        [=](int64_t bi, int64_t i, int64_t j, T acc) {
+            auto& cij = c[bi][i + j * ldc];
+            T     bv  = beta.get();
+            cij       = mul(alpha.get(), acc) + (bv == T(0) ? T(0) : mul(bv, T(cij)));
+        });
+}
+
+// Rank-k updates of the 'upper' or lower triangle of the n x n matrix C.
+// !Two: C = alpha * op(A) * op(B)^T + beta * C (^H for Herm), with B = A for
+//       syrk/herk and distinct for herkx.
+// Two:  C = alpha * op(A) * op(B)^T + alpha * op(B) * op(A)^T + beta * C, for
+// Herm (her2k) with ^H and conj(alpha) on the second term. The two terms are
+// a single product over 2k, op(A) next to op(B) on the left and op(B) on top
+// of op(A) on the right. For Herm the diagonal of C comes out real.
+template <typename T, bool Herm, bool Two, typename SA, typename SB, typename BA, typename BB, typename BC>
+sycl::event rank_k(sycl::queue& q, bool upper, op trans, int64_t n, int64_t k, kernel_scalar<SA> alpha, BA a,
+                   int64_t lda, BB b, int64_t ldb, kernel_scalar<SB> beta, BC c, int64_t ldc, int64_t batch) {
+    return tiled_product<T>(q, upper ? part::upper : part::lower, n, n, Two ? 2 * k : k, batch,
+        [=](int64_t bi, int64_t i, int64_t l) {
+            if (!Two) {
+                return op_element<T>(a[bi], lda, trans, i, l);
+            }
+            if (l < k) {
+                return mul(alpha.get(), op_element<T>(a[bi], lda, trans, i, l));
+            }
+            SA av = alpha.get();
+            return mul(Herm ? conjugate(av) : av, op_element<T>(b[bi], ldb, trans, i, l - k));
+        },
+        [=](int64_t bi, int64_t l, int64_t j) {
+            T v = !Two || l < k ? op_element<T>(b[bi], ldb, trans, j, l)
+                                : op_element<T>(a[bi], lda, trans, j, l - k);
+            return Herm ? conjugate(v) : v;
+        },
+        [=](int64_t bi, int64_t i, int64_t j, T acc) {
+            auto& cij = c[bi][i + j * ldc];
+            SB    bv  = beta.get();
+            T     r   = Two ? acc : mul(alpha.get(), acc);
+            if (bv != SB(0)) {
+                r += mul(bv, T(cij));
+            }
+            cij = Herm && i == j ? real_part(r) : r;
+        });
+}
+
+// Clears the imaginary part of the diagonal of n x n matrices, which is real
+// for a hermitian result but not for a general product such as gemmt's.
+template <typename BC>
+sycl::event real_diagonal(sycl::queue& q, int64_t n, BC c, int64_t ldc, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) {
+        auto& cii = c[b][i + i * ldc];
+        cii       = real_part(cii);
+    });
+}
+
+// Helpers for the LAPACK wrappers.
+
+// ptrs[b] = base + b * stride, the pointer array oneMKL's group APIs take
+template <typename T>
+sycl::event pointer_array(sycl::queue& q, T** ptrs, T* base, int64_t stride, int64_t batch) {
+    return q.parallel_for(sycl::range<1>(batch), [=](sycl::id<1> b) { ptrs[b] = base + b * stride; });
+}
+
+// Pivots 1..n, a non-pivoting factorization seen by a pivoting solver.
+template <typename BP>
+sycl::event identity_pivots(sycl::queue& q, int64_t n, BP ipiv, int64_t batch) {
+    return for_each_element(q, n, batch, [=](int64_t b, int64_t i) { ipiv[b][i] = i + 1; });
+}
+
+// info[b] = the 1-based index of the first zero among the first n diagonal
+// elements of A, 0 if there is none: the LAPACK info of a singular triangular
+// factor. Runs after 'after'.
+template <typename T, typename BA>
+sycl::event singular_info(sycl::queue& q, const sycl::event& after, int64_t n, BA a, int64_t lda, int* info,
+                          int64_t batch) {
+    return q.submit([&](sycl::handler& h) {
+        h.depends_on(after);
+        h.parallel_for(sycl::range<1>(batch), [=](sycl::id<1> b) {
+            int first = 0;
+            for (int64_t j = 0; j < n && first == 0; j++) {
+                if (T(a[b][j + j * lda]) == T(0)) {
+                    first = j + 1;
+                }
+            }
+            info[b] = first;
+        });
+    });
+}
+
+// C = A for m x n matrices.
+template <typename BA, typename BC>
+sycl::event copy_matrix(sycl::queue& q, int64_t m, int64_t n, BA a, int64_t lda, BC c, int64_t ldc,
+                        int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, m), [=](sycl::item<3> it) {
+        int64_t b = it[0];
+        int64_t j = it[1];
+        int64_t i = it[2];
+        c[b][i + j * ldc] = a[b][i + j * lda];
+    });
+}
+
+// C = the 'upper' or lower triangle of the n x n matrix A, zero elsewhere.
+template <typename T, typename BA, typename BC>
+sycl::event copy_triangle(sycl::queue& q, bool upper, int64_t n, BA a, int64_t lda, BC c, int64_t ldc,
+                          int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, n), [=](sycl::item<3> it) {
+        int64_t b = it[0];
+        int64_t j = it[1];
+        int64_t i = it[2];
+        c[b][i + j * ldc] = (upper ? i <= j : i >= j) ? T(a[b][i + j * lda]) : T(0);
+    });
+}
+
+// C = I for n x n matrices.
+template <typename T, typename BC>
+sycl::event identity_matrix(sycl::queue& q, int64_t n, BC c, int64_t ldc, int64_t batch) {
+    return q.parallel_for(sycl::range<3>(batch, n, n), [=](sycl::item<3> it) {
+        int64_t b = it[0];
+        int64_t j = it[1];
+        int64_t i = it[2];
+        c[b][i + j * ldc] = i == j ? T(1) : T(0);
+    });
+}
+
+} // namespace onemkl_kernels
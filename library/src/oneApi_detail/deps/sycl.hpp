@@ -2,6 +2,10 @@
 
 #include <CL/sycl.hpp>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 struct syclPlatform_st
 {
     sycl::platform val;
@@ -17,9 +21,33 @@ struct syclContext_st
     sycl::context val;
 };
 
+// Submissions to a native queue that were not flushed yet, see onemklFlush.
+struct syclPendingFlush
+{
+    std::mutex  mutex;
+    sycl::event last;
+    int         count = 0;
+};
+
 struct syclQueue_st
 {
     sycl::queue val;
+    // queues on the sub-devices (tiles) of val's device, created on first use
+    // by calls split across tiles
+    std::once_flag           tiles_once;
+    std::vector<sycl::queue> tiles;
+    // pointer mode of the handle owning this queue: scalars are host values
+    // read at submission (HIPBLAS_POINTER_MODE_HOST) or device pointers
+    bool host_scalars = true;
+    // backend of the native queue, which decides how submissions are flushed
+    sycl::backend backend = sycl::backend::ext_oneapi_level_zero;
+    // settings of the handle owning this queue: submissions are flushed in
+    // batches of up to flush_batch, and gemm, syrk and trsm calls with at least
+    // tile_split_min columns are split across tiles (0 never splits)
+    int     flush_batch    = 1;
+    int64_t tile_split_min = 0;
+    // shared by every syclQueue_st wrapping the same native queue
+    std::shared_ptr<syclPendingFlush> pending = std::make_shared<syclPendingFlush>();
 };
 
 struct syclEvent_st
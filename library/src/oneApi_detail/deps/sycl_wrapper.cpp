@@ -1,4 +1,10 @@
 #include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "sycl.hpp"
 #include <ext/oneapi/backend/level_zero.hpp>
@@ -10,39 +16,35 @@
 
 #include "sycl_w.h"
 
+namespace syclex = sycl::ext::oneapi::experimental;
+
 enum pointerMode {
     host_mode,
     device_mode
 };
 
-struct syclblasHandle
-{
-    syclPlatform_t platform;
-    syclDevice_t   device;
-    syclContext_t  context;
-    syclQueue_t    queue;
-    hipStream_t    hip_stream;
-    pointerMode    ptr_mode;
-
-    syclblasHandle(void)
-        : platform()
-        , device()
-        , context()
-        , queue()
-        , hip_stream()
-        , ptr_mode(host_mode)
-    {
-    }
-
-    ~syclblasHandle()
-    {
-        // Fix_Me: CHIP owns LZ resources hecen need to find better way to release sycl resources here
-        //syclQueueDestroy(queue);
-        //syclContextDestroy(context);
-        //syclDeviceDestroy(device);
-        //syclPlatformDestroy(platform);
+// Scalar results of reductions (dot, asum, nrm2, amax, ...) are staged in a
+// small ring of slots owned by the handle instead of being allocated per call.
+// Each slot is big enough for the widest result (a double complex or an int64
+// index).
+constexpr size_t resultSlotBytes = 16;
+constexpr int    resultSlotCount = 8;
+
+// Asynchronous errors of the work submitted to the library's queues, which
+// report to the handler of their context. oneMKL LAPACK raises
+// lapack::exception for singular factors; the routines write their info array
+// on the device instead (see lapack_info_call in onemkl.cpp), so these are
+// expected and dropped. Anything else is reported on stderr.
+static void syclAsyncHandler(sycl::exception_list errors) {
+    for (auto &error : errors) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const oneapi::mkl::lapack::exception &) {
+        } catch (const std::exception &e) {
+            std::cerr << "hipBLAS: asynchronous SYCL error: " << e.what() << std::endl;
+        }
     }
-};
+}
 
 int syclPlatformCreate(syclPlatform_t *obj,
                                   ze_driver_handle_t driver) {
@@ -76,8 +78,10 @@ int syclContextCreate(syclContext_t *obj, syclDevice_t *devices,
     for (size_t i = 0; i < ndevices; i++)
         sycl_devices[i] = devices[i]->val;
 
-    auto sycl_context =
-        sycl::ext::oneapi::level_zero::make_context(sycl_devices, (pi_native_handle) context, keep_ownership);
+    auto ownership = keep_ownership ? sycl::ext::oneapi::level_zero::ownership::keep
+                                    : sycl::ext::oneapi::level_zero::ownership::transfer;
+    auto sycl_context = sycl::make_context<sycl::backend::ext_oneapi_level_zero>(
+        {context, sycl_devices, ownership}, syclAsyncHandler);
     *obj = new syclContext_st({sycl_context});
     return 0;
 }
@@ -92,7 +96,7 @@ int syclQueueCreate(syclQueue_t *obj, syclContext_t context, syclDevice_t device
                                int keep_ownership) {
     // XXX: ownership argument only used on master
     auto sycl_queue = sycl::ext::oneapi::level_zero::make_queue(context->val, device->val, (pi_native_handle) queue, keep_ownership);
-    *obj = new syclQueue_st({sycl_queue});
+    *obj = new syclQueue_st{sycl_queue};
     return 0;
 }
 
@@ -113,6 +117,348 @@ int syclEventDestroy(syclEvent_t obj) {
    return 0;
 }
 
+// Process-wide cache of the SYCL interop objects built from the native
+// Level Zero/OpenCL handles of a HIP stream. Contexts are keyed by the native
+// context and device handles, as one native context may span several devices
+// and the SYCL objects are built for a single one, and shared by all queues
+// created on them; queues are keyed by the native queue handle. Every handle holds one reference on the queue of
+// its current stream; queues nobody references are kept around (up to
+// maxIdleInteropQueues, least recently used first out) so that switching
+// back to a previously seen stream is a cheap lookup.
+using syclInteropContextKey = std::pair<unsigned long, unsigned long>; // (context, device)
+
+struct syclInteropContext
+{
+    syclInteropContextKey key;
+    syclPlatform_t platform;
+    syclDevice_t   device;
+    syclContext_t  context;
+    int            refs; // number of cached queues living in this context
+};
+
+struct syclInteropQueue
+{
+    unsigned long       key;
+    syclInteropContext* ctx;
+    syclQueue_t         queue;
+    int                 refs; // number of handles using this queue
+};
+
+constexpr size_t maxIdleInteropQueues = 16;
+
+static std::mutex                                             interopMutex;
+static std::map<syclInteropContextKey, syclInteropContext*>   interopContexts;
+static std::unordered_map<unsigned long, syclInteropQueue*>   interopQueues;
+static std::list<syclInteropQueue*>                           interopIdleQueues;
+
+static syclInteropContext* interopCreateContext(unsigned long const* nativeHandles, hipBlasBackend backend)
+{
+    auto ctx = new syclInteropContext();
+    if (backend == opencl) {
+        cl_platform_id hPlatformId = (cl_platform_id)nativeHandles[0];
+        cl_device_id hDeviceId = (cl_device_id)nativeHandles[1];
+        cl_context hContext = (cl_context)nativeHandles[2];
+
+        auto sycl_platform = sycl::opencl::make_platform((pi_native_handle)hPlatformId);
+        ctx->platform = new syclPlatform_st({sycl_platform});
+        auto sycl_device = sycl::opencl::make_device((pi_native_handle)hDeviceId);
+        ctx->device = new syclDevice_st({sycl_device});
+        auto sycl_context = sycl::make_context<sycl::backend::opencl>(hContext, syclAsyncHandler);
+        ctx->context = new syclContext_st({sycl_context});
+    } else {
+        // Obtain the handles to the LZ constructs.
+        auto hDriver  = (ze_driver_handle_t)nativeHandles[0];
+        auto hDevice  = (ze_device_handle_t)nativeHandles[1];
+        auto hContext = (ze_context_handle_t)nativeHandles[2];
+
+        // Build SYCL platform/device/context from the LZ handles.
+        syclPlatformCreate(&ctx->platform, hDriver);
+        syclDeviceCreate(&ctx->device, ctx->platform, hDevice);
+
+        // FIX ME: only 1 device is returned from CHIP-SPV's lzHandles
+        syclContextCreate(
+            &ctx->context, &ctx->device, 1 /*ndevices*/, hContext, 1 /*keep_ownership*/);
+    }
+    ctx->key  = {nativeHandles[2], nativeHandles[1]};
+    ctx->refs = 0;
+    return ctx;
+}
+
+static syclQueue_t interopCreateQueue(syclInteropContext* ctx, unsigned long nativeQueue, hipBlasBackend backend)
+{
+    syclQueue_t queue;
+    if (backend == opencl) {
+        auto sycl_queue = sycl::opencl::make_queue(ctx->context->val, (pi_native_handle)nativeQueue);
+        queue = new syclQueue_st{sycl_queue};
+        queue->backend = sycl::backend::opencl;
+    } else {
+        syclQueueCreate(&queue, ctx->context, ctx->device, (ze_command_queue_handle_t)nativeQueue, 1 /* keep ownership */);
+    }
+    return queue;
+}
+
+// Drops a queue that is no longer referenced, together with its context
+// once the last queue of that context is gone. Caller holds interopMutex.
+static void interopEvict(syclInteropQueue* entry)
+{
+    interopQueues.erase(entry->key);
+    syclQueueDestroy(entry->queue);
+
+    auto ctx = entry->ctx;
+    if (--ctx->refs == 0) {
+        interopContexts.erase(ctx->key);
+        syclContextDestroy(ctx->context);
+        syclDeviceDestroy(ctx->device);
+        syclPlatformDestroy(ctx->platform);
+        delete ctx;
+    }
+    delete entry;
+}
+
+static syclInteropQueue* interopAcquire(unsigned long const* nativeHandles, hipBlasBackend backend)
+{
+    std::lock_guard<std::mutex> lock(interopMutex);
+
+    auto found = interopQueues.find(nativeHandles[3]);
+    if (found != interopQueues.end()) {
+        auto entry = found->second;
+        if (entry->refs++ == 0) {
+            interopIdleQueues.remove(entry);
+        }
+        return entry;
+    }
+
+    syclInteropContext* ctx;
+    auto foundCtx = interopContexts.find({nativeHandles[2], nativeHandles[1]});
+    if (foundCtx != interopContexts.end()) {
+        ctx = foundCtx->second;
+    } else {
+        ctx = interopCreateContext(nativeHandles, backend);
+        interopContexts[ctx->key] = ctx;
+    }
+
+    auto entry   = new syclInteropQueue();
+    entry->key   = nativeHandles[3];
+    entry->ctx   = ctx;
+    entry->queue = interopCreateQueue(ctx, nativeHandles[3], backend);
+    entry->refs  = 1;
+    ctx->refs++;
+    interopQueues[entry->key] = entry;
+    return entry;
+}
+
+static void interopRelease(syclInteropQueue* entry)
+{
+    if (entry == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(interopMutex);
+    if (--entry->refs > 0) {
+        return;
+    }
+    interopIdleQueues.push_back(entry);
+    while (interopIdleQueues.size() > maxIdleInteropQueues) {
+        auto oldest = interopIdleQueues.front();
+        interopIdleQueues.pop_front();
+        interopEvict(oldest);
+    }
+}
+
+struct syclblasHandle
+{
+    syclPlatform_t platform;
+    syclDevice_t   device;
+    syclContext_t  context;
+    hipStream_t    hip_stream;
+    pointerMode    ptr_mode;
+    // flush batch and tile split minimum, see syclblas_set_queue_settings
+    int            flush_batch;
+    int64_t        tile_split_min;
+
+    // the cache entry the objects above are borrowed from
+    syclInteropQueue* interop;
+
+    // this handle's view of the cached queue of hip_stream, so that state of
+    // the handle the oneMKL wrappers need (the pointer mode and the settings)
+    // travels with the
+    // syclQueue_t they are given
+    std::unique_ptr<syclQueue_st> queue;
+
+    // result staging pool, allocated lazily in 'context'
+    char*          result_dev;
+    char*          result_host;
+    int            result_next;
+
+    // grow-only scratch buffers for results that do not fit a slot (batched
+    // reductions), allocated lazily in 'context'
+    char*          workspace[2];
+    size_t         workspace_bytes[2];
+
+    // oneMKL LAPACK scratchpad, grow-only as well, and the size every solver
+    // problem shape asked for, so *_scratchpad_size is queried once per shape
+    char*          scratchpad;
+    size_t         scratchpad_bytes;
+    std::map<std::vector<int64_t>, int64_t> scratchpad_sizes;
+
+    // command graph 'queue' is being recorded into between
+    // syclblas_begin_capture and syclblas_end_capture, and the number of
+    // finalized captures alive. Those may reference the buffers above, so
+    // buffers released while any is alive are kept in 'retired' until the
+    // last one is destroyed.
+    std::unique_ptr<syclex::command_graph<syclex::graph_state::modifiable>> recording;
+    int                                                                      live_captures;
+    std::vector<std::pair<void*, sycl::context>>                             retired;
+
+    syclblasHandle(void)
+        : platform()
+        , device()
+        , context()
+        , hip_stream()
+        , ptr_mode(host_mode)
+        , flush_batch(1)
+        , tile_split_min(0)
+        , interop(nullptr)
+        , queue()
+        , result_dev(nullptr)
+        , result_host(nullptr)
+        , result_next(0)
+        , workspace()
+        , workspace_bytes()
+        , scratchpad(nullptr)
+        , scratchpad_bytes(0)
+        , live_captures(0)
+    {
+    }
+
+    void freeBuffer(void* ptr)
+    {
+        if (live_captures > 0) {
+            retired.emplace_back(ptr, context->val);
+        } else {
+            sycl::free(ptr, context->val);
+        }
+    }
+
+    void releaseRetired()
+    {
+        for (auto& buffer : retired) {
+            sycl::free(buffer.first, buffer.second);
+        }
+        retired.clear();
+    }
+
+    void releaseResultPool()
+    {
+        if (result_dev == nullptr) {
+            return;
+        }
+        // slots may still be referenced by work in flight
+        queue->val.wait();
+        freeBuffer(result_dev);
+        freeBuffer(result_host);
+        result_dev  = nullptr;
+        result_host = nullptr;
+        result_next = 0;
+    }
+
+    void releaseWorkspace(int kind)
+    {
+        if (workspace[kind] == nullptr) {
+            return;
+        }
+        // the buffer may still be referenced by work in flight
+        queue->val.wait();
+        freeBuffer(workspace[kind]);
+        workspace[kind]       = nullptr;
+        workspace_bytes[kind] = 0;
+    }
+
+    void* getWorkspace(size_t bytes, bool host)
+    {
+        int kind = host ? 1 : 0;
+        if (workspace_bytes[kind] < bytes) {
+            char* grown = host ? (char*)sycl::malloc_host(bytes, context->val)
+                               : (char*)sycl::malloc_device(bytes, device->val, context->val);
+            if (grown == nullptr) {
+                return nullptr;
+            }
+            releaseWorkspace(kind);
+            workspace[kind]       = grown;
+            workspace_bytes[kind] = bytes;
+        }
+        return workspace[kind];
+    }
+
+    void releaseScratchpad()
+    {
+        // sizes depend on the device, forget them along with the buffer
+        scratchpad_sizes.clear();
+        if (scratchpad == nullptr) {
+            return;
+        }
+        queue->val.wait();
+        freeBuffer(scratchpad);
+        scratchpad       = nullptr;
+        scratchpad_bytes = 0;
+    }
+
+    void* getScratchpad(size_t bytes)
+    {
+        if (scratchpad_bytes < bytes) {
+            char* grown = (char*)sycl::malloc_device(bytes, device->val, context->val);
+            if (grown == nullptr) {
+                return nullptr;
+            }
+            if (scratchpad != nullptr) {
+                queue->val.wait();
+                freeBuffer(scratchpad);
+            }
+            scratchpad       = grown;
+            scratchpad_bytes = bytes;
+        }
+        return scratchpad;
+    }
+
+    void* getResultSlot(bool host)
+    {
+        if (result_dev == nullptr) {
+            char* dev_pool  = (char*)sycl::malloc_device(resultSlotBytes * resultSlotCount, device->val, context->val);
+            char* host_pool = (char*)sycl::malloc_host(resultSlotBytes * resultSlotCount, context->val);
+            if (dev_pool == nullptr || host_pool == nullptr) {
+                // nothing can reference these yet
+                sycl::free(dev_pool, context->val);
+                sycl::free(host_pool, context->val);
+                return nullptr;
+            }
+            result_dev  = dev_pool;
+            result_host = host_pool;
+        }
+        size_t offset = resultSlotBytes * result_next;
+        result_next   = (result_next + 1) % resultSlotCount;
+        return (host ? result_host : result_dev) + offset;
+    }
+
+    ~syclblasHandle()
+    {
+        if (recording) {
+            recording->end_recording();
+            recording.reset();
+        }
+        if (queue != nullptr) {
+            onemklFlush(queue.get());
+        }
+        // captures must not outlive their handle
+        live_captures = 0;
+        releaseResultPool();
+        releaseWorkspace(0);
+        releaseWorkspace(1);
+        releaseScratchpad();
+        releaseRetired();
+        // the SYCL objects are shared through the interop cache
+        interopRelease(interop);
+    }
+};
+
 hipblasStatus_t syclGetPointerMode(syclblasHandle_t handle, int * mode) {
     if (handle == nullptr || mode == nullptr) {
         return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
@@ -126,6 +472,24 @@ hipblasStatus_t syclSetPointerMode(syclblasHandle_t handle, int mode) {
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
     handle->ptr_mode = (pointerMode)mode;
+    if (handle->queue != nullptr) {
+        handle->queue->host_scalars = handle->ptr_mode == host_mode;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t syclblas_set_queue_settings(syclblasHandle_t handle, int flush_batch, int64_t tile_split_min) {
+    if (handle == nullptr) {
+        return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
+    }
+    handle->flush_batch    = flush_batch < 1 ? 1 : flush_batch;
+    handle->tile_split_min = tile_split_min < 0 ? 0 : tile_split_min;
+    if (handle->queue != nullptr) {
+        // work coalesced under a larger batch must not wait for its next flush
+        onemklFlush(handle->queue.get());
+        handle->queue->flush_batch    = handle->flush_batch;
+        handle->queue->tile_split_min = handle->tile_split_min;
+    }
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -156,68 +520,40 @@ hipblasStatus_t syclblas_set_stream(syclblasHandle_t     handle,
     assert(nHandles == 4);
     if(handle != nullptr)
     {
-        handle->hip_stream = stream;
+        if (handle->recording) {
+            // the graph records the queue of the current stream
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
         std::string hipBackend(hipBlasBackendName);
-        if (hipBackend == "opencl") {
-            hipblas_backend = opencl;
-            // handle openCl case here
-            cl_platform_id hPlatformId = (cl_platform_id)nativeHandles[0];
-            cl_device_id hDeviceId = (cl_device_id)nativeHandles[1];
-            cl_context hContext = (cl_context)nativeHandles[2];
-            cl_command_queue hQueue = (cl_command_queue)nativeHandles[3];
-
-            // platform
-            auto sycl_platform = sycl::opencl::make_platform((pi_native_handle)hPlatformId);
-            handle->platform = new syclPlatform_st({sycl_platform});
-            // device
-            auto sycl_device = sycl::opencl::make_device((pi_native_handle)hDeviceId);
-            handle->device = new syclDevice_st({sycl_device});
-
-            // context
-            auto sycl_context = sycl::opencl::make_context((pi_native_handle)hContext);
-            handle->context = new syclContext_st({sycl_context});
-
-            // queue
-            auto sycl_queue = sycl::opencl::make_queue(sycl_context, (pi_native_handle)hQueue);
-            handle->queue = new syclQueue_st({sycl_queue});
-        } else {
-            hipblas_backend = level0;
-            // Obtain the handles to the LZ constructs.
-            auto hDriver  = (ze_driver_handle_t)nativeHandles[0];
-            auto hDevice  = (ze_device_handle_t)nativeHandles[1];
-            auto hContext = (ze_context_handle_t)nativeHandles[2];
-            auto hQueue   = (ze_command_queue_handle_t)nativeHandles[3];
-
-            // Build SYCL platform/device/queue from the LZ handles.
-            syclPlatformCreate(&handle->platform, hDriver);
-            syclDeviceCreate(&handle->device, handle->platform, hDevice);
-
-            // FIX ME: only 1 device is returned from CHIP-SPV's lzHandles
-            syclContextCreate(
-                &handle->context, &handle->device, 1 /*ndevices*/, hContext, 1 /*keep_ownership*/);
-            syclQueueCreate(&handle->queue, handle->context, handle->device, hQueue, 1 /* keep ownership */);
-
-            auto asyncExceptionHandler = [](sycl::exception_list exceptions) {
-                // Report all asynchronous exceptions that occurred.
-                for(std::exception_ptr const& e : exceptions)
-                {
-                    try
-                    {
-                        std::rethrow_exception(e);
-                    }
-                    catch(std::exception& e)
-                    {
-                        std::cerr << "Async exception: " << e.what() << std::endl;
-                    }
-                }
-
-                // Rethrow the first asynchronous exception.
-                for(std::exception_ptr const& e : exceptions)
-                {
-                    std::rethrow_exception(e);
-                }
-            };
+        hipBlasBackend backend = (hipBackend == "opencl") ? opencl : level0;
+
+        // Look the new stream up first so that switching back and forth
+        // between two streams never drops the last reference in between.
+        syclInteropQueue* interop = interopAcquire(nativeHandles, backend);
+        if (handle->queue != nullptr) {
+            // work coalesced on the previous stream must not wait for its next flush
+            onemklFlush(handle->queue.get());
+        }
+        if (handle->interop != nullptr && handle->interop->ctx != interop->ctx) {
+            // the pool belongs to the context of the previous stream
+            handle->releaseResultPool();
+            handle->releaseWorkspace(0);
+            handle->releaseWorkspace(1);
+            handle->releaseScratchpad();
         }
+        interopRelease(handle->interop);
+
+        handle->interop    = interop;
+        handle->platform   = interop->ctx->platform;
+        handle->device     = interop->ctx->device;
+        handle->context    = interop->ctx->context;
+        handle->hip_stream = stream;
+        handle->queue.reset(new syclQueue_st{interop->queue->val});
+        handle->queue->host_scalars   = handle->ptr_mode == host_mode;
+        handle->queue->flush_batch    = handle->flush_batch;
+        handle->queue->tile_split_min = handle->tile_split_min;
+        handle->queue->backend        = interop->queue->backend;
+        handle->queue->pending        = interop->queue->pending;
     }
 
     return (handle != nullptr) ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
@@ -227,13 +563,110 @@ hipblasStatus_t syclblas_get_hipstream(syclblasHandle_t handle, hipStream_t* pSt
     if (handle == nullptr || pStream == nullptr) {
         return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
     }
+    // the caller is about to synchronize on the stream or hand it to HIP
+    if (handle->queue != nullptr) {
+        onemklFlush(handle->queue.get());
+    }
     *pStream = handle->hip_stream;
     return HIPBLAS_STATUS_SUCCESS;
 }
 syclQueue_t syclblas_get_sycl_queue(syclblasHandle_t handle)
 {
-    return handle->queue;
+    return handle->queue.get();
+}
+void syclblas_flush_stream(unsigned long const* nativeHandles, int nHandles) {
+    assert(nHandles == 4);
+    std::lock_guard<std::mutex> lock(interopMutex);
+    auto found = interopQueues.find(nativeHandles[3]);
+    if (found != interopQueues.end()) {
+        onemklFlush(found->second->queue);
+    }
 }
 void syclblas_queue_wait(syclQueue_t queue) {
+    onemklFlush(queue);
     queue->val.wait();
 }
+void* syclblas_get_result_slot(syclblasHandle_t handle, int host_slot) {
+    return handle->getResultSlot(host_slot != 0);
+}
+void* syclblas_get_workspace(syclblasHandle_t handle, size_t bytes, int host) {
+    return handle->getWorkspace(bytes, host != 0);
+}
+int64_t syclblas_find_scratchpad_size(syclblasHandle_t handle, const int64_t* key, int nkey) {
+    auto it = handle->scratchpad_sizes.find(std::vector<int64_t>(key, key + nkey));
+    return it != handle->scratchpad_sizes.end() ? it->second : -1;
+}
+void* syclblas_get_scratchpad(syclblasHandle_t handle, const int64_t* key, int nkey, int64_t bytes) {
+    handle->scratchpad_sizes[std::vector<int64_t>(key, key + nkey)] = bytes;
+    return handle->getScratchpad(bytes);
+}
+
+// Capture: a sycl_ext_oneapi_graph command graph records everything submitted
+// to the handle's queue, finalized it replays the whole sequence with one
+// submission.
+struct syclblasCapture
+{
+    syclblasHandle_t                                       handle;
+    syclex::command_graph<syclex::graph_state::executable> exec;
+};
+
+hipblasStatus_t syclblas_begin_capture(syclblasHandle_t handle)
+{
+    if (handle == nullptr) {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if (handle->recording) {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    // work queued before must not wait for the end of the capture to be flushed
+    onemklFlush(handle->queue.get());
+    handle->recording = std::make_unique<syclex::command_graph<syclex::graph_state::modifiable>>(
+        handle->context->val, handle->device->val);
+    handle->recording->begin_recording(handle->queue->val);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t syclblas_end_capture(syclblasHandle_t handle, void** capture)
+{
+    if (handle == nullptr) {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if (capture == nullptr || !handle->recording) {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    auto graph = std::move(handle->recording);
+    graph->end_recording(handle->queue->val);
+    *capture = new syclblasCapture{handle, graph->finalize()};
+    handle->live_captures++;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t syclblas_launch_capture(syclblasHandle_t handle, void* capture)
+{
+    if (handle == nullptr) {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if (capture == nullptr || handle->recording) {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    auto         c = (syclblasCapture*)capture;
+    syclEvent_st event{handle->queue->val.ext_oneapi_graph(c->exec)};
+    onemklSubmitted(handle->queue.get(), &event);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t syclblas_destroy_capture(void* capture)
+{
+    if (capture == nullptr) {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    auto c      = (syclblasCapture*)capture;
+    auto handle = c->handle;
+    // replays may still be running
+    syclblas_queue_wait(handle->queue.get());
+    if (--handle->live_captures == 0) {
+        handle->releaseRetired();
+    }
+    delete c;
+    return HIPBLAS_STATUS_SUCCESS;
+}
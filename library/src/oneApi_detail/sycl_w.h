@@ -20,8 +20,39 @@ hipblasStatus_t syclblas_set_stream(syclblasHandle_t handle,
 hipblasStatus_t syclblas_get_hipstream(syclblasHandle_t handle, hipStream_t* pStream);
 syclQueue_t syclblas_get_sycl_queue(syclblasHandle_t handle);
 void syclblas_queue_wait(syclQueue_t queue);
+// Flushes the oneMKL work pending on the native queue with the given handles,
+// if the library has a queue for it.
+void syclblas_flush_stream(unsigned long const* nativeHandles, int nHandles);
+// Returns a scratch slot for a scalar result: device USM when host_slot == 0,
+// pinned host USM otherwise. Slots are recycled in a ring owned by the handle.
+// Returns nullptr if the ring cannot be allocated.
+void* syclblas_get_result_slot(syclblasHandle_t handle, int host_slot);
+// Returns a scratch buffer of at least 'bytes' bytes, device USM when host == 0,
+// pinned host USM otherwise. The buffer is owned by the handle and reused by
+// the next call, growing it waits for the queue. Returns nullptr, keeping the
+// current buffer, if the larger one cannot be allocated.
+void* syclblas_get_workspace(syclblasHandle_t handle, size_t bytes, int host);
+// Solver scratchpad sizes are cached per handle, keyed by routine and problem
+// shape: returns the bytes recorded for 'key', or -1 if the shape is new.
+int64_t syclblas_find_scratchpad_size(syclblasHandle_t handle, const int64_t* key, int nkey);
+// Records 'bytes' for 'key' and returns the handle's device scratchpad of at
+// least that size. Growing it waits for the queue. Returns nullptr, keeping the
+// current scratchpad, if the larger one cannot be allocated.
+void* syclblas_get_scratchpad(syclblasHandle_t handle, const int64_t* key, int nkey, int64_t bytes);
+// Records the work submitted to the handle's queue into a command graph until
+// syclblas_end_capture, which returns it finalized. Captures replay on the
+// handle's current queue and must be destroyed before the handle.
+hipblasStatus_t syclblas_begin_capture(syclblasHandle_t handle);
+hipblasStatus_t syclblas_end_capture(syclblasHandle_t handle, void** capture);
+hipblasStatus_t syclblas_launch_capture(syclblasHandle_t handle, void* capture);
+hipblasStatus_t syclblas_destroy_capture(void* capture);
 hipblasStatus_t syclGetPointerMode(syclblasHandle_t handle, int * mode);
 hipblasStatus_t syclSetPointerMode(syclblasHandle_t handle, int mode);
+// Per handle: submissions are flushed into the native queue in batches of up
+// to flush_batch (1 flushes every call), and gemm, syrk and trsm calls with at
+// least tile_split_min columns are split across the tiles of the device (0
+// never splits).
+hipblasStatus_t syclblas_set_queue_settings(syclblasHandle_t handle, int flush_batch, int64_t tile_split_min);
 #ifdef __cplusplus
 }
 #endif